@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/devicetree.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/logging/log.h>
@@ -11,6 +12,7 @@
 #include <zephyr/drivers/virtio/virtqueue.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/byteorder.h>
 #include "eth.h"
 
 #define DT_DRV_COMPAT virtio_net
@@ -87,6 +89,23 @@ enum _virtio_net_hdr_gso_types {
 
 #define VIRTIO_NET_BUFLEN                                                                          \
 	(NET_ETH_MTU + sizeof(struct net_eth_hdr) + sizeof(struct _virtio_net_hdr))
+
+/* The headers of a GSO packet take less than one more MTU */
+#if defined(CONFIG_ETH_VIRTIO_NET_TSO)
+#define VIRTIO_NET_TX_BUFLEN                                                                       \
+	(sizeof(struct _virtio_net_hdr) + NET_ETH_MAX_HDR_SIZE +                                   \
+	 (CONFIG_NET_TCP_GSO_MAX_SEGS + 1) * NET_ETH_MTU)
+#else
+#define VIRTIO_NET_TX_BUFLEN VIRTIO_NET_BUFLEN
+#endif
+
+/* Coalesced segments are up to the maximum size of an IP packet */
+#if defined(CONFIG_ETH_VIRTIO_NET_LRO)
+#define VIRTIO_NET_RX_BUFLEN                                                                       \
+	(sizeof(struct _virtio_net_hdr) + NET_ETH_MAX_HDR_SIZE + NET_IPV6H_LEN + UINT16_MAX)
+#else
+#define VIRTIO_NET_RX_BUFLEN VIRTIO_NET_BUFLEN
+#endif
 /* virtqueue pairs are numbered from 1 upwards */
 /* convert pair number to virtqueue index */
 #define VIRTQ_RX(n) ((n - 1) * 2)
@@ -109,9 +128,10 @@ struct virtnet_data {
 	struct net_if *iface;
 	const struct _virtio_net_config *virtio_devcfg;
 	uint8_t mac[6];
+	enum ethernet_hw_caps offload_caps;
 	struct _rx_cb_data rx_cb_data[CONFIG_ETH_VIRTIO_NET_RX_BUFFERS];
-	uint8_t txb[VIRTIO_NET_BUFLEN];
-	uint8_t rxb[CONFIG_ETH_VIRTIO_NET_RX_BUFFERS][VIRTIO_NET_BUFLEN];
+	uint8_t txb[VIRTIO_NET_TX_BUFLEN];
+	uint8_t rxb[CONFIG_ETH_VIRTIO_NET_RX_BUFFERS][VIRTIO_NET_RX_BUFLEN];
 };
 
 static uint16_t virtnet_enum_queues_cb(uint16_t q_index, uint16_t q_size_max, void *)
@@ -125,21 +145,114 @@ static uint16_t virtnet_enum_queues_cb(uint16_t q_index, uint16_t q_size_max, vo
 
 static enum ethernet_hw_caps virtnet_get_capabilities(const struct device *dev)
 {
+	struct virtnet_data *data = dev->data;
+
 	return ETHERNET_LINK_10BASE | ETHERNET_LINK_100BASE | ETHERNET_LINK_1000BASE |
-	       ETHERNET_LINK_2500BASE | ETHERNET_LINK_5000BASE;
+	       ETHERNET_LINK_2500BASE | ETHERNET_LINK_5000BASE | data->offload_caps;
+}
+
+#if defined(CONFIG_ETH_VIRTIO_NET_TSO) || defined(CONFIG_ETH_VIRTIO_NET_LRO)
+/* Add data to a one's complement sum, the result is not folded */
+static uint32_t virtnet_csum_add(uint32_t sum, const uint8_t *data, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i + 1 < len; i += 2) {
+		sum += sys_get_be16(&data[i]);
+	}
+
+	if (i < len) {
+		sum += data[i] << 8;
+	}
+
+	return sum;
+}
+
+static uint16_t virtnet_csum_fold(uint32_t sum)
+{
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+
+	return sum;
+}
+#endif
+
+#if defined(CONFIG_ETH_VIRTIO_NET_TSO)
+/* Describe the segmentation of a GSO packet to the device. The TCP checksum
+ * is replaced by the one of the pseudo-header, which the device completes
+ * for each segment.
+ */
+static int virtnet_fill_gso_hdr(struct net_pkt *pkt, struct _virtio_net_hdr *hdr,
+				uint8_t *frame, size_t len)
+{
+	size_t l3_offset = sizeof(struct net_eth_hdr);
+	size_t l4_offset;
+	uint8_t *tcp_hdr;
+	uint32_t sum;
+
+	if (sys_get_be16(&frame[offsetof(struct net_eth_hdr, type)]) == NET_ETH_PTYPE_VLAN) {
+		l3_offset += NET_ETH_VLAN_HDR_SIZE;
+	}
+
+	l4_offset = l3_offset + net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	if (l4_offset + sizeof(struct net_tcp_hdr) > len) {
+		return -EINVAL;
+	}
+
+	tcp_hdr = &frame[l4_offset];
+
+	if (net_pkt_family(pkt) == NET_AF_INET) {
+		hdr->gso_type = VIRTIO_NET_HDR_GSO_TCPV4;
+		sum = virtnet_csum_add(0, &frame[l3_offset + offsetof(struct net_ipv4_hdr, src)],
+				       2 * sizeof(struct net_in_addr));
+	} else {
+		hdr->gso_type = VIRTIO_NET_HDR_GSO_TCPV6;
+		sum = virtnet_csum_add(0, &frame[l3_offset + offsetof(struct net_ipv6_hdr, src)],
+				       2 * sizeof(struct net_in6_addr));
+	}
+
+	sum += NET_IPPROTO_TCP + (len - l4_offset);
+	sys_put_be16(virtnet_csum_fold(sum),
+		     &tcp_hdr[offsetof(struct net_tcp_hdr, chksum)]);
+
+	hdr->flags = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+	hdr->csum_start = sys_cpu_to_le16(l4_offset);
+	hdr->csum_offset = sys_cpu_to_le16(offsetof(struct net_tcp_hdr, chksum));
+	hdr->hdr_len = sys_cpu_to_le16(l4_offset + (tcp_hdr[12] >> 4) * 4);
+	hdr->gso_size = sys_cpu_to_le16(net_pkt_gso_size(pkt));
+
+	return 0;
 }
+#endif
 
 static int virtnet_send(const struct device *dev, struct net_pkt *pkt)
 {
 	const struct virtnet_config *config = dev->config;
 	struct virtnet_data *data = dev->data;
+	struct _virtio_net_hdr *hdr = (struct _virtio_net_hdr *)data->txb;
+	uint8_t *frame = data->txb + sizeof(struct _virtio_net_hdr);
 	size_t len = net_pkt_get_len(pkt);
 
-	if (net_pkt_read(pkt, data->txb + sizeof(struct _virtio_net_hdr), len)) {
+	if (len > sizeof(data->txb) - sizeof(struct _virtio_net_hdr)) {
+		LOG_ERR("packet of %zu bytes too large", len);
+		return -EMSGSIZE;
+	}
+
+	if (net_pkt_read(pkt, frame, len)) {
 		LOG_ERR("could not read contents of packet to be sent");
 		return -EIO;
 	}
 
+	memset(hdr, 0, sizeof(*hdr));
+
+#if defined(CONFIG_ETH_VIRTIO_NET_TSO)
+	if (net_pkt_gso_size(pkt) > 0 && virtnet_fill_gso_hdr(pkt, hdr, frame, len)) {
+		LOG_ERR("invalid GSO packet");
+		return -EINVAL;
+	}
+#endif
+
 	struct virtq *vq = virtio_get_virtqueue(config->vdev, VIRTQ_TX(1));
 	struct virtq_buf vqbuf[] = {
 		{.addr = data->txb, .len = sizeof(struct _virtio_net_hdr) + len}};
@@ -161,6 +274,24 @@ void virtnet_rx_cb(void *priv, uint32_t len)
 	struct virtq *vq = virtio_get_virtqueue(config->vdev, VIRTQ_RX(1));
 
 	len -= sizeof(struct _virtio_net_hdr);
+
+#if defined(CONFIG_ETH_VIRTIO_NET_LRO)
+	/* The device leaves the checksum of coalesced segments partial */
+	const struct _virtio_net_hdr *hdr = (const struct _virtio_net_hdr *)data->rxb[buf_no];
+	uint8_t *frame = &data->rxb[buf_no][sizeof(struct _virtio_net_hdr)];
+
+	if (hdr->flags & VIRTIO_NET_HDR_F_NEEDS_CSUM) {
+		uint16_t start = sys_le16_to_cpu(hdr->csum_start);
+		uint16_t offset = sys_le16_to_cpu(hdr->csum_offset);
+
+		if (start + offset + sizeof(uint16_t) <= len) {
+			sys_put_be16(~virtnet_csum_fold(virtnet_csum_add(0, &frame[start],
+									 len - start)),
+				     &frame[start + offset]);
+		}
+	}
+#endif
+
 	struct net_pkt *pkt =
 		net_pkt_rx_alloc_with_buffer(data->iface, len, NET_AF_UNSPEC, 0, K_FOREVER);
 
@@ -175,7 +306,7 @@ void virtnet_rx_cb(void *priv, uint32_t len)
 	} else {
 		/* Packet received correctly, no error */
 	}
-	struct virtq_buf vqbuf[] = {{.addr = &(data->rxb[buf_no]), .len = VIRTIO_NET_BUFLEN}};
+	struct virtq_buf vqbuf[] = {{.addr = &(data->rxb[buf_no]), .len = VIRTIO_NET_RX_BUFLEN}};
 
 	virtq_add_buffer_chain(vq, vqbuf, 1, 0, virtnet_rx_cb, priv, K_FOREVER);
 	virtio_notify_virtqueue(config->vdev, VIRTQ_RX(1));
@@ -196,7 +327,7 @@ static void virtnet_if_init(struct net_if *iface)
 		data->rx_cb_data[i].data = data;
 		data->rx_cb_data[i].buf_no = i;
 
-		struct virtq_buf vqbuf[] = {{.addr = &(data->rxb[i]), .len = VIRTIO_NET_BUFLEN}};
+		struct virtq_buf vqbuf[] = {{.addr = &(data->rxb[i]), .len = VIRTIO_NET_RX_BUFLEN}};
 
 		virtq_add_buffer_chain(vq, vqbuf, 1, 0, virtnet_rx_cb, &(data->rx_cb_data[i]),
 				       K_FOREVER);
@@ -205,6 +336,44 @@ static void virtnet_if_init(struct net_if *iface)
 	LOG_DBG("initialization finished");
 }
 
+/* Enable the offloads when the device supports them for both IPv4 and IPv6 */
+static void virtnet_negotiate_offloads(const struct device *dev)
+{
+	const struct virtnet_config *config = dev->config;
+	struct virtnet_data *data = dev->data;
+	const struct device *vdev = config->vdev;
+
+	ARG_UNUSED(vdev);
+
+	data->offload_caps = 0;
+
+#if defined(CONFIG_ETH_VIRTIO_NET_TSO)
+	if (virtio_read_device_feature_bit(vdev, VIRTIO_NET_F_CSUM) &&
+	    virtio_read_device_feature_bit(vdev, VIRTIO_NET_F_HOST_TSO4) &&
+	    virtio_read_device_feature_bit(vdev, VIRTIO_NET_F_HOST_TSO6) &&
+	    virtio_write_driver_feature_bit(vdev, VIRTIO_NET_F_CSUM, true) == 0 &&
+	    virtio_write_driver_feature_bit(vdev, VIRTIO_NET_F_HOST_TSO4, true) == 0 &&
+	    virtio_write_driver_feature_bit(vdev, VIRTIO_NET_F_HOST_TSO6, true) == 0) {
+		data->offload_caps |= ETHERNET_HW_TX_TSO;
+	}
+#endif
+
+#if defined(CONFIG_ETH_VIRTIO_NET_LRO)
+	if (virtio_read_device_feature_bit(vdev, VIRTIO_NET_F_GUEST_CSUM) &&
+	    virtio_read_device_feature_bit(vdev, VIRTIO_NET_F_GUEST_TSO4) &&
+	    virtio_read_device_feature_bit(vdev, VIRTIO_NET_F_GUEST_TSO6) &&
+	    virtio_write_driver_feature_bit(vdev, VIRTIO_NET_F_GUEST_CSUM, true) == 0 &&
+	    virtio_write_driver_feature_bit(vdev, VIRTIO_NET_F_GUEST_TSO4, true) == 0 &&
+	    virtio_write_driver_feature_bit(vdev, VIRTIO_NET_F_GUEST_TSO6, true) == 0) {
+		data->offload_caps |= ETHERNET_HW_RX_LRO;
+	}
+#endif
+
+	LOG_DBG("offloads: TSO %s, LRO %s",
+		(data->offload_caps & ETHERNET_HW_TX_TSO) ? "on" : "off",
+		(data->offload_caps & ETHERNET_HW_RX_LRO) ? "on" : "off");
+}
+
 static int virtnet_dev_init(const struct device *dev)
 {
 	const struct virtnet_config *config = dev->config;
@@ -216,6 +385,8 @@ static int virtnet_dev_init(const struct device *dev)
 	if (data->virtio_devcfg == NULL) {
 		LOG_ERR("could not get config struct");
 	}
+	virtnet_negotiate_offloads(dev);
+
 	if (virtio_commit_feature_bits(config->vdev)) {
 		LOG_ERR("could not commit feature bits");
 	}
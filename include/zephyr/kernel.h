@@ -1768,8 +1768,10 @@ struct k_timer {
 
 	/*
 	 * _timeout structure must be first here if we want to use
-	 * dynamic timer allocation. timeout.node is used in the double-linked
-	 * list of free timers
+	 * dynamic timer allocation. timeout.node is owned by the timeout
+	 * queue: a double-linked list node, or a red/black tree node with
+	 * CONFIG_TIMEOUT_QUEUE_SCALABLE. Only use it while the timer is not
+	 * active.
 	 */
 	struct _timeout timeout;
 
@@ -1958,6 +1960,25 @@ void k_timer_init(struct k_timer *timer,
 __syscall void k_timer_start(struct k_timer *timer,
 			     k_timeout_t duration, k_timeout_t period);
 
+/**
+ * @brief Start a timer that tolerates late expiry.
+ *
+ * Same as k_timer_start(), but each expiry of the timer may be delayed by
+ * up to @a slack.  The kernel uses this latitude to handle the expiry in
+ * the same system timer wakeup as other timeouts due around the same time,
+ * which reduces the number of wakeups in tickless idle.  Periodic timers
+ * do not drift: each period is still counted from the nominal expiry.
+ *
+ * The slack is ignored unless CONFIG_TIMEOUT_SLACK is enabled.
+ *
+ * @param timer     Address of timer.
+ * @param duration  Initial timer duration.
+ * @param period    Timer period.
+ * @param slack     Maximum delay of each expiry, a relative timeout.
+ */
+__syscall void k_timer_start_slack(struct k_timer *timer, k_timeout_t duration,
+				   k_timeout_t period, k_timeout_t slack);
+
 /**
  * @brief Stop a timer.
  *
@@ -4063,11 +4084,53 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *cfg);
 
+/** @brief Add a worker thread to a work queue.
+ *
+ * Creates an additional thread that processes items from @p queue alongside
+ * the thread started by k_work_queue_start() or k_work_queue_run(), so that
+ * independent work items can execute concurrently on SMP systems and a long
+ * running item does not hold up the rest of the queue.
+ *
+ * The guarantees of single worker queues are preserved: a work item is
+ * never run by more than one worker at a time, and flushing, cancelling,
+ * draining and stopping take all workers into account.  Items submitted to
+ * the queue may however complete in a different order than they were
+ * submitted.
+ *
+ * The worker uses the yield behavior of the queue and, if the queue thread
+ * is essential, is made essential as well.
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_MULTI_WORKER}
+ *
+ * @param queue pointer to a started work queue.
+ *
+ * @param thread pointer to the thread structure for the worker.
+ *
+ * @param stack pointer to the worker thread stack area.
+ *
+ * @param stack_size size of the worker thread stack area, in bytes.
+ *
+ * @param prio initial thread priority
+ *
+ * @param cpu_mask CPUs the worker may run on, or 0 to run on any CPU.  Has
+ * no effect unless CONFIG_SCHED_CPU_MASK is enabled.
+ *
+ * @retval 0 if the worker was added and started
+ * @retval -ENODEV if the queue is not started
+ * @retval -ENOMEM if the queue already has CONFIG_WORKQUEUE_MAX_WORKERS
+ * workers
+ */
+int k_work_queue_add_worker(struct k_work_q *queue, struct k_thread *thread,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int prio, uint32_t cpu_mask);
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
  * items it will process are expected to use.
  *
+ * Threads added with k_work_queue_add_worker() are not returned.
+ *
  * @param queue pointer to the queue structure.
  *
  * @return the thread associated with the work queue.
@@ -4131,6 +4194,34 @@ int k_work_queue_unplug(struct k_work_q *queue);
  */
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout);
 
+/** @brief Statistics of a work queue.
+ *
+ * Collected when CONFIG_OBJ_CORE_STATS_WORK_Q is enabled, and retrieved
+ * through the object core statistics API (k_obj_core_stats_raw() or
+ * k_obj_core_stats_query() on the queue's object core).  Times are in
+ * hardware cycles.  Resetting the statistics keeps the current depth.
+ *
+ * Without CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER times are measured with the
+ * 32-bit cycle counter, so a wait or handler run longer than 2^32 cycles
+ * is accounted modulo 2^32.
+ */
+struct k_work_q_stats {
+	/** Number of items currently waiting to be processed. */
+	uint32_t depth;
+	/** Largest number of items waiting to be processed at once. */
+	uint32_t max_depth;
+	/** Number of items processed. */
+	uint64_t completed;
+	/** Total time items waited in the queue before being processed. */
+	uint64_t wait_cycles;
+	/** Longest time an item waited in the queue. */
+	uint64_t max_wait_cycles;
+	/** Total time spent in work item handlers. */
+	uint64_t exec_cycles;
+	/** Longest time spent in a work item handler. */
+	uint64_t max_exec_cycles;
+};
+
 /** @brief Initialize a delayable work structure.
  *
  * This must be invoked before scheduling a delayable work structure for the
@@ -4272,6 +4363,51 @@ int k_work_schedule_for_queue(struct k_work_q *queue,
 int k_work_schedule(struct k_work_delayable *dwork,
 				   k_timeout_t delay);
 
+/** @brief Submit an idle work item to a queue after a delay, tolerating
+ * late submission.
+ *
+ * Same as k_work_schedule_for_queue(), but the submission may happen up to
+ * @p slack after @p delay has elapsed.  The kernel uses this latitude to
+ * handle the expiry in the same system timer wakeup as other timeouts due
+ * around the same time, which reduces the number of wakeups in tickless
+ * idle.
+ *
+ * The slack is ignored unless CONFIG_TIMEOUT_SLACK is enabled.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue the queue on which the work item should be submitted after the
+ * delay.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @param slack the maximum additional delay, a relative timeout.
+ *
+ * @return as with k_work_schedule_for_queue().
+ */
+int k_work_schedule_for_queue_slack(struct k_work_q *queue,
+				    struct k_work_delayable *dwork,
+				    k_timeout_t delay, k_timeout_t slack);
+
+/** @brief Submit an idle work item to the system work queue after a
+ * delay, tolerating late submission.
+ *
+ * This is a thin wrapper around k_work_schedule_for_queue_slack(), with all
+ * the API characteristics of that function.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @param slack the maximum additional delay, a relative timeout.
+ *
+ * @return as with k_work_schedule_for_queue().
+ */
+int k_work_schedule_slack(struct k_work_delayable *dwork, k_timeout_t delay,
+			  k_timeout_t slack);
+
 /** @brief Reschedule a work item to a queue after a delay.
  *
  * Unlike k_work_schedule_for_queue() this function can change the deadline of
@@ -4508,6 +4644,15 @@ struct k_work {
 	 * It can be RUNNING and CANCELING simultaneously.
 	 */
 	uint32_t flags;
+
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+	/* Cycle count when the item was added to the pending list. */
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+	uint64_t queued_cycles;
+#else
+	uint32_t queued_cycles;
+#endif /* CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER */
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
 };
 
 #define Z_WORK_INITIALIZER(work_handler) { \
@@ -4567,6 +4712,10 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	/* The item being flushed; the flusher must not run while it does. */
+	struct k_work *target;
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4646,6 +4795,14 @@ struct k_work_queue_config {
 	 * an error will be logged if CONFIG_LOG is enabled.
 	 */
 	uint32_t work_timeout_ms;
+
+	/** CPUs the work queue thread may run on.
+	 *
+	 * If non-zero, and CONFIG_SCHED_CPU_MASK is enabled, the work
+	 * queue thread is restricted to the CPUs whose bits are set.
+	 * Ignored by k_work_queue_run().
+	 */
+	uint32_t cpu_mask;
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4679,6 +4836,28 @@ struct k_work_q {
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_WORKQUEUE_MULTI_WORKER)
+	/* Threads added with k_work_queue_add_worker(). */
+	k_tid_t workers[CONFIG_WORKQUEUE_MAX_WORKERS - 1];
+
+	/* Number of entries in workers. */
+	uint8_t num_workers;
+
+	/* Number of workers currently running a work item. */
+	uint8_t num_busy;
+
+	/* Number of workers that have not exited after a stop request. */
+	uint8_t num_active;
+#endif /* defined(CONFIG_WORKQUEUE_MULTI_WORKER) */
+
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+	struct k_work_q_stats stats;
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+
+#ifdef CONFIG_OBJ_CORE_WORK_Q
+	struct k_obj_core obj_core;
+#endif /* CONFIG_OBJ_CORE_WORK_Q */
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -5111,6 +5290,8 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_PUT_CLAIM	BIT(1)
+#define K_MSGQ_FLAG_GET_CLAIM	BIT(2)
 
 /**
  * @brief Message Queue Attributes
@@ -5220,6 +5401,7 @@ int k_msgq_cleanup(struct k_msgq *msgq);
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY A put claim is outstanding, see k_msgq_put_claim().
  */
 __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 
@@ -5246,6 +5428,7 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  *
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EBUSY A put or get claim is outstanding.
  */
 __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data);
 
@@ -5268,9 +5451,71 @@ __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data);
  * @retval 0 Message received.
  * @retval -ENOMSG Returned without waiting or queue purged.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY A get claim is outstanding, see k_msgq_get_claim().
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send a batch of messages to the end of a message queue.
+ *
+ * This routine sends @a num_msgs messages stored back to back at @a data to
+ * message queue @a msgq, as if k_msgq_put() was called for each of them, but
+ * taking the message queue lock and rescheduling only once for all messages
+ * that fit in the queue. Messages are handed directly to threads waiting
+ * to receive first, the remaining ones are copied into the ring buffer.
+ *
+ * If the queue becomes full, the calling thread waits for space for the
+ * remaining messages, up to @a timeout for the whole batch.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to the array of messages.
+ * @param num_msgs Number of messages to send.
+ * @param timeout Waiting period to add all messages, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of messages sent, which is less than @a num_msgs if the
+ *         waiting period expired or the queue was purged.
+ * @retval -ENOMSG No message sent, returned without waiting or queue purged.
+ * @retval -EAGAIN No message sent, waiting period timed out.
+ * @retval -EBUSY A put claim is outstanding.
+ */
+__syscall int k_msgq_put_batch(struct k_msgq *msgq, const void *data,
+			       uint32_t num_msgs, k_timeout_t timeout);
+
+/**
+ * @brief Receive a batch of messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages from message queue
+ * @a msgq into the array at @a data, as if k_msgq_get() was called for each
+ * of them, but taking the message queue lock and rescheduling only once.
+ *
+ * The calling thread only waits if the queue is empty, up to @a timeout for
+ * the first message, and returns as soon as at least one message has been
+ * received.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold up to @a num_msgs received messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY A get claim is outstanding.
+ */
+__syscall int k_msgq_get_batch(struct k_msgq *msgq, void *data,
+			       uint32_t num_msgs, k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -5316,6 +5561,97 @@ __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
  */
 __syscall void k_msgq_purge(struct k_msgq *msgq);
 
+/**
+ * @brief Claim space for a message at the end of a message queue.
+ *
+ * This routine hands out a pointer to the slot of the message queue buffer
+ * the next message will be stored in, so that the message can be built in
+ * place instead of being copied in by k_msgq_put(). The message is only
+ * made available to receivers by k_msgq_put_commit().
+ *
+ * Only one put claim may be outstanding on a message queue. Until it is
+ * committed, all other attempts to send a message to the queue fail with
+ * -EBUSY.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Not available to user mode threads, the queue buffer is kernel
+ * memory.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Set to the address of the claimed message slot.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot claimed.
+ * @retval -EBUSY Another put claim is outstanding.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_put_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Send the message built in a claimed slot.
+ *
+ * This routine adds the message built in the slot claimed with
+ * k_msgq_put_claim() to the end of the queue, or hands it to a thread
+ * waiting to receive a message.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL No put claim is outstanding.
+ */
+int k_msgq_put_commit(struct k_msgq *msgq);
+
+/**
+ * @brief Claim the first message of a message queue.
+ *
+ * This routine hands out a pointer to the first message in the message
+ * queue buffer, so that it can be processed in place instead of being
+ * copied out by k_msgq_get(). The message keeps its slot until it is
+ * released with k_msgq_get_commit().
+ *
+ * Only one get claim may be outstanding on a message queue. Until it is
+ * committed, all other attempts to receive a message from the queue fail
+ * with -EBUSY. Purging the queue discards the claimed message.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Not available to user mode threads, the queue buffer is kernel
+ * memory.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Set to the address of the claimed message.
+ * @param timeout Waiting period for a message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -EBUSY Another get claim is outstanding.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_get_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Release a claimed message.
+ *
+ * This routine removes the message claimed with k_msgq_get_claim() from the
+ * queue, making its slot available to senders.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message released.
+ * @retval -EINVAL No get claim is outstanding, or the queue was purged.
+ */
+int k_msgq_get_commit(struct k_msgq *msgq);
+
 /**
  * @brief Get the amount of free space in a message queue.
  *
@@ -5539,6 +5875,8 @@ __syscall void k_pipe_init(struct k_pipe *pipe, uint8_t *buffer, size_t buffer_s
 enum pipe_flags {
 	PIPE_FLAG_OPEN = BIT(0),
 	PIPE_FLAG_RESET = BIT(1),
+	PIPE_FLAG_WRITE_CLAIM = BIT(2),
+	PIPE_FLAG_READ_CLAIM = BIT(3),
 };
 
 struct k_pipe {
@@ -5548,6 +5886,9 @@ struct k_pipe {
 	_wait_q_t data;
 	_wait_q_t space;
 	uint8_t flags;
+#ifdef CONFIG_PIPE_FAST_PATH
+	atomic_t fast;
+#endif
 
 	Z_DECL_POLL_EVENT
 #ifdef CONFIG_OBJ_CORE_PIPE
@@ -5607,6 +5948,7 @@ struct k_pipe {
  * @retval -EAGAIN if no data could be written before the timeout expired
  * @retval -ECANCELED if the write was interrupted by k_pipe_reset(..)
  * @retval -EPIPE if the pipe was closed
+ * @retval -EBUSY if a write claim is outstanding, see k_pipe_write_claim()
  */
 __syscall int k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len,
 			   k_timeout_t timeout);
@@ -5625,6 +5967,7 @@ __syscall int k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len,
  * @retval -EAGAIN if no data could be read before the timeout expired
  * @retval -ECANCELED if the read was interrupted by k_pipe_reset(..)
  * @retval -EPIPE if the pipe was closed
+ * @retval -EBUSY if a read claim is outstanding, see k_pipe_read_claim()
  */
 __syscall int k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len,
 			  k_timeout_t timeout);
@@ -5649,6 +5992,94 @@ __syscall void k_pipe_reset(struct k_pipe *pipe);
  * @param pipe Address of the pipe.
  */
 __syscall void k_pipe_close(struct k_pipe *pipe);
+
+/**
+ * @brief Claim space in a pipe for writing data in place
+ *
+ * This routine hands out a pointer to contiguous free space in the pipe's
+ * ring buffer, so that data can be produced in place instead of being
+ * copied in by k_pipe_write(). The data is only made available to readers
+ * by k_pipe_write_commit(). If the pipe is full, the routine blocks until
+ * space is available or the timeout expires.
+ *
+ * Only one write claim may be outstanding on a pipe. Until it is committed,
+ * k_pipe_write() and further write claims fail with -EBUSY. Resetting or
+ * closing the pipe cancels the claim.
+ *
+ * @note Not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed space.
+ * @param len Requested number of bytes.
+ * @param timeout Waiting period to wait for space.
+ *
+ * @retval number of contiguous bytes claimed, at most @a len
+ * @retval -EBUSY if another write claim is outstanding
+ * @retval -ENOTSUP if the pipe has no ring buffer
+ * @retval -EAGAIN if no space was available before the timeout expired
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ */
+int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+		       k_timeout_t timeout);
+
+/**
+ * @brief Commit data written in place to a pipe
+ *
+ * This routine makes the first @a len bytes of the space claimed with
+ * k_pipe_write_claim() available to readers and releases the claim.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes written, at most the number of bytes claimed.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no write claim is outstanding or @a len is too large
+ */
+int k_pipe_write_commit(struct k_pipe *pipe, size_t len);
+
+/**
+ * @brief Claim data in a pipe for reading it in place
+ *
+ * This routine hands out a pointer to contiguous data in the pipe's ring
+ * buffer, so that it can be consumed in place instead of being copied out
+ * by k_pipe_read(). The space is only released to writers by
+ * k_pipe_read_commit(). If the pipe is empty, the routine blocks until data
+ * is available or the timeout expires.
+ *
+ * Only one read claim may be outstanding on a pipe. Until it is committed,
+ * k_pipe_read() and further read claims fail with -EBUSY. Resetting or
+ * closing the pipe cancels the claim.
+ *
+ * @note Not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the address of the claimed data.
+ * @param len Maximum number of bytes to claim.
+ * @param timeout Waiting period to wait for data.
+ *
+ * @retval number of contiguous bytes claimed, at most @a len
+ * @retval -EBUSY if another read claim is outstanding
+ * @retval -ENOTSUP if the pipe has no ring buffer
+ * @retval -EAGAIN if no data was available before the timeout expired
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ */
+int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+		      k_timeout_t timeout);
+
+/**
+ * @brief Release data read in place from a pipe
+ *
+ * This routine releases the first @a len bytes of the data claimed with
+ * k_pipe_read_claim() to writers and releases the claim.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes consumed, at most the number of bytes claimed.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no read claim is outstanding or @a len is too large
+ */
+int k_pipe_read_commit(struct k_pipe *pipe, size_t len);
 /** @} */
 
 /**
@@ -5963,10 +6394,32 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_K_HEAP_CACHE
+/* Number of power-of-two size classes cached, starting at 16 bytes */
+#define Z_HEAP_CACHE_NUM_BINS (LOG2CEIL(CONFIG_K_HEAP_CACHE_MAX_SIZE) - 3)
+
+/* Per-CPU cache of free small blocks, see k_heap_alloc() */
+struct z_heap_cache {
+	struct k_spinlock lock;
+	sys_slist_t bins[Z_HEAP_CACHE_NUM_BINS];
+	uint16_t count[Z_HEAP_CACHE_NUM_BINS];
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t refills;
+	uint32_t drains;
+	size_t cached_bytes;
+#endif
+};
+#endif /* CONFIG_K_HEAP_CACHE */
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_K_HEAP_CACHE
+	struct z_heap_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 };
 
 /**
@@ -6095,6 +6548,51 @@ void *k_heap_realloc(struct k_heap *h, void *ptr, size_t bytes, k_timeout_t time
  */
 void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
+/**
+ * @brief k_heap small block cache statistics
+ *
+ * Blocks held by the per-CPU caches are accounted as allocated by the
+ * underlying sys_heap statistics.
+ */
+struct k_heap_cache_stats {
+	/** Allocations served from a per-CPU cache */
+	uint32_t hits;
+	/** Cacheable allocations that had to refill a per-CPU cache */
+	uint32_t misses;
+	/** Batches of blocks moved from the heap to a per-CPU cache */
+	uint32_t refills;
+	/** Batches of blocks moved from a per-CPU cache back to the heap */
+	uint32_t drains;
+	/** Bytes of free blocks currently held by the per-CPU caches */
+	size_t cached_bytes;
+};
+
+/**
+ * @brief Get the small block cache statistics of a k_heap
+ *
+ * Sums up the statistics of the per-CPU caches of the heap, see
+ * @kconfig{CONFIG_K_HEAP_CACHE}. Requires
+ * @kconfig{CONFIG_SYS_HEAP_RUNTIME_STATS}.
+ *
+ * @param h Heap to query
+ * @param stats Structure to fill
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Invalid argument
+ */
+int k_heap_cache_stats_get(struct k_heap *h, struct k_heap_cache_stats *stats);
+
+/**
+ * @brief Return the blocks held by the small block caches to a k_heap
+ *
+ * Moves all the free blocks held by the per-CPU caches of the heap back
+ * into the heap, making the memory available to allocations of any size.
+ * This is done automatically before an allocation blocks or fails.
+ *
+ * @param h Heap to flush
+ */
+void k_heap_cache_flush(struct k_heap *h) __attribute_nonnull(1);
+
 /* Minimum heap sizes needed to return a successful 1-byte allocation.
  * Assumes a chunk aligned (8 byte) memory buffer.
  */
@@ -300,7 +300,11 @@ struct _timeout;
 typedef void (*_timeout_func_t)(struct _timeout *t);
 
 struct _timeout {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	struct rbnode node;
+#else
 	sys_dnode_t node;
+#endif
 	_timeout_func_t fn;
 #ifdef CONFIG_TIMEOUT_64BIT
 	/* Can't use k_ticks_t for header dependency reasons */
@@ -308,6 +312,14 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	/* Tie breaker between timeouts expiring on the same tick */
+	uint32_t order_key;
+#endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks the expiry may be delayed to share a wakeup */
+	uint32_t slack;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Header file for the file system log backend API
+ * @ingroup log_backend_fs
+ */
+
+#ifndef ZEPHYR_LOG_BACKEND_FS_H_
+#define ZEPHYR_LOG_BACKEND_FS_H_
+
+/**
+ * @brief File system log backend API
+ * @defgroup log_backend_fs File system log backend API
+ * @ingroup log_backend
+ * @{
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Magic value at the start of every log block. */
+#define LOG_BACKEND_FS_BLOCK_MAGIC 0x424c
+
+/** Version of the log block format. */
+#define LOG_BACKEND_FS_BLOCK_VERSION 1
+
+/** Block payload is compressed. */
+#define LOG_BACKEND_FS_BLOCK_FLAG_COMPRESSED BIT(0)
+
+/**
+ * @brief Header of a log block.
+ *
+ * When @kconfig{CONFIG_LOG_BACKEND_FS_BLOCKS} is enabled, log files consist of
+ * blocks of @kconfig{CONFIG_LOG_BACKEND_FS_BLOCK_SIZE} bytes. Each block starts
+ * with this header, followed by @p len bytes of payload. The rest of the block
+ * is padding. Once decompressed, the payload holds @p msg_cnt complete
+ * dictionary-based log messages, so parsing can start at any block.
+ *
+ * The payload is compressed when @ref LOG_BACKEND_FS_BLOCK_FLAG_COMPRESSED is
+ * set. The compressed data is a sequence of tokens, each starting with a
+ * control byte:
+ *
+ * - 0x00-0x7f: literal run, followed by (control + 1) bytes copied as is.
+ * - 0x80-0xff: match of ((control & 0x7f) + 4) bytes copied from earlier
+ *   output, followed by the distance minus one as a 16-bit little endian value.
+ *
+ * All fields are little endian.
+ */
+struct log_backend_fs_block_hdr {
+	/** @ref LOG_BACKEND_FS_BLOCK_MAGIC */
+	uint16_t magic;
+	/** @ref LOG_BACKEND_FS_BLOCK_VERSION */
+	uint8_t version;
+	/** Block flags. */
+	uint8_t flags;
+	/** Size of the block, including the header. */
+	uint16_t block_size;
+	/** Length of the payload stored in the block. */
+	uint16_t len;
+	/** Length of the payload after decompression. */
+	uint16_t raw_len;
+	/** Number of log messages in the block. */
+	uint16_t msg_cnt;
+	/** Block sequence number, counted since boot. */
+	uint32_t seq;
+	/** Timestamp of the first message in the block. */
+	uint64_t ts_first;
+	/** Timestamp of the last message in the block. */
+	uint64_t ts_last;
+} __packed;
+
+/**
+ * @brief Write messages collected in RAM to the file system.
+ *
+ * The partially filled block is padded and written. The function must not be
+ * called from the context of a log backend. The backend also writes the
+ * collected messages when the logging subsystem enters panic mode.
+ *
+ * @retval 0 on success or when there was nothing to write.
+ * @retval -ENOTSUP if block based storage is not enabled.
+ * @retval -EIO if the backend is not operational.
+ */
+int log_backend_fs_block_flush(void);
+
+/**
+ * @brief Find the first stored log block containing messages logged at or after a timestamp.
+ *
+ * Blocks are located using the block headers only: one header is read per
+ * log file and the file is then bisected. The returned file can be read from
+ * @p offset (e.g. downloaded with the mcumgr file system group) and parsed by
+ * the host side dictionary log parser. The lookup is available to a host
+ * through the ``log fs_find`` shell command, other transports must call this
+ * function from the application.
+ *
+ * Timestamps restart at every boot, so only the log files written since boot
+ * are searched.
+ *
+ * @param timestamp Timestamp, in log timestamp units.
+ * @param path      Buffer for the path of the log file.
+ * @param path_len  Size of @p path.
+ * @param offset    Offset of the block in the file.
+ *
+ * @retval 0 on success.
+ * @retval -ENOENT if no stored message was logged at or after @p timestamp.
+ * @retval -ENOTSUP if block based storage is not enabled.
+ * @retval -EINVAL if @p path is too small.
+ * @retval -EIO if reading a log file failed.
+ */
+int log_backend_fs_block_find(uint64_t timestamp, char *path, size_t path_len, off_t *offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* ZEPHYR_LOG_BACKEND_FS_H_ */
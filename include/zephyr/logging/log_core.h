@@ -201,6 +201,22 @@ extern "C" {
 	 Z_LOG_STATIC_INST_LEVEL_CHECK(_level, _inst, _source) &&                                  \
 	 Z_LOG_DYNAMIC_LEVEL_CHECK(_level, _source))
 
+/** @internal
+ * @brief Check message against the rate limit and deduplication stage.
+ *
+ * @param level  Severity level.
+ * @param source Dynamic data associated with the source.
+ * @param fmt    Format string, NULL to skip deduplication.
+ *
+ * @retval true Continue with log message creation.
+ * @retval false Drop that message.
+ */
+bool z_log_source_ratelimit_check(uint8_t level, void *source, const char *fmt);
+
+#define Z_LOG_SOURCE_RATELIMIT_CHECK(_level, _source, _fmt)                                        \
+	(!IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT) ||                                               \
+	 z_log_source_ratelimit_check(_level, (void *)(_source), _fmt))
+
 /** @brief Get current module data that is used for source id retrieving.
  *
  * If runtime filtering is used then pointer to dynamic data is returned and else constant
@@ -298,6 +314,9 @@ static inline char z_log_minimal_level_to_char(int level)
 			Z_LOG_TO_PRINTK(_level, __VA_ARGS__);                                      \
 			break;                                                                     \
 		}                                                                                  \
+		if (!Z_LOG_SOURCE_RATELIMIT_CHECK(_level, _source, GET_ARG_N(1, __VA_ARGS__))) {   \
+			break;                                                                     \
+		}                                                                                  \
 		int _mode;                                                                         \
 		bool string_ok;                                                                    \
 		LOG_POINTERS_VALIDATE(string_ok, __VA_ARGS__);                                     \
@@ -355,6 +374,9 @@ static inline char z_log_minimal_level_to_char(int level)
 			z_log_minimal_hexdump_print((_level), (const char *)(_data), (_len));      \
 			break;                                                                     \
 		}                                                                                  \
+		if (!Z_LOG_SOURCE_RATELIMIT_CHECK(_level, _source, NULL)) {                        \
+			break;                                                                     \
+		}                                                                                  \
 		int _mode;                                                                         \
 		Z_LOG_MSG_CREATE(UTIL_NOT(IS_ENABLED(CONFIG_USERSPACE)), _mode,                    \
 				 Z_LOG_LOCAL_DOMAIN_ID, _source, _level, _data, _len,              \
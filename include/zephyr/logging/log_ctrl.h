@@ -295,6 +295,51 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage);
  */
 int log_mem_get_max_usage(uint32_t *max);
 
+/** @brief Rate limiting and deduplication settings. */
+struct log_source_ratelimit_config {
+	/** Messages per second allowed from one source, 0 disables rate limiting. */
+	uint32_t rate;
+	/** Number of messages a source can log back to back. */
+	uint32_t burst;
+	/** Collapse repetitions of the same message. */
+	bool dedup;
+};
+
+/** @brief Rate limiting and deduplication statistics. */
+struct log_source_ratelimit_stats {
+	/** Messages dropped by the rate limit. */
+	uint32_t suppressed;
+	/** Repeated messages dropped by deduplication. */
+	uint32_t repeated;
+};
+
+/**
+ * @brief Set rate limiting and deduplication settings.
+ *
+ * Requires CONFIG_LOG_SOURCE_RATELIMIT option. Settings apply to all sources.
+ *
+ * @param config Settings.
+ *
+ * @retval 0 on successful operation.
+ * @retval -ENOTSUP if feature is disabled.
+ * @retval -EINVAL if burst is out of range or deduplication is not supported.
+ */
+int log_source_ratelimit_set(const struct log_source_ratelimit_config *config);
+
+/**
+ * @brief Get rate limiting and deduplication settings and statistics.
+ *
+ * Requires CONFIG_LOG_SOURCE_RATELIMIT option.
+ *
+ * @param[out] config Current settings.
+ * @param[out] stats Number of messages dropped since boot. Can be NULL.
+ *
+ * @retval 0 on successful operation.
+ * @retval -ENOTSUP if feature is disabled.
+ */
+int log_source_ratelimit_get(struct log_source_ratelimit_config *config,
+			      struct log_source_ratelimit_stats *stats);
+
 #if defined(CONFIG_LOG) && !defined(CONFIG_LOG_MODE_MINIMAL)
 #define LOG_CORE_INIT() log_core_init()
 #define LOG_PANIC() log_panic()
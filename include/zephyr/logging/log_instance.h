@@ -7,6 +7,7 @@
 #define ZEPHYR_INCLUDE_LOGGING_LOG_INSTANCE_H_
 
 #include <zephyr/types.h>
+#include <zephyr/spinlock.h>
 #include <zephyr/sys/iterable_sections.h>
 
 #ifdef __cplusplus
@@ -19,6 +20,28 @@ struct log_source_const_data {
 	uint8_t level;
 };
 
+/** @brief Rate limiting and deduplication state of the source of log messages. */
+struct log_source_ratelimit_state {
+	/** Protects the state, sources are limited independently. */
+	struct k_spinlock lock;
+	/** Format string of the last message let through. */
+	const char *fmt;
+	/** Uptime (ms) of the last token bucket refill. */
+	uint32_t refill_time;
+	/** Uptime (ms) at which the last message was let through. */
+	uint32_t repeat_time;
+	/** Tokens taken from the bucket. */
+	uint16_t used;
+	/** Refill credit carried over to the next refill, in 1/1000 of a token. */
+	uint16_t refill_frac;
+	/** Number of repetitions of the last message dropped. */
+	uint16_t repeated;
+	/** Number of messages dropped by the rate limit. */
+	uint16_t suppressed;
+	/** Level of the last message let through. */
+	uint8_t level;
+};
+
 /** @brief Dynamic data associated with the source of log messages. */
 struct log_source_dynamic_data {
 	uint32_t filters;
@@ -26,6 +49,9 @@ struct log_source_dynamic_data {
 	/* Workaround: Ensure that structure size is a multiple of 8 bytes. */
 	uint32_t dummy_64;
 #endif
+#if defined(CONFIG_LOG_SOURCE_RATELIMIT)
+	struct log_source_ratelimit_state ratelimit;
+#endif
 };
 
 /** @internal
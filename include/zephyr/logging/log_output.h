@@ -90,6 +90,9 @@ struct log_output_control_block {
 	atomic_t offset;
 	void *ctx;
 	const char *hostname;
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+	atomic_t dict_seq;
+#endif
 };
 
 /** @brief Log_output instance structure. */
@@ -23,6 +23,8 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+	MSG_NORMAL_COMPACT = 2,
+	MSG_DROPPED_MSG_COMPACT = 3,
 };
 
 /**
@@ -47,6 +49,34 @@ struct log_dict_output_dropped_msg_t {
 	uint16_t num_dropped_messages;
 } __packed;
 
+/*
+ * With CONFIG_LOG_DICTIONARY_COMPACT, messages are output as MSG_NORMAL_COMPACT
+ * and MSG_DROPPED_MSG_COMPACT records instead. All multi-byte integers in them
+ * are unsigned LEB128 varints:
+ *
+ * MSG_NORMAL_COMPACT:
+ *   uint8_t type;
+ *   uint8_t level << 4 | domain;
+ *   varint  sequence number;
+ *   varint  source;
+ *   varint  timestamp;
+ *   varint  package_len;
+ *   varint  data_len;
+ *   varint  one per 32-bit word of the package header and arguments;
+ *   uint8_t remaining package bytes (string indexes and appended strings);
+ *   uint8_t data[data_len];
+ *
+ * MSG_DROPPED_MSG_COMPACT:
+ *   uint8_t type;
+ *   varint  sequence number;
+ *   varint  number of dropped messages;
+ *
+ * Sequence numbers are per log output instance and incremented for every
+ * record, so a gap tells the host that records were lost in transport, as
+ * opposed to dropped on the target. Records have no sync marker, loss is
+ * only detected when whole records are lost, e.g. datagrams.
+ */
+
 /** @brief Process log messages v2 for dictionary-based logging.
  *
  * Function is using provided context with the buffer and output function to
@@ -207,6 +207,14 @@ enum ethernet_hw_caps {
 
 	/** TX-Injection supported */
 	ETHERNET_TXINJECTION_MODE	= BIT(20),
+
+	/** TCP segmentation offload (TSO) supported for IPv4 and IPv6 */
+	ETHERNET_HW_TX_TSO		= BIT(21),
+
+	/** Large receive offload (LRO), received TCP segments can be larger
+	 *  than the MTU
+	 */
+	ETHERNET_HW_RX_LRO		= BIT(22),
 };
 
 /** @cond INTERNAL_HIDDEN */
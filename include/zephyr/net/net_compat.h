@@ -111,6 +111,7 @@ extern "C" {
 
 #define iovec                     net_iovec
 #define msghdr                    net_msghdr
+#define mmsghdr                   net_mmsghdr
 #define cmsghdr                   net_cmsghdr
 #define ALIGN_H(x)                NET_ALIGN_H(x)
 #define ALIGN_D(x)                NET_ALIGN_D(x)
@@ -242,11 +243,13 @@ extern "C" {
 #define MSG_TRUNC    ZSOCK_MSG_TRUNC
 #define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
 #define MSG_WAITALL  ZSOCK_MSG_WAITALL
+#define MSG_WAITFORONE ZSOCK_MSG_WAITFORONE
 
 #define TCP_NODELAY    ZSOCK_TCP_NODELAY
 #define TCP_KEEPIDLE   ZSOCK_TCP_KEEPIDLE
 #define TCP_KEEPINTVL  ZSOCK_TCP_KEEPINTVL
 #define TCP_KEEPCNT    ZSOCK_TCP_KEEPCNT
+#define TCP_CONGESTION ZSOCK_TCP_CONGESTION
 
 #define IP_TOS               ZSOCK_IP_TOS
 #define IP_TTL               ZSOCK_IP_TTL
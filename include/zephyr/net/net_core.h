@@ -193,6 +193,18 @@ static inline int net_send_data(struct net_pkt *pkt)
 #define NET_TC_RX_EFFECTIVE_COUNT NET_TC_RX_COUNT
 #endif
 
+#if defined(CONFIG_NET_TC_TX_QUEUES)
+#define NET_TC_TX_QUEUES CONFIG_NET_TC_TX_QUEUES
+#else
+#define NET_TC_TX_QUEUES 1
+#endif
+
+#if defined(CONFIG_NET_TC_RX_QUEUES)
+#define NET_TC_RX_QUEUES CONFIG_NET_TC_RX_QUEUES
+#else
+#define NET_TC_RX_QUEUES 1
+#endif
+
 /**
  * @brief Registration information for a given L3 handler. Note that
  *        the layer number (L3) just refers to something that is on top
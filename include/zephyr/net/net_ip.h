@@ -261,6 +261,17 @@ struct net_msghdr {
 	int               msg_flags;      /**< Flags on received message */
 };
 
+/** Message struct for batched I/O with zsock_sendmmsg() and zsock_recvmmsg() */
+struct net_mmsghdr {
+	struct net_msghdr msg_hdr; /**< Message */
+	unsigned int      msg_len; /**< Number of bytes transferred for the message */
+};
+
+/** Maximum number of messages handled by one zsock_sendmmsg() or zsock_recvmmsg() call,
+ * as the UIO_MAXIOV limit of Linux. Larger batches are cut to this length.
+ */
+#define NET_MMSG_VLEN_MAX 1024
+
 /** Control message ancillary data */
 struct net_cmsghdr {
 	net_socklen_t cmsg_len;    /**< Number of bytes, including header */
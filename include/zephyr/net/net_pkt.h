@@ -317,6 +317,20 @@ struct net_pkt {
 	uint16_t vlan_tci;
 #endif /* CONFIG_NET_VLAN */
 
+#if defined(CONFIG_NET_TCP_GSO)
+	/* Size of the segments a large TCP packet must be split into
+	 * before it reaches the wire, 0 if it must be sent as is.
+	 */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_TCP_GSO */
+
+#if defined(CONFIG_NET_PKT_FLOW_HASH)
+	/* Hash of the flow (addresses, ports and protocol) of the packet,
+	 * either reported by the device or computed by the stack.
+	 */
+	uint32_t flow_hash;
+#endif /* CONFIG_NET_PKT_FLOW_HASH */
+
 #if defined(CONFIG_NET_PKT_CONTROL_BLOCK)
 	/* Control block which could be used by any layer */
 	union {
@@ -361,6 +375,11 @@ struct net_pkt {
 	uint8_t ipv4_pmtu : 1;
 #endif /* CONFIG_NET_IPV4_PMTU */
 
+#if defined(CONFIG_NET_PKT_FLOW_HASH)
+	/* Is the flow_hash field valid? */
+	uint8_t flow_hash_valid : 1;
+#endif /* CONFIG_NET_PKT_FLOW_HASH */
+
 	/* @endcond */
 };
 
@@ -1184,6 +1203,69 @@ static inline void net_pkt_set_vlan_tci(struct net_pkt *pkt, uint16_t tci)
 }
 #endif
 
+#if defined(CONFIG_NET_TCP_GSO)
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	return pkt->gso_size;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t gso_size)
+{
+	pkt->gso_size = gso_size;
+}
+#else
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t gso_size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(gso_size);
+}
+#endif
+
+#if defined(CONFIG_NET_PKT_FLOW_HASH)
+static inline bool net_pkt_has_flow_hash(struct net_pkt *pkt)
+{
+	return !!(pkt->flow_hash_valid);
+}
+
+static inline uint32_t net_pkt_flow_hash(struct net_pkt *pkt)
+{
+	return pkt->flow_hash;
+}
+
+static inline void net_pkt_set_flow_hash(struct net_pkt *pkt, uint32_t hash)
+{
+	pkt->flow_hash = hash;
+	pkt->flow_hash_valid = 1;
+}
+#else
+static inline bool net_pkt_has_flow_hash(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline uint32_t net_pkt_flow_hash(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_flow_hash(struct net_pkt *pkt, uint32_t hash)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(hash);
+}
+#endif
+
 #if defined(CONFIG_NET_PKT_TIMESTAMP) || defined(CONFIG_NET_PKT_TXTIME)
 static inline struct net_ptp_time *net_pkt_timestamp(struct net_pkt *pkt)
 {
@@ -1502,6 +1584,12 @@ static inline bool net_pkt_is_being_overwritten(struct net_pkt *pkt)
 bool net_pkt_filter_send_ok(struct net_pkt *pkt);
 bool net_pkt_filter_recv_ok(struct net_pkt *pkt);
 
+/* Run the receive rules on a packet. Returns NET_CONTINUE if the packet
+ * should be passed on to the stack, NET_DROP if it must be dropped, or
+ * NET_OK if it has been redirected and is no longer owned by the caller.
+ */
+enum net_verdict net_pkt_filter_recv(struct net_pkt *pkt);
+
 #else
 
 static inline bool net_pkt_filter_send_ok(struct net_pkt *pkt)
@@ -1518,6 +1606,13 @@ static inline bool net_pkt_filter_recv_ok(struct net_pkt *pkt)
 	return true;
 }
 
+static inline enum net_verdict net_pkt_filter_recv(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return NET_CONTINUE;
+}
+
 #endif /* CONFIG_NET_PKT_FILTER */
 
 #if defined(CONFIG_NET_PKT_FILTER) && \
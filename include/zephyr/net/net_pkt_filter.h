@@ -89,6 +89,9 @@ struct npf_rule {
 	sys_snode_t node;           /**< Slist rule list node */
 	enum net_verdict result;    /**< result if all tests pass */
 	enum net_priority priority; /**< priority in case of NET_CONTINUE */
+#if defined(CONFIG_NET_PKT_FILTER_REDIRECT)
+	struct k_fifo *redirect;    /**< FIFO receiving the packet in case of NET_OK */
+#endif
 	uint32_t nb_tests;          /**< number of tests for this rule */
 	struct npf_test *tests[];   /**< pointers to @ref npf_test instances */
 };
@@ -252,6 +255,46 @@ bool npf_remove_all_rules(struct npf_rule_list *rules);
 		.tests = {FOR_EACH(Z_NPF_TEST_ADDR, (,), __VA_ARGS__)},	\
 	}
 
+/**
+ * @brief Statically define one packet filter redirect rule
+ *
+ * Packets of the receive rule list for which all conditions are true are
+ * put on the given k_fifo instead of being passed to the network stack.
+ * The receiver of the FIFO owns the packets and must unref them. This
+ * happens in the context of net_recv_data(), before the packet is queued
+ * to a traffic class, so the receiver can handle the packets from its own
+ * thread. Redirect rules behave like <tt>NET_OK</tt> rules in the other
+ * rule lists. Requires @kconfig{CONFIG_NET_PKT_FILTER_REDIRECT}.
+ *
+ * Example:
+ *
+ * @code{.c}
+ *
+ *     static K_FIFO_DEFINE(mcast_fifo);
+ *     static NPF_ETH_DST_ADDR_MASK_MATCH(mcast, mcast_addrs, mcast_masks);
+ *
+ *     static NPF_REDIRECT(steer_mcast, &mcast_fifo, mcast);
+ *
+ *     void install_my_filter(void)
+ *     {
+ *         npf_insert_recv_rule(&steer_mcast);
+ *         npf_append_recv_rule(&npf_default_ok);
+ *     }
+ *
+ * @endcode
+ *
+ * @param _name Name for this rule.
+ * @param _fifo Pointer to the k_fifo receiving the matching packets.
+ * @param ... List of conditions for this rule.
+ */
+#define NPF_REDIRECT(_name, _fifo, ...)					\
+	struct npf_rule _name = {					\
+		.result = NET_OK,					\
+		.redirect = (_fifo),					\
+		.nb_tests = NUM_VA_ARGS_LESS_1(__VA_ARGS__) + 1,	\
+		.tests = {FOR_EACH(Z_NPF_TEST_ADDR, (,), __VA_ARGS__)},	\
+	}
+
 #define Z_NPF_TEST_ADDR(arg) &arg.test
 
 /** @} */
@@ -390,6 +390,10 @@ struct net_stats_pkt_filter {
 #if defined(CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK)
 		/** Packets dropped at connection input */
 		net_stats_t local_drop;
+#endif
+#if defined(CONFIG_NET_PKT_FILTER_REDIRECT)
+		/** Network packets redirected at network interface level */
+		net_stats_t redirect;
 #endif
 	} rx;
 
@@ -1441,6 +1445,15 @@ NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_RESET_WIFI);
 		NET_STATS_GET_VAR(dev_id, sfx, pkt_filter_rx_local_drop),\
 		&(iface)->stats.pkt_filter.rx.local_drop);
 
+#define NET_STATS_PROMETHEUS_PKT_FILTER_REDIRECT(iface, dev_id, sfx)	\
+	NET_STATS_PROMETHEUS_COUNTER_DEFINE(				\
+		"Packet filter RX redirect",				\
+		NET_STATS_GET_INSTANCE(dev_id, sfx, pkt_filter_rx_redirect), \
+		"packet_count",						\
+		NET_STATS_GET_COLLECTOR_NAME(dev_id, sfx),		\
+		NET_STATS_GET_VAR(dev_id, sfx, pkt_filter_rx_redirect),\
+		&(iface)->stats.pkt_filter.rx.redirect);
+
 #define NET_STATS_PROMETHEUS_PKT_FILTER(iface, dev_id, sfx)		\
 	NET_STATS_PROMETHEUS_COUNTER_DEFINE(				\
 		"Packet filter RX drop",				\
@@ -1461,7 +1474,9 @@ NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_RESET_WIFI);
 	IF_ENABLED(CONFIG_NET_PKT_FILTER_IPV6_HOOK,			\
 		   (NET_STATS_PROMETHEUS_PKT_FILTER_IPV6(iface, dev_id, sfx))) \
 	IF_ENABLED(CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK,			\
-		   (NET_STATS_PROMETHEUS_PKT_FILTER_LOCAL(iface, dev_id, sfx)))
+		   (NET_STATS_PROMETHEUS_PKT_FILTER_LOCAL(iface, dev_id, sfx))) \
+	IF_ENABLED(CONFIG_NET_PKT_FILTER_REDIRECT,			\
+		   (NET_STATS_PROMETHEUS_PKT_FILTER_REDIRECT(iface, dev_id, sfx)))
 
 /* Per network interface statistics via Prometheus */
 #define NET_STATS_PROMETHEUS(iface, dev_id, sfx)			\
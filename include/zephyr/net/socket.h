@@ -33,6 +33,7 @@
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/socket_select.h>
 #include <zephyr/net/socket_poll.h>
+#include <zephyr/net/socket_epoll.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/fdtable.h>
 #include <zephyr/net/dns_resolve.h>
@@ -78,6 +79,8 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: Override operation to non-blocking once a message was received */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 /** @} */
 
 /**
@@ -512,6 +515,39 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct net_msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send multiple messages with a single call
+ *
+ * @details
+ * Equivalent to calling zsock_sendmsg() for each of the @p vlen messages of
+ * @p msgvec, but the messages are sent in a single system call, which saves
+ * the per call overhead when sending bursts of datagrams. The number of
+ * bytes sent for each message is stored in its @c msg_len field.
+ *
+ * With ZSOCK_MSG_DONTWAIT the whole batch is sent with the socket lock held,
+ * so messages sent by other threads on the same socket are not interleaved
+ * with it. Otherwise the lock is only held for each message, as a blocking
+ * send must be able to release it while waiting for buffers, and other
+ * threads may send in between.
+ *
+ * Sending stops at the first message that fails. The error is only reported
+ * if no message could be sent at all, otherwise the number of messages sent
+ * so far is returned. At most @ref NET_MMSG_VLEN_MAX messages are sent.
+ *
+ * See Linux man 2 sendmmsg for the reference of this extension.
+ * This function is also exposed as `sendmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket to send to
+ * @param msgvec Array of messages
+ * @param vlen Number of messages in @p msgvec
+ * @param flags Flags applied to each message, see zsock_sendmsg()
+ *
+ * @return Number of messages sent, or -1 with errno set on error.
+ */
+__syscall int zsock_sendmmsg(int sock, struct net_mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -538,6 +574,44 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct net_msghdr *msg, int flags);
 
+/**
+ * @brief Receive multiple messages with a single call
+ *
+ * @details
+ * Equivalent to calling zsock_recvmsg() for each of the @p vlen messages of
+ * @p msgvec, but the messages are received in a single system call with the
+ * socket lock held, which saves the per call overhead when draining bursts
+ * of datagrams. The number of bytes received for each message is stored in
+ * its @c msg_len field.
+ *
+ * On a blocking socket the call waits for all @p vlen messages unless
+ * @c ZSOCK_MSG_WAITFORONE is set in @p flags, in which case it only waits for
+ * the first one and then returns whatever is already queued. If @p timeout
+ * is not NULL, the call returns the messages received so far once it
+ * expires.
+ *
+ * Receiving stops at the first message that fails. The error is only
+ * reported if no message could be received at all, otherwise the number of
+ * messages received so far is returned. At most @ref NET_MMSG_VLEN_MAX
+ * messages are received.
+ *
+ * See Linux man 2 recvmmsg for the reference of this extension.
+ * This function is also exposed as `recvmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @param sock Socket to receive from
+ * @param msgvec Array of messages
+ * @param vlen Number of messages in @p msgvec
+ * @param flags Flags applied to each message, see zsock_recvmsg()
+ * @param timeout Maximum time to wait for messages, or NULL to wait
+ *                according to the socket receive timeout
+ *
+ * @return Number of messages received, or -1 with errno set on error.
+ */
+__syscall int zsock_recvmmsg(int sock, struct net_mmsghdr *msgvec,
+			     unsigned int vlen, int flags,
+			     const struct timespec *timeout);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -554,6 +628,62 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY) || defined(__DOXYGEN__)
+struct net_buf;
+
+/**
+ * @brief Receive data without copying it
+ *
+ * @details
+ * Hand the network buffers holding the next received data over to the
+ * caller instead of copying them to a caller supplied buffer. For a stream
+ * socket, this is the unread data of the next received segment, for a
+ * datagram socket, the payload of the next datagram. The caller owns the
+ * returned fragment chain and must release it with net_buf_unref() once
+ * done. The buffers come from the network receive pool, so they should not
+ * be kept longer than needed.
+ *
+ * If the buffers are shared with another user of the packet, their content
+ * is copied to new buffers instead.
+ *
+ * Only native AF_INET and AF_INET6 sockets are supported. This function is
+ * not a system call and can only be called from supervisor threads.
+ *
+ * @param sock Socket to receive from
+ * @param buf Set to the fragment chain holding the data, or NULL if no data
+ *            is returned
+ * @param flags ZSOCK_MSG_DONTWAIT is supported, ZSOCK_MSG_PEEK is not
+ *
+ * @return Number of bytes received, 0 at the end of a stream, or -1 with
+ *         errno set on error.
+ */
+ssize_t zsock_recv_buf(int sock, struct net_buf **buf, int flags);
+
+/**
+ * @brief Send data without copying it
+ *
+ * @details
+ * Queue the network buffers @p buf for transmission on a connected TCP
+ * socket without copying their content. The fragments are queued as a
+ * whole: if the send window cannot take all of them, the call blocks, or
+ * fails with EAGAIN on a non-blocking socket. When the call succeeds, the
+ * fragments are owned by the connection, which releases them once the
+ * peer acknowledged the data, and must not be touched by the caller
+ * anymore. When it fails, they still belong to the caller.
+ *
+ * Only native AF_INET and AF_INET6 stream sockets are supported. This
+ * function is not a system call and can only be called from supervisor
+ * threads.
+ *
+ * @param sock Socket to send to
+ * @param buf Fragment chain holding the data
+ * @param flags ZSOCK_MSG_DONTWAIT is supported
+ *
+ * @return Number of bytes queued, or -1 with errno set on error.
+ */
+ssize_t zsock_send_buf(int sock, struct net_buf *buf, int flags);
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -943,6 +1073,8 @@ int zsock_getnameinfo(const struct net_sockaddr *addr, net_socklen_t addrlen,
 #define ZSOCK_TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define ZSOCK_TCP_KEEPCNT 4
+/** Congestion avoidance algorithm, given by name ("newreno", "cubic") */
+#define ZSOCK_TCP_CONGESTION 5
 
 /** @} */
 
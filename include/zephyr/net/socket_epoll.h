@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file socket_epoll.h
+ *
+ * @brief epoll support functions.
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+
+/**
+ * @brief BSD Sockets compatible API
+ * @defgroup bsd_sockets BSD Sockets compatible API
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/zvfs/epoll.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** zsock_epoll_ctl: Readable */
+#define ZSOCK_EPOLLIN      ZVFS_EPOLLIN
+/** zsock_epoll_ctl: Exceptional condition */
+#define ZSOCK_EPOLLPRI     ZVFS_EPOLLPRI
+/** zsock_epoll_ctl: Writable */
+#define ZSOCK_EPOLLOUT     ZVFS_EPOLLOUT
+/** zsock_epoll_wait: Error condition, always reported */
+#define ZSOCK_EPOLLERR     ZVFS_EPOLLERR
+/** zsock_epoll_wait: Connection closed, always reported */
+#define ZSOCK_EPOLLHUP     ZVFS_EPOLLHUP
+/** zsock_epoll_ctl: Disable the socket once reported */
+#define ZSOCK_EPOLLONESHOT ZVFS_EPOLLONESHOT
+/** zsock_epoll_ctl: Edge-triggered reporting */
+#define ZSOCK_EPOLLET      ZVFS_EPOLLET
+
+/** zsock_epoll_ctl: Add a socket to the interest set */
+#define ZSOCK_EPOLL_CTL_ADD ZVFS_EPOLL_CTL_ADD
+/** zsock_epoll_ctl: Remove a socket from the interest set */
+#define ZSOCK_EPOLL_CTL_DEL ZVFS_EPOLL_CTL_DEL
+/** zsock_epoll_ctl: Change the events of a socket */
+#define ZSOCK_EPOLL_CTL_MOD ZVFS_EPOLL_CTL_MOD
+
+/** Event reported by zsock_epoll_wait() */
+#define zsock_epoll_event zvfs_epoll_event
+
+/**
+ * @brief Create an epoll instance
+ *
+ * @details
+ * An epoll instance waits for events on a persistent set of sockets in time
+ * proportional to the number of ready sockets, which scales better than
+ * zsock_poll() with many mostly idle sockets. Other file descriptors
+ * supporting poll, such as eventfds, may be mixed in. Offloaded sockets are
+ * not supported. Requires @kconfig{CONFIG_ZVFS_EPOLL}.
+ * This function is also exposed as `epoll_create1()`
+ * if @kconfig{CONFIG_EPOLL} is defined.
+ */
+static inline int zsock_epoll_create(void)
+{
+	return zvfs_epoll_create1(0);
+}
+
+/**
+ * @brief Add, modify or remove a socket of an epoll interest set
+ *
+ * @details
+ * See zvfs_epoll_ctl().
+ * This function is also exposed as `epoll_ctl()`
+ * if @kconfig{CONFIG_EPOLL} is defined.
+ */
+static inline int zsock_epoll_ctl(int epfd, int op, int sock, struct zsock_epoll_event *event)
+{
+	return zvfs_epoll_ctl(epfd, op, sock, event);
+}
+
+/**
+ * @brief Wait for events on an epoll instance
+ *
+ * @details
+ * See zvfs_epoll_wait().
+ * This function is also exposed as `epoll_wait()`
+ * if @kconfig{CONFIG_EPOLL} is defined.
+ */
+static inline int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events, int maxevents,
+				   int timeout)
+{
+	return zvfs_epoll_wait(epfd, events, maxevents, timeout);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_ */
@@ -1069,6 +1069,21 @@ struct net_buf_data_alloc {
 	size_t alignment;
 };
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+/* Per-CPU cache of free buffers, see net_buf_alloc_len() */
+struct net_buf_pool_cache {
+	struct k_spinlock lock;
+	sys_slist_t free;
+	uint16_t count;
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t refills;
+	uint32_t drains;
+#endif /* CONFIG_NET_BUF_POOL_USAGE */
+};
+#endif /* CONFIG_NET_BUF_POOL_CACHE */
+
 /** @endcond */
 
 /**
@@ -1114,6 +1129,14 @@ struct net_buf_pool {
 
 	/** Start of buffer storage array */
 	struct net_buf * const __bufs;
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	/** @cond INTERNAL_HIDDEN */
+	struct net_buf_pool_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Threads about to wait for a free buffer */
+	atomic_t cache_waiters;
+	/** @endcond */
+#endif /* CONFIG_NET_BUF_POOL_CACHE */
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -1503,6 +1526,57 @@ struct net_buf * __must_check net_buf_alloc_with_data(struct net_buf_pool *pool,
 						      k_timeout_t timeout);
 #endif
 
+/** @cond INTERNAL_HIDDEN */
+void net_buf_pool_cache_put(struct net_buf_pool *pool, struct net_buf *buf);
+/** @endcond */
+
+/**
+ * @brief Network buffer pool cache statistics
+ *
+ * Buffers held by the per-CPU caches are accounted as free by the pool
+ * usage statistics.
+ */
+struct net_buf_pool_cache_stats {
+	/** Allocations served from a per-CPU cache */
+	uint32_t hits;
+	/** Allocations that had to refill a per-CPU cache */
+	uint32_t misses;
+	/** Batches of buffers moved from the pool to a per-CPU cache */
+	uint32_t refills;
+	/** Batches of buffers moved from a per-CPU cache back to the pool */
+	uint32_t drains;
+	/** Free buffers currently held by the per-CPU caches */
+	uint32_t cached;
+};
+
+/**
+ * @brief Get the cache statistics of a network buffer pool
+ *
+ * Sums up the statistics of the per-CPU caches of the pool, see
+ * @kconfig{CONFIG_NET_BUF_POOL_CACHE}. Requires
+ * @kconfig{CONFIG_NET_BUF_POOL_USAGE}.
+ *
+ * @param pool Pool to query.
+ * @param stats Structure to fill.
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Invalid argument
+ * @retval -ENOTSUP Caches or pool usage tracking are disabled
+ */
+int net_buf_pool_cache_stats_get(struct net_buf_pool *pool,
+				 struct net_buf_pool_cache_stats *stats);
+
+/**
+ * @brief Return the buffers held by the per-CPU caches to a pool
+ *
+ * Moves all the free buffers held by the per-CPU caches of the pool back
+ * to the pool LIFO. This is done automatically before an allocation
+ * blocks.
+ *
+ * @param pool Pool to flush.
+ */
+void net_buf_pool_cache_flush(struct net_buf_pool *pool);
+
 /**
  * @brief Destroy buffer from custom destroy callback
  *
@@ -1523,7 +1597,11 @@ static inline void net_buf_destroy(struct net_buf *buf)
 		buf->__buf = NULL;
 	}
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	net_buf_pool_cache_put(pool, buf);
+#else
 	k_lifo_put(&pool->free, buf);
+#endif
 }
 
 /**
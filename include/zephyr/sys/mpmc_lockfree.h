@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2010-2011 Dmitry Vyukov
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SYS_MPMC_LOCKFREE_H_
+#define ZEPHYR_SYS_MPMC_LOCKFREE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Multiple Producer Multiple Consumer (MPMC) Lockfree Queue API
+ * @defgroup mpmc_lockfree MPMC Lockfree Queue API
+ * @ingroup datastructure_apis
+ * @{
+ */
+
+/**
+ * @file mpmc_lockfree.h
+ *
+ * @brief A lock-free bounded multi producer multi consumer (MPMC) queue of
+ * pointers using a power of two sized ring. Ordering is First-In-First-Out.
+ *
+ * Based on the bounded MPMC queue described by Dmitry Vyukov. Every slot of
+ * the ring carries a sequence number telling producers and consumers whether
+ * the slot is free for the current lap, so that both sides only need a single
+ * compare-and-swap on their own position to claim a slot and no lock is ever
+ * taken. The producer and consumer positions live on separate cache lines.
+ *
+ * The queue stores pointers to objects owned by the user, nothing is copied
+ * or allocated. A NULL pointer can not be queued.
+ *
+ * An MPMC queue is safe to produce or consume in any number of ISRs and
+ * threads with O(1) push/pop, unless it is contended.
+ *
+ * With @kconfig{CONFIG_MPMC_LOCKFREE_POLL} consumers can also block until
+ * an object is available with mpmc_pop_wait(), or wait for the queue along
+ * with other objects with k_poll() using mpmc_poll_prepare() and
+ * mpmc_poll_pop(). Producers only pay for an extra load when nobody waits.
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+#ifdef CONFIG_MPMC_LOCKFREE_PAD_SIZE
+#define Z_MPMC_PAD CONFIG_MPMC_LOCKFREE_PAD_SIZE
+#else
+#define Z_MPMC_PAD sizeof(atomic_t)
+#endif
+
+/** @endcond */
+
+/**
+ * @brief Queue slot
+ */
+struct mpmc_slot {
+	atomic_t seq;
+	void *data;
+};
+
+/**
+ * @brief MPMC Queue
+ */
+struct mpmc {
+	struct mpmc_slot *slots;
+	unsigned long mask;
+
+	/* Producer position */
+	atomic_t head __aligned(Z_MPMC_PAD);
+
+	/* Consumer position */
+	atomic_t tail __aligned(Z_MPMC_PAD);
+
+#ifdef CONFIG_MPMC_LOCKFREE_POLL
+	/* Number of consumers waiting for an object */
+	atomic_t waiters __aligned(Z_MPMC_PAD);
+
+	struct k_poll_signal signal;
+#endif
+};
+
+/**
+ * @brief Define an MPMC queue
+ *
+ * The queue must be initialized with mpmc_init() before use.
+ *
+ * @param name Name of the queue
+ * @param sz Number of slots, must be a power of 2 (ex: 2, 4, 8)
+ */
+#define MPMC_DEFINE(name, sz)                                                                      \
+	BUILD_ASSERT(IS_POWER_OF_TWO(sz));                                                         \
+	static struct mpmc_slot __mpmc_slots_##name[sz];                                           \
+	struct mpmc name = {                                                                       \
+		.slots = __mpmc_slots_##name,                                                      \
+		.mask = (sz) - 1,                                                                  \
+	}
+
+/**
+ * @brief Initialize or reset a queue
+ *
+ * Not safe to do while the queue is being used.
+ *
+ * @param q Queue to initialize
+ * @param slots Slot array, may be NULL to reset a queue defined with
+ *              MPMC_DEFINE() or initialized before
+ * @param sz Number of slots, must be a power of 2 (ex: 2, 4, 8). Ignored when
+ *           @p slots is NULL.
+ */
+void mpmc_init(struct mpmc *q, struct mpmc_slot *slots, size_t sz);
+
+/**
+ * @brief Size of the queue
+ *
+ * @param q Queue
+ *
+ * @return Number of slots
+ */
+static inline size_t mpmc_size(const struct mpmc *q)
+{
+	return q->mask + 1;
+}
+
+/**
+ * @brief Number of queued objects
+ *
+ * Only a snapshot when the queue is used concurrently.
+ *
+ * @param q Queue
+ *
+ * @return Number of objects pushed and not yet popped
+ */
+static inline size_t mpmc_count(struct mpmc *q)
+{
+	unsigned long tail = (unsigned long)atomic_get(&q->tail);
+	unsigned long head = (unsigned long)atomic_get(&q->head);
+
+	return ((long)(head - tail) > 0) ? (size_t)(head - tail) : 0;
+}
+
+/** @cond INTERNAL_HIDDEN */
+
+#ifdef CONFIG_MPMC_LOCKFREE_POLL
+static inline void z_mpmc_notify(struct mpmc *q)
+{
+	if (atomic_get(&q->waiters) > 0) {
+		(void)k_poll_signal_raise(&q->signal, 0);
+	}
+}
+#endif
+
+/** @endcond */
+
+/**
+ * @brief Push an object
+ *
+ * @param q Queue to push the object to
+ * @param data Object to push, must not be NULL
+ *
+ * @retval 0 The object was queued
+ * @retval -ENOBUFS The queue is full
+ */
+static inline int mpmc_push(struct mpmc *q, void *data)
+{
+	struct mpmc_slot *slot;
+	unsigned long pos = (unsigned long)atomic_get(&q->head);
+	long diff;
+
+	__ASSERT_NO_MSG(data != NULL);
+
+	for (;;) {
+		slot = &q->slots[pos & q->mask];
+		diff = (long)((unsigned long)atomic_get(&slot->seq) - pos);
+
+		if (diff == 0) {
+			/* Slot free for this lap, claim it */
+			if (atomic_cas(&q->head, (atomic_val_t)pos, (atomic_val_t)(pos + 1))) {
+				break;
+			}
+		} else if (diff < 0) {
+			/* Slot not yet popped from the previous lap */
+			return -ENOBUFS;
+		}
+
+		pos = (unsigned long)atomic_get(&q->head);
+	}
+
+	slot->data = data;
+	atomic_set(&slot->seq, (atomic_val_t)(pos + 1));
+
+#ifdef CONFIG_MPMC_LOCKFREE_POLL
+	z_mpmc_notify(q);
+#endif
+
+	return 0;
+}
+
+/**
+ * @brief Pop an object
+ *
+ * @param q Queue to pop the object from
+ *
+ * @retval NULL When no object is available
+ * @retval data The oldest object in the queue
+ */
+static inline void *mpmc_pop(struct mpmc *q)
+{
+	struct mpmc_slot *slot;
+	unsigned long pos = (unsigned long)atomic_get(&q->tail);
+	void *data;
+	long diff;
+
+	for (;;) {
+		slot = &q->slots[pos & q->mask];
+		diff = (long)((unsigned long)atomic_get(&slot->seq) - (pos + 1));
+
+		if (diff == 0) {
+			/* Slot filled for this lap, claim it */
+			if (atomic_cas(&q->tail, (atomic_val_t)pos, (atomic_val_t)(pos + 1))) {
+				break;
+			}
+		} else if (diff < 0) {
+			/* Slot not yet pushed to */
+			return NULL;
+		}
+
+		pos = (unsigned long)atomic_get(&q->tail);
+	}
+
+	data = slot->data;
+	atomic_set(&slot->seq, (atomic_val_t)(pos + q->mask + 1));
+
+	return data;
+}
+
+#if defined(CONFIG_MPMC_LOCKFREE_POLL) || defined(__DOXYGEN__)
+
+/**
+ * @brief Prepare to wait for an object with k_poll()
+ *
+ * Registers the caller as a waiting consumer and initializes @p event so that
+ * k_poll() returns once an object may be available. The event is signaled
+ * right away if the queue is not empty. Every call must be followed by
+ * mpmc_poll_pop() once k_poll() returns, whatever the outcome.
+ *
+ * @param q Queue to wait on
+ * @param event Poll event to initialize
+ */
+void mpmc_poll_prepare(struct mpmc *q, struct k_poll_event *event);
+
+/**
+ * @brief Pop an object after waiting with k_poll()
+ *
+ * Unregisters the caller as a waiting consumer and tries to pop an object.
+ * Another consumer may have taken the object first, in which case NULL is
+ * returned and the caller may wait again.
+ *
+ * @param q Queue prepared with mpmc_poll_prepare()
+ *
+ * @retval NULL When no object is available
+ * @retval data The oldest object in the queue
+ */
+void *mpmc_poll_pop(struct mpmc *q);
+
+/**
+ * @brief Pop an object, waiting for one if the queue is empty
+ *
+ * Not available from ISRs unless @p timeout is K_NO_WAIT.
+ *
+ * @param q Queue to pop the object from
+ * @param timeout Waiting period for an object, or one of the special values
+ *                K_NO_WAIT and K_FOREVER
+ *
+ * @retval NULL When no object became available in time
+ * @retval data The oldest object in the queue
+ */
+void *mpmc_pop_wait(struct mpmc *q, k_timeout_t timeout);
+
+#endif /* CONFIG_MPMC_LOCKFREE_POLL */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_SYS_MPMC_LOCKFREE_H_ */
@@ -1475,6 +1475,50 @@
  */
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
 
+/**
+ * @brief Trace Message Queue batch put attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_batch_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch put attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_batch_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch put attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_put_batch_exit(msgq, timeout, ret)
+
+/**
+ * @brief Trace Message Queue batch get attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_batch_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch get attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_batch_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batch get attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_get_batch_exit(msgq, timeout, ret)
+
 /**
  * @brief Trace Message Queue peek
  * @param msgq Message Queue object
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/fdtable.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZVFS_EPOLLIN      ZVFS_POLLIN
+#define ZVFS_EPOLLPRI     ZVFS_POLLPRI
+#define ZVFS_EPOLLOUT     ZVFS_POLLOUT
+#define ZVFS_EPOLLERR     ZVFS_POLLERR
+#define ZVFS_EPOLLHUP     ZVFS_POLLHUP
+#define ZVFS_EPOLLONESHOT BIT(30)
+#define ZVFS_EPOLLET      BIT(31)
+
+#define ZVFS_EPOLL_CTL_ADD 1
+#define ZVFS_EPOLL_CTL_DEL 2
+#define ZVFS_EPOLL_CTL_MOD 3
+
+typedef union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} zvfs_epoll_data_t;
+
+struct zvfs_epoll_event {
+	uint32_t events;
+	zvfs_epoll_data_t data;
+};
+
+/**
+ * @brief Create a ZVFS epoll instance
+ *
+ * An epoll instance holds a persistent set of file descriptors of interest.
+ * Readiness of each registered file descriptor is tracked in the background
+ * from the moment it is added, so that waiting with @ref zvfs_epoll_wait only
+ * costs in proportion to the number of ready file descriptors, not to the size
+ * of the interest set.
+ *
+ * Any file descriptor supporting poll may be registered, except offloaded
+ * sockets and other epoll instances.
+ *
+ * @param size Ignored, must be greater than zero
+ *
+ * @return New ZVFS epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create(int size);
+
+/**
+ * @brief Create a ZVFS epoll instance
+ *
+ * Same as @ref zvfs_epoll_create. No flag is supported.
+ *
+ * @param flags Must be zero
+ *
+ * @return New ZVFS epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create1(int flags);
+
+/**
+ * @brief Add, modify or remove a file descriptor of an epoll interest set
+ *
+ * Closing a file descriptor removes it from all interest sets.
+ *
+ * @param epfd Epoll file descriptor
+ * @param op One of ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_MOD or ZVFS_EPOLL_CTL_DEL
+ * @param fd Target file descriptor
+ * @param event Events to watch along with the user data to report them with,
+ *              ignored for ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for events on an epoll instance
+ *
+ * File descriptors are level-triggered by default: they are reported by
+ * every call for as long as they are ready. With ZVFS_EPOLLET they are only
+ * reported again once they have been seen not ready by a later call, which is
+ * the case after the caller drained them until EAGAIN. With
+ * ZVFS_EPOLLONESHOT they are reported once and then disabled until modified
+ * with ZVFS_EPOLL_CTL_MOD.
+ *
+ * ZVFS_EPOLLERR and ZVFS_EPOLLHUP are always reported.
+ *
+ * @param epfd Epoll file descriptor
+ * @param events Array receiving the ready events
+ * @param maxevents Length of @p events, must be greater than zero
+ * @param timeout Timeout in milliseconds, -1 to wait forever
+ *
+ * @return Number of ready file descriptors on success, 0 on timeout, -1 on
+ *         error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout);
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Called by zvfs_close() to drop @p fd from all interest sets */
+void zvfs_epoll_fd_closed(int fd);
+
+/** @endcond */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
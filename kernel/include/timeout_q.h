@@ -27,7 +27,15 @@ extern "C" {
 
 static inline void z_init_timeout(struct _timeout *to)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	/* A queued timeout always holds a positive absolute expiry tick */
+	to->dticks = 0;
+#else
 	sys_dnode_init(&to->node);
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack = 0U;
+#endif /* CONFIG_TIMEOUT_SLACK */
 }
 
 /* Adds the timeout to the queue.
@@ -38,9 +46,30 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 
 int z_abort_timeout(struct _timeout *to);
 
+/* Sets how late the timeout may expire, so that its expiry can be handled
+ * together with a later one.  Must be called while the timeout is not
+ * queued; the slack applies to every following z_add_timeout().
+ */
+static inline void z_timeout_slack_set(struct _timeout *to, k_timeout_t slack)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	__ASSERT(!K_TIMEOUT_EQ(slack, K_FOREVER) && Z_IS_TIMEOUT_RELATIVE(slack),
+		 "slack must be a relative timeout");
+
+	to->slack = (slack.ticks > 0) ? (uint32_t)MIN(slack.ticks, (k_ticks_t)UINT32_MAX) : 0U;
+#else
+	ARG_UNUSED(to);
+	ARG_UNUSED(slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
 static inline bool z_is_inactive_timeout(const struct _timeout *to)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	return to->dticks <= 0;
+#else
 	return !sys_dnode_is_linked(&to->node);
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
 }
 
 static inline bool z_is_aborted_timeout(const struct _timeout *to)
@@ -27,6 +27,9 @@ void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	heap->lock = (struct k_spinlock) {};
+#ifdef CONFIG_K_HEAP_CACHE
+	(void)memset(heap->cache, 0, sizeof(heap->cache));
+#endif
 	sys_heap_init(&heap->heap, mem, bytes);
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
@@ -74,6 +77,302 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
+#ifdef CONFIG_K_HEAP_CACHE
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_K_HEAP_CACHE_MAX_SIZE),
+	     "K_HEAP_CACHE_MAX_SIZE must be a power of two");
+BUILD_ASSERT(CONFIG_K_HEAP_CACHE_BATCH <= CONFIG_K_HEAP_CACHE_DEPTH,
+	     "K_HEAP_CACHE_BATCH must not exceed K_HEAP_CACHE_DEPTH");
+
+/* Smallest cached size class is 16 bytes, so that a free block always
+ * has room for the list node linking it into its bin.
+ */
+#define CACHE_MIN_SHIFT 4
+
+/* Allocation granularity of sys_heap */
+#define CACHE_CHUNK_UNIT 8
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+#define CACHE_STAT(cache, stmt) ((cache)->stmt)
+#else
+#define CACHE_STAT(cache, stmt) do { } while (false)
+#endif
+
+static inline size_t cache_bin_size(int bin)
+{
+	return (size_t)1 << (bin + CACHE_MIN_SHIFT);
+}
+
+/* Bin serving an allocation of @a bytes, or -1 if not cacheable */
+static int cache_alloc_bin(size_t bytes)
+{
+	if ((bytes == 0U) || (bytes > CONFIG_K_HEAP_CACHE_MAX_SIZE)) {
+		return -1;
+	}
+
+	return MAX((int)LOG2CEIL(bytes), CACHE_MIN_SHIFT) - CACHE_MIN_SHIFT;
+}
+
+/* Bin a free block of @a usable bytes belongs to, or -1 if not cacheable.
+ * sys_heap rounds requests up to whole chunk units, so a block allocated
+ * for bin n has between cache_bin_size(n) and cache_bin_size(n) plus one
+ * chunk unit of usable bytes.  Larger blocks are left to the heap, as
+ * every allocation served from the bin would waste the difference.
+ */
+static int cache_free_bin(size_t usable)
+{
+	int bin;
+
+	if (usable < cache_bin_size(0)) {
+		return -1;
+	}
+
+	bin = cache_alloc_bin(usable - (CACHE_CHUNK_UNIT - 1));
+	if ((bin < 0) || (cache_bin_size(bin) > usable)) {
+		return -1;
+	}
+
+	return bin;
+}
+
+/* Only the owning CPU uses a cache on the alloc/free paths, with
+ * interrupts locked, which also keeps the thread from migrating while it
+ * holds the cache.  On SMP the per-cache spinlock is additionally taken,
+ * only to serialize against cache_flush_locked() and the statistics
+ * walker running on other CPUs.  As no other CPU takes it on the fast
+ * path, it stays uncontended and its cache line stays local.
+ */
+static inline struct z_heap_cache *cache_lock(struct k_heap *heap, unsigned int *key)
+{
+	struct z_heap_cache *cache;
+
+	*key = arch_irq_lock();
+	cache = &heap->cache[arch_curr_cpu()->id];
+#ifdef CONFIG_SMP
+	(void)k_spin_lock(&cache->lock);
+#endif
+
+	return cache;
+}
+
+static inline void cache_unlock(struct z_heap_cache *cache, unsigned int key)
+{
+#ifdef CONFIG_SMP
+	k_spin_release(&cache->lock);
+#else
+	ARG_UNUSED(cache);
+#endif
+	arch_irq_unlock(key);
+}
+
+/* Must be called with the heap lock held */
+static bool cache_flush_locked(struct k_heap *heap)
+{
+	bool flushed = false;
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct z_heap_cache *cache = &heap->cache[cpu];
+
+		for (int bin = 0; bin < Z_HEAP_CACHE_NUM_BINS; bin++) {
+			k_spinlock_key_t key = k_spin_lock(&cache->lock);
+			sys_slist_t list = cache->bins[bin];
+			sys_snode_t *node;
+
+			sys_slist_init(&cache->bins[bin]);
+			cache->count[bin] = 0U;
+			CACHE_STAT(cache, cached_bytes = 0U);
+			k_spin_unlock(&cache->lock, key);
+
+			while ((node = sys_slist_get(&list)) != NULL) {
+				sys_heap_free(&heap->heap, node);
+				flushed = true;
+			}
+		}
+	}
+
+	return flushed;
+}
+
+static void *cache_alloc(struct k_heap *heap, size_t bytes)
+{
+	int bin = cache_alloc_bin(bytes);
+	struct z_heap_cache *cache;
+	void *blocks[CONFIG_K_HEAP_CACHE_BATCH];
+	k_spinlock_key_t key;
+	unsigned int ckey;
+	sys_snode_t *node;
+	int n = 0;
+	int i;
+
+	if (bin < 0) {
+		return NULL;
+	}
+
+	cache = cache_lock(heap, &ckey);
+	node = sys_slist_get(&cache->bins[bin]);
+	if (node != NULL) {
+		cache->count[bin]--;
+		CACHE_STAT(cache, hits++);
+		CACHE_STAT(cache, cached_bytes -= sys_heap_usable_size(&heap->heap, node));
+	}
+	cache_unlock(cache, ckey);
+
+	if (node != NULL) {
+		return node;
+	}
+
+	/* Empty bin, grab a batch of blocks from the heap */
+	key = k_spin_lock(&heap->lock);
+	while (n < CONFIG_K_HEAP_CACHE_BATCH) {
+		blocks[n] = sys_heap_alloc(&heap->heap, cache_bin_size(bin));
+		if (blocks[n] == NULL) {
+			break;
+		}
+		n++;
+	}
+	k_spin_unlock(&heap->lock, key);
+
+	if (n == 0) {
+		/* Let the caller take the regular path, which flushes the
+		 * caches and waits as needed.
+		 */
+		return NULL;
+	}
+
+	/* May run on another CPU by now, refill whichever cache is local */
+	cache = cache_lock(heap, &ckey);
+	CACHE_STAT(cache, misses++);
+	CACHE_STAT(cache, refills++);
+	for (i = 1; (i < n) && (cache->count[bin] < CONFIG_K_HEAP_CACHE_DEPTH); i++) {
+		sys_slist_prepend(&cache->bins[bin], blocks[i]);
+		cache->count[bin]++;
+		CACHE_STAT(cache, cached_bytes += sys_heap_usable_size(&heap->heap, blocks[i]));
+	}
+	cache_unlock(cache, ckey);
+
+	/* Concurrent frees may have filled the bin in the meantime */
+	if (i < n) {
+		key = k_spin_lock(&heap->lock);
+		for (; i < n; i++) {
+			sys_heap_free(&heap->heap, blocks[i]);
+		}
+		k_spin_unlock(&heap->lock, key);
+	}
+
+	return blocks[0];
+}
+
+static bool cache_free(struct k_heap *heap, void *mem)
+{
+	int bin = cache_free_bin(sys_heap_usable_size(&heap->heap, mem));
+	struct z_heap_cache *cache;
+	void *blocks[CONFIG_K_HEAP_CACHE_BATCH];
+	k_spinlock_key_t key;
+	unsigned int ckey;
+
+	/* Hand the memory straight to the heap if somebody is waiting */
+	if ((bin < 0) || (z_waitq_head(&heap->wait_q) != NULL)) {
+		return false;
+	}
+
+	cache = cache_lock(heap, &ckey);
+	if (cache->count[bin] < CONFIG_K_HEAP_CACHE_DEPTH) {
+		sys_slist_prepend(&cache->bins[bin], mem);
+		cache->count[bin]++;
+		CACHE_STAT(cache, cached_bytes += sys_heap_usable_size(&heap->heap, mem));
+		cache_unlock(cache, ckey);
+		return true;
+	}
+
+	/* Full bin, return a batch of blocks to the heap */
+	for (int i = 0; i < CONFIG_K_HEAP_CACHE_BATCH; i++) {
+		blocks[i] = sys_slist_get(&cache->bins[bin]);
+		CACHE_STAT(cache, cached_bytes -= sys_heap_usable_size(&heap->heap, blocks[i]));
+	}
+	sys_slist_prepend(&cache->bins[bin], mem);
+	cache->count[bin] -= CONFIG_K_HEAP_CACHE_BATCH - 1;
+	CACHE_STAT(cache, cached_bytes += sys_heap_usable_size(&heap->heap, mem));
+	CACHE_STAT(cache, drains++);
+	cache_unlock(cache, ckey);
+
+	key = k_spin_lock(&heap->lock);
+	for (int i = 0; i < CONFIG_K_HEAP_CACHE_BATCH; i++) {
+		sys_heap_free(&heap->heap, blocks[i]);
+	}
+	if (IS_ENABLED(CONFIG_MULTITHREADING) && (z_unpend_all(&heap->wait_q) != 0)) {
+		z_reschedule(&heap->lock, key);
+	} else {
+		k_spin_unlock(&heap->lock, key);
+	}
+
+	return true;
+}
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+int k_heap_cache_stats_get(struct k_heap *h, struct k_heap_cache_stats *stats)
+{
+	if ((h == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	*stats = (struct k_heap_cache_stats) {0};
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct z_heap_cache *cache = &h->cache[cpu];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		stats->hits += cache->hits;
+		stats->misses += cache->misses;
+		stats->refills += cache->refills;
+		stats->drains += cache->drains;
+		stats->cached_bytes += cache->cached_bytes;
+
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+
+void k_heap_cache_flush(struct k_heap *heap)
+{
+	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+	if (cache_flush_locked(heap) && IS_ENABLED(CONFIG_MULTITHREADING) &&
+	    (z_unpend_all(&heap->wait_q) != 0)) {
+		z_reschedule(&heap->lock, key);
+	} else {
+		k_spin_unlock(&heap->lock, key);
+	}
+}
+
+#else
+
+static inline bool cache_flush_locked(struct k_heap *heap)
+{
+	ARG_UNUSED(heap);
+
+	return false;
+}
+
+static inline void *cache_alloc(struct k_heap *heap, size_t bytes)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(bytes);
+
+	return NULL;
+}
+
+static inline bool cache_free(struct k_heap *heap, void *mem)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(mem);
+
+	return false;
+}
+
+#endif /* CONFIG_K_HEAP_CACHE */
+
 typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
 
 static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes,
@@ -92,6 +391,11 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	while (ret == NULL) {
 		ret = sys_heap_allocator(&heap->heap, align, bytes);
 
+		/* Memory may be sitting in the per-CPU caches */
+		if ((ret == NULL) && cache_flush_locked(heap)) {
+			ret = sys_heap_allocator(&heap->heap, align, bytes);
+		}
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -120,8 +424,12 @@ void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, alloc, heap, timeout);
 
-	void *ret = z_heap_alloc_helper(heap, 0, bytes, timeout,
-					sys_heap_noalign_alloc);
+	void *ret = cache_alloc(heap, bytes);
+
+	if (ret == NULL) {
+		ret = z_heap_alloc_helper(heap, 0, bytes, timeout,
+					  sys_heap_noalign_alloc);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, alloc, heap, timeout, ret);
 
@@ -187,6 +495,10 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 	while (ret == NULL) {
 		ret = sys_heap_realloc(&heap->heap, ptr, bytes);
 
+		if ((ret == NULL) && cache_flush_locked(heap)) {
+			ret = sys_heap_realloc(&heap->heap, ptr, bytes);
+		}
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -205,6 +517,11 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+	if ((mem != NULL) && cache_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
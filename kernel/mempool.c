@@ -42,6 +42,15 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	mem = sys_heap_allocator(&heap->heap, __align, size);
 	k_spin_unlock(&heap->lock, key);
 
+	/* Freed blocks may be sitting in the k_heap per-CPU caches */
+	if ((mem == NULL) && IS_ENABLED(CONFIG_K_HEAP_CACHE)) {
+		k_heap_cache_flush(heap);
+
+		key = k_spin_lock(&heap->lock);
+		mem = sys_heap_allocator(&heap->heap, __align, size);
+		k_spin_unlock(&heap->lock, key);
+	}
+
 	if (mem == NULL) {
 		return NULL;
 	}
@@ -123,6 +123,42 @@ exit:
 	return ret;
 }
 
+/* Copy @a count messages into the ring buffer, handling wrap around */
+static void ring_write(struct k_msgq *msgq, const char *src, uint32_t count)
+{
+	size_t bytes = count * msgq->msg_size;
+	size_t first = MIN(bytes, (size_t)(msgq->buffer_end - msgq->write_ptr));
+
+	(void)memcpy(msgq->write_ptr, src, first);
+	msgq->write_ptr += first;
+	if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+	if (first < bytes) {
+		(void)memcpy(msgq->write_ptr, src + first, bytes - first);
+		msgq->write_ptr += bytes - first;
+	}
+	msgq->used_msgs += count;
+}
+
+/* Copy @a count messages out of the ring buffer, handling wrap around */
+static void ring_read(struct k_msgq *msgq, char *dst, uint32_t count)
+{
+	size_t bytes = count * msgq->msg_size;
+	size_t first = MIN(bytes, (size_t)(msgq->buffer_end - msgq->read_ptr));
+
+	(void)memcpy(dst, msgq->read_ptr, first);
+	msgq->read_ptr += first;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+	if (first < bytes) {
+		(void)memcpy(dst + first, msgq->read_ptr, bytes - first);
+		msgq->read_ptr += bytes - first;
+	}
+	msgq->used_msgs -= count;
+}
+
 static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 			k_timeout_t timeout, bool put_at_back)
 {
@@ -141,10 +177,15 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_front, msgq, timeout);
 	}
 
-	if (msgq->used_msgs < msgq->max_msgs) {
+	if (unlikely(((msgq->flags & K_MSGQ_FLAG_PUT_CLAIM) != 0U) ||
+		     (!put_at_back && ((msgq->flags & K_MSGQ_FLAG_GET_CLAIM) != 0U)))) {
+		/* claimed slots must stay where they are */
+		result = -EBUSY;
+	} else if (msgq->used_msgs < msgq->max_msgs) {
 		/* message queue isn't full */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (unlikely(pending_thread != NULL)) {
+		if (unlikely(pending_thread != NULL) &&
+		    (pending_thread->base.swap_data != NULL)) {
 			resched = true;
 
 			/* give message to waiting thread */
@@ -156,15 +197,8 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
 					msgq->write_ptr < msgq->buffer_end);
 			if (put_at_back) {
-				/*
-				 * to write a message to the back of the queue,
-				 * copy the message and increment write_ptr
-				 */
-				(void)memcpy(msgq->write_ptr, (char *)data, msgq->msg_size);
-				msgq->write_ptr += msgq->msg_size;
-				if (msgq->write_ptr == msgq->buffer_end) {
-					msgq->write_ptr = msgq->buffer_start;
-				}
+				/* write the message to the back of the queue */
+				ring_write(msgq, data, 1U);
 			} else {
 				/*
 				 * to write a message to the head of the queue,
@@ -177,9 +211,16 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 				}
 				msgq->read_ptr -= msgq->msg_size;
 				(void)memcpy(msgq->read_ptr, (char *)data, msgq->msg_size);
+				msgq->used_msgs++;
 			}
-			msgq->used_msgs++;
 			resched = handle_poll_events(msgq);
+
+			if (unlikely(pending_thread != NULL)) {
+				/* a thread claiming a message retries */
+				arch_thread_return_value_set(pending_thread, 0);
+				z_ready_thread(pending_thread);
+				resched = true;
+			}
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -284,30 +325,23 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
-	if (msgq->used_msgs > 0U) {
+	if (unlikely((msgq->flags & K_MSGQ_FLAG_GET_CLAIM) != 0U)) {
+		result = -EBUSY;
+	} else if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
-		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
+		ring_read(msgq, data, 1U);
 
 		/* handle first thread waiting to write (if any) */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
 		if (unlikely(pending_thread != NULL)) {
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
-			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
+			/* add thread's message to queue, unless it is
+			 * claiming a slot and retries on its own
+			 */
+			if (pending_thread->base.swap_data != NULL) {
+				ring_write(msgq, pending_thread->base.swap_data, 1U);
 			}
-			msgq->used_msgs++;
 
 			/* wake up waiting thread */
 			arch_thread_return_value_set(pending_thread, 0);
@@ -352,6 +386,375 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <zephyr/syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_put_batch(struct k_msgq *msgq, const void *data,
+			    uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	const char *src = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t done = 0U;
+	uint32_t count;
+	int result = 0;
+	bool resched = false;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_batch, msgq, timeout);
+
+	if (unlikely((msgq->flags & K_MSGQ_FLAG_PUT_CLAIM) != 0U)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_batch, msgq, timeout, -EBUSY);
+		k_spin_unlock(&msgq->lock, key);
+		return -EBUSY;
+	}
+
+	while (done < num_msgs) {
+		/* Threads only wait to receive while the queue is empty,
+		 * serve them first to keep the messages in order.
+		 */
+		while ((done < num_msgs) && (msgq->used_msgs == 0U) &&
+		       ((pending_thread = z_unpend_first_thread(&msgq->wait_q)) != NULL)) {
+			void *dst = pending_thread->base.swap_data;
+
+			if (dst != NULL) {
+				(void)memcpy(dst, src + (done * msgq->msg_size),
+					     msgq->msg_size);
+				done++;
+			}
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			resched = true;
+
+			if (dst == NULL) {
+				/* a thread claiming a message takes it from
+				 * the queue
+				 */
+				break;
+			}
+		}
+
+		count = MIN(num_msgs - done, msgq->max_msgs - msgq->used_msgs);
+		if (count > 0U) {
+			ring_write(msgq, src + (done * msgq->msg_size), count);
+			resched = handle_poll_events(msgq) || resched;
+			done += count;
+		}
+
+		if (done == num_msgs) {
+			break;
+		}
+
+		/* The queue is full, wait for room for the next message */
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+			break;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put_batch, msgq, timeout);
+
+		_current->base.swap_data = (void *)(src + (done * msgq->msg_size));
+
+		/* Pending switches to the receivers readied so far anyway */
+		resched = false;
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		key = k_spin_lock(&msgq->lock);
+		if (result != 0) {
+			break;
+		}
+
+		/* A receiver took the message we were waiting with */
+		done++;
+	}
+
+	if (done > 0U) {
+		result = (int)done;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_batch, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+int z_impl_k_msgq_get_batch(struct k_msgq *msgq, void *data,
+			    uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	char *dst = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t done = 0U;
+	uint32_t count;
+	int result;
+	bool resched = false;
+
+	if (num_msgs == 0U) {
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_batch, msgq, timeout);
+
+	if (unlikely((msgq->flags & K_MSGQ_FLAG_GET_CLAIM) != 0U)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_batch, msgq, timeout, -EBUSY);
+		k_spin_unlock(&msgq->lock, key);
+		return -EBUSY;
+	}
+
+	while ((done < num_msgs) && (msgq->used_msgs > 0U)) {
+		count = MIN(num_msgs - done, msgq->used_msgs);
+		ring_read(msgq, dst + (done * msgq->msg_size), count);
+		done += count;
+
+		/* Threads only wait to send while the queue is full, move
+		 * their messages into the room just made.
+		 */
+		while ((msgq->used_msgs < msgq->max_msgs) &&
+		       ((pending_thread = z_unpend_first_thread(&msgq->wait_q)) != NULL)) {
+			if (pending_thread->base.swap_data != NULL) {
+				ring_write(msgq, pending_thread->base.swap_data, 1U);
+			}
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			resched = true;
+		}
+	}
+
+	if (done > 0U) {
+		result = (int)done;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for a message to become available */
+		result = -ENOMSG;
+	} else {
+		/* wait for the first message, the sender copies it for us */
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get_batch, msgq, timeout);
+
+		_current->base.swap_data = dst;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		result = (result == 0) ? 1 : result;
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_batch, msgq, timeout, result);
+
+		return result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_batch, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_batch(struct k_msgq *msgq, const void *data,
+					  uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_batch(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_put_batch_mrsh.c>
+
+static inline int z_vrfy_k_msgq_get_batch(struct k_msgq *msgq, void *data,
+					  uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_batch(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_get_batch_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int k_msgq_put_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	for (;;) {
+		if ((msgq->flags & K_MSGQ_FLAG_PUT_CLAIM) != 0U) {
+			result = -EBUSY;
+			break;
+		}
+
+		if (msgq->used_msgs < msgq->max_msgs) {
+			/* the slot is reserved until committed */
+			msgq->flags |= K_MSGQ_FLAG_PUT_CLAIM;
+			*data = msgq->write_ptr;
+			result = 0;
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+			break;
+		}
+
+		/* no message to copy, receivers just wake us up */
+		_current->base.swap_data = NULL;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		key = k_spin_lock(&msgq->lock);
+		if (result != 0) {
+			break;
+		}
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_put_commit(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	bool resched;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_PUT_CLAIM) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~K_MSGQ_FLAG_PUT_CLAIM;
+
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (unlikely(pending_thread != NULL) &&
+	    (pending_thread->base.swap_data != NULL)) {
+		/* give message to waiting thread, the slot stays free */
+		(void)memcpy(pending_thread->base.swap_data, msgq->write_ptr,
+			     msgq->msg_size);
+		resched = true;
+	} else {
+		msgq->write_ptr += msgq->msg_size;
+		if (msgq->write_ptr == msgq->buffer_end) {
+			msgq->write_ptr = msgq->buffer_start;
+		}
+		msgq->used_msgs++;
+		resched = handle_poll_events(msgq);
+	}
+
+	if (unlikely(pending_thread != NULL)) {
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+int k_msgq_get_claim(struct k_msgq *msgq, void **data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	for (;;) {
+		if ((msgq->flags & K_MSGQ_FLAG_GET_CLAIM) != 0U) {
+			result = -EBUSY;
+			break;
+		}
+
+		if (msgq->used_msgs > 0U) {
+			/* the message keeps its slot until committed */
+			msgq->flags |= K_MSGQ_FLAG_GET_CLAIM;
+			*data = msgq->read_ptr;
+			result = 0;
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+			break;
+		}
+
+		/* no buffer to copy to, senders queue the message and just
+		 * wake us up
+		 */
+		_current->base.swap_data = NULL;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		key = k_spin_lock(&msgq->lock);
+		if (result != 0) {
+			break;
+		}
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_get_commit(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((msgq->flags & K_MSGQ_FLAG_GET_CLAIM) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~K_MSGQ_FLAG_GET_CLAIM;
+	msgq->read_ptr += msgq->msg_size;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs--;
+
+	/* handle first thread waiting to write (if any) */
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (unlikely(pending_thread != NULL)) {
+		if (pending_thread->base.swap_data != NULL) {
+			ring_write(msgq, pending_thread->base.swap_data, 1U);
+		}
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -453,6 +856,8 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
+	/* a claimed message is gone, a claimed slot is kept */
+	msgq->flags &= ~K_MSGQ_FLAG_GET_CLAIM;
 
 	if (resched) {
 		z_reschedule(&msgq->lock, key);
@@ -6,6 +6,7 @@
 #include <zephyr/init.h>
 #include <zephyr/kernel.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/barrier.h>
 #include <ksched.h>
 #include <kthread.h>
 #include <wait_q.h>
@@ -34,6 +35,149 @@ static inline bool pipe_empty(struct k_pipe *pipe)
 	return ring_buf_is_empty(&pipe->buf);
 }
 
+#ifdef CONFIG_PIPE_FAST_PATH
+/*
+ * IRQ-locked fast path
+ *
+ * The ring buffer producer only updates the put indices and the consumer
+ * only updates the get indices, so one writer and one reader may copy data
+ * concurrently without the pipe lock, as long as no thread waits on the
+ * pipe. The fast path runs with local interrupts masked so that it can't
+ * be preempted while it owns its side of the ring buffer, which is why it
+ * only copies up to CONFIG_PIPE_FAST_PATH_MAX_SIZE bytes.
+ *
+ * The regular path sets PIPE_FAST_OFF under the pipe lock, which keeps new
+ * fast path operations out, and waits for the ones in flight on other
+ * CPUs to complete before it touches the ring buffer. It clears the flag
+ * again once no thread waits on the open pipe anymore.
+ */
+#define PIPE_FAST_WRITER BIT(0)
+#define PIPE_FAST_READER BIT(1)
+#define PIPE_FAST_OFF    BIT(2)
+
+static bool fast_path_enter(struct k_pipe *pipe, atomic_val_t side)
+{
+	atomic_val_t old = atomic_or(&pipe->fast, side);
+
+	if (likely((old & (side | PIPE_FAST_OFF)) == 0)) {
+		return true;
+	}
+
+	if ((old & side) == 0) {
+		atomic_and(&pipe->fast, ~side);
+	}
+
+	return false;
+}
+
+static inline void fast_path_exit(struct k_pipe *pipe, atomic_val_t side)
+{
+	atomic_and(&pipe->fast, ~side);
+}
+
+/* Must be called with the pipe lock held */
+static void fast_path_disable(struct k_pipe *pipe)
+{
+	atomic_or(&pipe->fast, PIPE_FAST_OFF);
+
+	while ((atomic_get(&pipe->fast) & (PIPE_FAST_WRITER | PIPE_FAST_READER)) != 0) {
+		arch_spin_relax();
+	}
+}
+
+/* Must be called with the pipe lock held */
+static void fast_path_enable(struct k_pipe *pipe)
+{
+	if ((pipe->waiting == 0) && (pipe->flags == PIPE_FLAG_OPEN)) {
+		atomic_and(&pipe->fast, ~PIPE_FAST_OFF);
+	}
+}
+
+static int fast_path_write(struct k_pipe *pipe, const uint8_t *data, size_t len)
+{
+	unsigned int key = arch_irq_lock();
+	bool poll = false;
+	uint32_t partial;
+	uint8_t *dst;
+	int rc = -EAGAIN;
+
+	if (!fast_path_enter(pipe, PIPE_FAST_WRITER)) {
+		arch_irq_unlock(key);
+		return rc;
+	}
+
+	if (ring_buf_space_get(&pipe->buf) >= len) {
+		/* at most two chunks when wrapping around the buffer end */
+		for (size_t written = 0; written < len; written += partial) {
+			partial = ring_buf_put_claim(&pipe->buf, &dst, len - written);
+			memcpy(dst, &data[written], partial);
+		}
+		/* publish the data before the indices */
+		barrier_dmem_fence_full();
+		(void)ring_buf_put_finish(&pipe->buf, len);
+		rc = len;
+#ifdef CONFIG_POLL
+		poll = !sys_dlist_is_empty(&pipe->poll_events);
+#endif /* CONFIG_POLL */
+	}
+
+	fast_path_exit(pipe, PIPE_FAST_WRITER);
+	arch_irq_unlock(key);
+
+#ifdef CONFIG_POLL
+	if (poll && z_handle_obj_poll_events(&pipe->poll_events,
+					     K_POLL_STATE_PIPE_DATA_AVAILABLE)) {
+		z_reschedule_unlocked();
+	}
+#else
+	ARG_UNUSED(poll);
+#endif /* CONFIG_POLL */
+
+	return rc;
+}
+
+static int fast_path_read(struct k_pipe *pipe, uint8_t *data, size_t len)
+{
+	unsigned int key = arch_irq_lock();
+	uint32_t partial;
+	uint8_t *src;
+	int rc = -EAGAIN;
+
+	if (!fast_path_enter(pipe, PIPE_FAST_READER)) {
+		arch_irq_unlock(key);
+		return rc;
+	}
+
+	if (ring_buf_size_get(&pipe->buf) >= len) {
+		/* read the indices before the data */
+		barrier_dmem_fence_full();
+		for (size_t used = 0; used < len; used += partial) {
+			partial = ring_buf_get_claim(&pipe->buf, &src, len - used);
+			memcpy(&data[used], src, partial);
+		}
+		/* done with the data before releasing the space */
+		barrier_dmem_fence_full();
+		(void)ring_buf_get_finish(&pipe->buf, len);
+		rc = len;
+	}
+
+	fast_path_exit(pipe, PIPE_FAST_READER);
+	arch_irq_unlock(key);
+
+	return rc;
+}
+#else
+static inline void fast_path_disable(struct k_pipe *pipe)
+{
+	ARG_UNUSED(pipe);
+}
+
+static inline void fast_path_enable(struct k_pipe *pipe)
+{
+	ARG_UNUSED(pipe);
+}
+#endif /* CONFIG_PIPE_FAST_PATH */
+
 static int wait_for(_wait_q_t *waitq, struct k_pipe *pipe, k_spinlock_key_t *key,
 		    k_timepoint_t time_limit, bool *need_resched)
 {
@@ -69,6 +213,9 @@ void z_impl_k_pipe_init(struct k_pipe *pipe, uint8_t *buffer, size_t buffer_size
 	ring_buf_init(&pipe->buf, buffer_size, buffer);
 	pipe->flags = PIPE_FLAG_OPEN;
 	pipe->waiting = 0;
+#ifdef CONFIG_PIPE_FAST_PATH
+	atomic_clear(&pipe->fast);
+#endif /* CONFIG_PIPE_FAST_PATH */
 
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->data);
@@ -112,11 +259,16 @@ static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 				K_SPINLOCK_BREAK;
 			}
 
+			/* Readers claiming data in place have a zero
+			 * length spec and are only woken up.
+			 */
 			reader_buf = reader->base.swap_data;
 			copy_size = min(len - written,
 					reader_buf->len - reader_buf->used);
-			memcpy(&reader_buf->data[reader_buf->used],
-			       &data[written], copy_size);
+			if (copy_size != 0) {
+				memcpy(&reader_buf->data[reader_buf->used],
+				       &data[written], copy_size);
+			}
 			written += copy_size;
 			reader_buf->used += copy_size;
 
@@ -149,16 +301,34 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 	int rc;
 	size_t written = 0;
 	k_timepoint_t end = sys_timepoint_calc(timeout);
-	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	k_spinlock_key_t key;
 	bool need_resched = false;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, write, pipe, data, len, timeout);
 
+#ifdef CONFIG_PIPE_FAST_PATH
+	if (len <= CONFIG_PIPE_FAST_PATH_MAX_SIZE) {
+		rc = fast_path_write(pipe, data, len);
+		if (likely(rc >= 0)) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, write, pipe, rc);
+			return rc;
+		}
+	}
+#endif /* CONFIG_PIPE_FAST_PATH */
+
+	key = k_spin_lock(&pipe->lock);
+	fast_path_disable(pipe);
+
 	if (unlikely(pipe_resetting(pipe))) {
 		rc = -ECANCELED;
 		goto exit;
 	}
 
+	if (unlikely((pipe->flags & PIPE_FLAG_WRITE_CLAIM) != 0)) {
+		rc = -EBUSY;
+		goto exit;
+	}
+
 	for (;;) {
 		if (unlikely(pipe_closed(pipe))) {
 			rc = -EPIPE;
@@ -208,6 +378,7 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 		}
 	}
 exit:
+	fast_path_enable(pipe);
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, write, pipe, rc);
 	if (need_resched) {
 		z_reschedule(&pipe->lock, key);
@@ -222,16 +393,34 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 	struct pipe_buf_spec buf = { data, len, 0 };
 	int rc;
 	k_timepoint_t end = sys_timepoint_calc(timeout);
-	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	k_spinlock_key_t key;
 	bool need_resched = false;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, read, pipe, data, len, timeout);
 
+#ifdef CONFIG_PIPE_FAST_PATH
+	if (len <= CONFIG_PIPE_FAST_PATH_MAX_SIZE) {
+		rc = fast_path_read(pipe, data, len);
+		if (likely(rc >= 0)) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, read, pipe, rc);
+			return rc;
+		}
+	}
+#endif /* CONFIG_PIPE_FAST_PATH */
+
+	key = k_spin_lock(&pipe->lock);
+	fast_path_disable(pipe);
+
 	if (unlikely(pipe_resetting(pipe))) {
 		rc = -ECANCELED;
 		goto exit;
 	}
 
+	if (unlikely((pipe->flags & PIPE_FLAG_READ_CLAIM) != 0)) {
+		rc = -EBUSY;
+		goto exit;
+	}
+
 	for (;;) {
 		if (pipe_full(pipe)) {
 			/* One or more pending writers may exist. */
@@ -261,6 +450,7 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 		}
 	}
 exit:
+	fast_path_enable(pipe);
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, read, pipe, rc);
 	if (need_resched) {
 		z_reschedule(&pipe->lock, key);
@@ -270,16 +460,183 @@ exit:
 	return rc;
 }
 
+int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+	int rc;
+
+	fast_path_disable(pipe);
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	if ((pipe->flags & PIPE_FLAG_WRITE_CLAIM) != 0) {
+		rc = -EBUSY;
+		goto exit;
+	}
+
+	if (pipe->buf.size == 0) {
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	for (;;) {
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		rc = ring_buf_put_claim(&pipe->buf, data, len);
+		if ((rc > 0) || (len == 0)) {
+			pipe->flags |= PIPE_FLAG_WRITE_CLAIM;
+			break;
+		}
+
+		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	fast_path_enable(pipe);
+	k_spin_unlock(&pipe->lock, key);
+	return rc;
+}
+
+int k_pipe_write_commit(struct k_pipe *pipe, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+	int rc = -EINVAL;
+
+	if ((pipe->flags & PIPE_FLAG_WRITE_CLAIM) == 0) {
+		goto exit;
+	}
+
+	rc = ring_buf_put_finish(&pipe->buf, len);
+	if (rc != 0) {
+		goto exit;
+	}
+
+	pipe->flags &= ~PIPE_FLAG_WRITE_CLAIM;
+	if (len != 0) {
+		/* readers waiting for a direct copy retry from the buffer */
+		need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
+#ifdef CONFIG_POLL
+		need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
+							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+exit:
+	fast_path_enable(pipe);
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len, k_timeout_t timeout)
+{
+	/* writers never copy data directly to a claiming reader */
+	struct pipe_buf_spec buf = { NULL, 0, 0 };
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+	int rc;
+
+	fast_path_disable(pipe);
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	if ((pipe->flags & PIPE_FLAG_READ_CLAIM) != 0) {
+		rc = -EBUSY;
+		goto exit;
+	}
+
+	if (pipe->buf.size == 0) {
+		rc = -ENOTSUP;
+		goto exit;
+	}
+
+	for (;;) {
+		rc = ring_buf_get_claim(&pipe->buf, data, len);
+		if ((rc > 0) || (len == 0)) {
+			pipe->flags |= PIPE_FLAG_READ_CLAIM;
+			break;
+		}
+
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		_current->base.swap_data = &buf;
+
+		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	fast_path_enable(pipe);
+	k_spin_unlock(&pipe->lock, key);
+	return rc;
+}
+
+int k_pipe_read_commit(struct k_pipe *pipe, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool was_full = pipe_full(pipe);
+	bool need_resched = false;
+	int rc = -EINVAL;
+
+	if ((pipe->flags & PIPE_FLAG_READ_CLAIM) == 0) {
+		goto exit;
+	}
+
+	rc = ring_buf_get_finish(&pipe->buf, len);
+	if (rc != 0) {
+		goto exit;
+	}
+
+	pipe->flags &= ~PIPE_FLAG_READ_CLAIM;
+	if ((len != 0) && was_full) {
+		/* One or more pending writers may exist. */
+		need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+	}
+exit:
+	fast_path_enable(pipe);
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
 void z_impl_k_pipe_reset(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, reset, pipe);
 	K_SPINLOCK(&pipe->lock) {
+		fast_path_disable(pipe);
 		ring_buf_reset(&pipe->buf);
+		/* outstanding claims point to discarded data */
+		pipe->flags &= ~(PIPE_FLAG_WRITE_CLAIM | PIPE_FLAG_READ_CLAIM);
 		if (likely(pipe->waiting != 0)) {
 			pipe->flags |= PIPE_FLAG_RESET;
 			z_sched_wake_all(&pipe->data, 0, NULL);
 			z_sched_wake_all(&pipe->space, 0, NULL);
 		}
+		fast_path_enable(pipe);
 	}
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, reset, pipe);
 }
@@ -288,6 +645,8 @@ void z_impl_k_pipe_close(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, close, pipe);
 	K_SPINLOCK(&pipe->lock) {
+		/* for good, the pipe can't be reopened */
+		fast_path_disable(pipe);
 		pipe->flags = 0;
 		z_sched_wake_all(&pipe->data, 0, NULL);
 		z_sched_wake_all(&pipe->space, 0, NULL);
@@ -17,6 +17,24 @@
 static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 			     CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
 
+#if CONFIG_SYSTEM_WORKQUEUE_WORKERS > 1
+#define SYS_WORK_Q_EXTRA_WORKERS (CONFIG_SYSTEM_WORKQUEUE_WORKERS - 1)
+
+static K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_worker_stacks, SYS_WORK_Q_EXTRA_WORKERS,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+static struct k_thread sys_work_q_workers[SYS_WORK_Q_EXTRA_WORKERS];
+
+/* Worker N runs on CPU N if pinning is enabled */
+static uint32_t sys_work_q_cpu_mask(unsigned int worker)
+{
+	if (!IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_WORKERS_CPU_PIN)) {
+		return 0;
+	}
+
+	return BIT(worker % arch_num_cpus());
+}
+#endif /* CONFIG_SYSTEM_WORKQUEUE_WORKERS > 1 */
+
 struct k_work_q k_sys_work_q;
 
 static int k_sys_work_q_init(void)
@@ -26,12 +44,26 @@ static int k_sys_work_q_init(void)
 		.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
 		.essential = true,
 		.work_timeout_ms = CONFIG_SYSTEM_WORKQUEUE_WORK_TIMEOUT_MS,
+#if CONFIG_SYSTEM_WORKQUEUE_WORKERS > 1
+		.cpu_mask = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_WORKERS_CPU_PIN) ? BIT(0) : 0,
+#endif /* CONFIG_SYSTEM_WORKQUEUE_WORKERS > 1 */
 	};
 
 	k_work_queue_start(&k_sys_work_q,
 			    sys_work_q_stack,
 			    K_KERNEL_STACK_SIZEOF(sys_work_q_stack),
 			    CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+
+#if CONFIG_SYSTEM_WORKQUEUE_WORKERS > 1
+	for (unsigned int i = 0; i < SYS_WORK_Q_EXTRA_WORKERS; i++) {
+		(void)k_work_queue_add_worker(&k_sys_work_q, &sys_work_q_workers[i],
+					      sys_work_q_worker_stacks[i],
+					      K_KERNEL_STACK_SIZEOF(sys_work_q_worker_stacks[i]),
+					      CONFIG_SYSTEM_WORKQUEUE_PRIORITY,
+					      sys_work_q_cpu_mask(i + 1));
+	}
+#endif /* CONFIG_SYSTEM_WORKQUEUE_WORKERS > 1 */
+
 	return 0;
 }
 
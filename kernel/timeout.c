@@ -15,8 +15,6 @@
 
 static uint64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
  * shall it call any other subsystem while holding this lock.
@@ -38,6 +36,118 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+/*
+ * Pending timeouts are kept in a red/black tree sorted by their absolute
+ * expiry tick, which is stored in dticks while the timeout is queued.
+ * Timeouts expiring on the same tick are ordered by insertion, like in the
+ * delta list. The earliest timeout is cached so that reading the next
+ * expiry and expiring timeouts does not need to walk the tree.
+ */
+static bool timeout_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	struct _timeout *ta = CONTAINER_OF(a, struct _timeout, node);
+	struct _timeout *tb = CONTAINER_OF(b, struct _timeout, node);
+
+	if (ta->dticks != tb->dticks) {
+		return ta->dticks < tb->dticks;
+	}
+
+	return ta->order_key < tb->order_key;
+}
+
+static struct rbtree timeout_tree = {
+	.lessthan_fn = timeout_lessthan,
+};
+
+static struct _timeout *timeout_first;
+
+static uint32_t next_order_key;
+
+static struct _timeout *first(void)
+{
+	return timeout_first;
+}
+
+static void insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	struct _timeout *t;
+
+	to->dticks = curr_tick + dticks;
+	to->order_key = next_order_key;
+	++next_order_key;
+
+	/* Renumber at wraparound, see z_priq_rb_add().  The new timeout
+	 * keeps the largest key and sorts after everything renumbered.
+	 */
+	if (next_order_key == 0U) {
+		RB_FOR_EACH_CONTAINER(&timeout_tree, t, node) {
+			t->order_key = next_order_key;
+			++next_order_key;
+		}
+	}
+
+	rb_insert(&timeout_tree, &to->node);
+
+	if ((timeout_first == NULL) ||
+	    timeout_lessthan(&to->node, &timeout_first->node)) {
+		timeout_first = to;
+	}
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	rb_remove(&timeout_tree, &t->node);
+
+	if (t == timeout_first) {
+		struct rbnode *n = rb_get_min(&timeout_tree);
+
+		timeout_first = (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
+	}
+
+	if (timeout_tree.root == NULL) {
+		next_order_key = 0U;
+	}
+
+	/* Mark as inactive, see z_is_inactive_timeout() */
+	t->dticks = 0;
+}
+
+static void expire_timeout(struct _timeout *t)
+{
+	remove_timeout(t);
+}
+
+/* Ticks from curr_tick until the timeout expires, must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout->dticks - curr_tick;
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Ticks from curr_tick until the queue must be serviced, see wakeup_rem() */
+static int64_t deadline_rem(void)
+{
+	struct _timeout *t;
+	int64_t ret = INT64_MAX;
+
+	RB_FOR_EACH_CONTAINER(&timeout_tree, t, node) {
+		int64_t rem = timeout_rem(t);
+
+		if (rem >= ret) {
+			break;
+		}
+		ret = MIN(ret, rem + t->slack);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+#else
+
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -52,6 +162,26 @@ static struct _timeout *next(struct _timeout *t)
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
+static void insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	struct _timeout *t;
+
+	to->dticks = dticks;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+}
+
 static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
@@ -61,6 +191,48 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+/* Removes the head of the list once curr_tick has been advanced to it */
+static void expire_timeout(struct _timeout *t)
+{
+	t->dticks = 0;
+	remove_timeout(t);
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Ticks from curr_tick until the queue must be serviced, see wakeup_rem() */
+static int64_t deadline_rem(void)
+{
+	int64_t rem = 0;
+	int64_t ret = INT64_MAX;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		rem += t->dticks;
+		if (rem >= ret) {
+			break;
+		}
+		ret = MIN(ret, rem + t->slack);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -82,21 +254,56 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
+/* Ticks from curr_tick until the timeout queue needs to be serviced.
+ *
+ * Without slack this is when the first timeout expires.  With slack it is
+ * the earliest expiry plus slack of all pending timeouts: waking up then
+ * still honours every deadline, and expires everything that became due in
+ * the meantime in a single announcement.  Only timeouts expiring before
+ * the best deadline found so far can improve it, so the walk stops early.
+ *
+ * Must be locked, and the queue must not be empty.
+ */
+static int64_t wakeup_rem(void)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	return deadline_rem();
+#else
+	return timeout_rem(first());
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
 static int32_t next_timeout(int32_t ticks_elapsed)
 {
-	struct _timeout *to = first();
+	int64_t rem = (first() == NULL) ? INT64_MAX : (wakeup_rem() - ticks_elapsed);
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if (rem > (int64_t)INT_MAX) {
 		ret = SYS_CLOCK_MAX_WAIT;
 	} else {
-		ret = max(0, to->dticks - ticks_elapsed);
+		ret = max(0, rem);
 	}
 
 	return ret;
 }
 
+/* Whether adding the timeout moved the next wakeup earlier, must be locked
+ *
+ * @param to the timeout that was just added
+ * @param prev_wakeup wakeup_rem() before it was added, INT64_MAX if the
+ *        queue was empty
+ */
+static bool wakeup_moved(struct _timeout *to, int64_t prev_wakeup)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	return ((int64_t)timeout_rem(to) + to->slack) < prev_wakeup;
+#else
+	ARG_UNUSED(prev_wakeup);
+
+	return to == first();
+#endif /* CONFIG_TIMEOUT_SLACK */
+}
+
 k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
 {
 	k_ticks_t ticks = 0;
@@ -109,40 +316,33 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	__ASSERT_NO_MSG(sys_cache_is_mem_coherent(to));
 #endif /* CONFIG_KERNEL_COHERENCE */
 
-	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	__ASSERT(z_is_inactive_timeout(to), "");
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+		k_ticks_t dticks;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
+		int64_t prev_wakeup = INT64_MAX;
+
+		if (IS_ENABLED(CONFIG_TIMEOUT_SLACK) && (first() != NULL)) {
+			prev_wakeup = wakeup_rem();
+		}
 
 		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
 			ticks_elapsed = elapsed();
 			has_elapsed = true;
-			to->dticks = timeout.ticks + 1 + ticks_elapsed;
-			ticks = curr_tick + to->dticks;
+			dticks = timeout.ticks + 1 + ticks_elapsed;
+			ticks = curr_tick + dticks;
 		} else {
-			k_ticks_t dticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
-
-			to->dticks = max(1, dticks);
+			dticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
+			dticks = max(1, dticks);
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		insert_timeout(to, dticks);
 
-		if (to == first() && announce_remaining == 0) {
+		if (wakeup_moved(to, prev_wakeup) && announce_remaining == 0) {
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
@@ -161,7 +361,7 @@ int z_abort_timeout(struct _timeout *to)
 	int ret = -EINVAL;
 
 	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
+		if (!z_is_inactive_timeout(to)) {
 			bool is_first = (to == first());
 
 			remove_timeout(to);
@@ -176,21 +376,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -251,13 +436,12 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (timeout_rem(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = timeout_rem(t);
 
 		curr_tick += dt;
-		t->dticks = 0;
-		remove_timeout(t);
+		expire_timeout(t);
 
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
@@ -265,9 +449,11 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
+#ifndef CONFIG_TIMEOUT_QUEUE_SCALABLE
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -14,7 +14,9 @@
 #include <zephyr/kernel_structs.h>
 #include <wait_q.h>
 #include <zephyr/spinlock.h>
+#include <zephyr/init.h>
 #include <errno.h>
+#include <string.h>
 #include <ksched.h>
 #include <zephyr/sys/printk.h>
 #include <zephyr/logging/log.h>
@@ -65,6 +67,160 @@ static inline uint32_t flags_get(const uint32_t *flagp)
  */
 static struct k_spinlock lock;
 
+#ifdef CONFIG_OBJ_CORE_WORK_Q
+static struct k_obj_type obj_type_work_q;
+
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+static int work_q_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_work_q *queue = CONTAINER_OF(obj_core, struct k_work_q, obj_core);
+
+	K_SPINLOCK(&lock) {
+		memcpy(stats, &queue->stats, sizeof(queue->stats));
+	}
+
+	return 0;
+}
+
+static int work_q_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_work_q *queue = CONTAINER_OF(obj_core, struct k_work_q, obj_core);
+
+	K_SPINLOCK(&lock) {
+		queue->stats = (struct k_work_q_stats) {
+			.depth = queue->stats.depth,
+			.max_depth = queue->stats.depth,
+		};
+	}
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc work_q_stats_desc = {
+	.raw_size = sizeof(struct k_work_q_stats),
+	.query_size = sizeof(struct k_work_q_stats),
+	.raw   = work_q_stats_raw,
+	.query = work_q_stats_raw,
+	.reset = work_q_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+
+static int init_work_q_obj_core_list(void)
+{
+	z_obj_type_init(&obj_type_work_q, K_OBJ_TYPE_WORK_Q_ID,
+			offsetof(struct k_work_q, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+	k_obj_type_stats_init(&obj_type_work_q, &work_q_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+
+	return 0;
+}
+
+SYS_INIT(init_work_q_obj_core_list, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+
+static void work_q_obj_core_link(struct k_work_q *queue)
+{
+	k_obj_core_init_and_link(K_OBJ_CORE(queue), &obj_type_work_q);
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+	k_obj_core_stats_register(K_OBJ_CORE(queue), &queue->stats,
+				  sizeof(struct k_work_q_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+}
+
+static void work_q_obj_core_unlink(struct k_work_q *queue)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+	k_obj_core_stats_deregister(K_OBJ_CORE(queue));
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+	k_obj_core_unlink(K_OBJ_CORE(queue));
+}
+#else
+static inline void work_q_obj_core_link(struct k_work_q *queue) { }
+static inline void work_q_obj_core_unlink(struct k_work_q *queue) { }
+#endif /* CONFIG_OBJ_CORE_WORK_Q */
+
+/* Cycle counter used for the queue statistics, as wide as the hardware
+ * allows so that long waits don't wrap.
+ */
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+typedef uint64_t stats_cycles_t;
+#else
+typedef uint32_t stats_cycles_t;
+#endif /* CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER */
+
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+static inline stats_cycles_t stats_now(void)
+{
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+	return k_cycle_get_64();
+#else
+	return k_cycle_get_32();
+#endif /* CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER */
+}
+
+/* Account for an item added to the pending list of a queue.
+ *
+ * Invoked with work lock held.
+ */
+static void stats_queued_locked(struct k_work_q *queue, struct k_work *work)
+{
+	work->queued_cycles = stats_now();
+	queue->stats.depth++;
+	queue->stats.max_depth = MAX(queue->stats.max_depth, queue->stats.depth);
+}
+
+/* Account for an item removed from the pending list without running.
+ *
+ * Invoked with work lock held.
+ */
+static void stats_removed_locked(struct k_work_q *queue)
+{
+	queue->stats.depth--;
+}
+
+/* Account for an item taken from the pending list to be run.
+ *
+ * Invoked with work lock held.
+ */
+static void stats_started_locked(struct k_work_q *queue, struct k_work *work,
+				 stats_cycles_t now)
+{
+	stats_cycles_t wait = now - work->queued_cycles;
+
+	queue->stats.depth--;
+	queue->stats.wait_cycles += wait;
+	queue->stats.max_wait_cycles = MAX(queue->stats.max_wait_cycles, wait);
+}
+
+/* Account for an item that finished running.
+ *
+ * Invoked with work lock held.
+ */
+static void stats_completed_locked(struct k_work_q *queue, stats_cycles_t exec)
+{
+	queue->stats.completed++;
+	queue->stats.exec_cycles += exec;
+	queue->stats.max_exec_cycles = MAX(queue->stats.max_exec_cycles, exec);
+}
+#else
+static inline void stats_queued_locked(struct k_work_q *queue, struct k_work *work) { }
+static inline void stats_removed_locked(struct k_work_q *queue) { }
+static inline void stats_started_locked(struct k_work_q *queue, struct k_work *work,
+					stats_cycles_t now) { }
+static inline void stats_completed_locked(struct k_work_q *queue, stats_cycles_t exec) { }
+static inline stats_cycles_t stats_now(void)
+{
+	return 0;
+}
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+
 /* Invoked by work thread */
 static void handle_flush(struct k_work *work) { }
 
@@ -192,6 +348,10 @@ static void queue_flusher_locked(struct k_work_q *queue,
 				 struct z_work_flusher *flusher)
 {
 	init_flusher(flusher);
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	flusher->target = work;
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+	stats_queued_locked(queue, &flusher->work);
 
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
 		sys_slist_insert(&queue->pending, &work->node,
@@ -212,8 +372,32 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
-		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
+		if (sys_slist_find_and_remove(&queue->pending, &work->node)) {
+			stats_removed_locked(queue);
+		}
+	}
+}
+
+/* Check whether a thread is one of the workers of a queue.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool is_queue_worker_locked(const struct k_work_q *queue,
+					  const struct k_thread *thread)
+{
+	if (thread == queue->thread_id) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	for (unsigned int i = 0; i < queue->num_workers; i++) {
+		if (thread == queue->workers[i]) {
+			return true;
+		}
 	}
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+
+	return false;
 }
 
 /* Potentially notify a queue that it needs to look for pending work.
@@ -265,7 +449,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
-	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+	bool chained = is_queue_worker_locked(queue, _current) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -284,6 +468,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 		ret = -EBUSY;
 	} else {
 		sys_slist_append(&queue->pending, &work->node);
+		stats_queued_locked(queue, work);
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -648,6 +833,123 @@ static void work_timeout_stop_locked(struct k_work_q *queue)
 }
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+/* Check whether a pending item may be taken by a worker.
+ *
+ * An item that another worker is still running stays on the pending list
+ * until that worker is done, which keeps handlers from being re-entered.
+ * Likewise a flusher stays on the list until the item it flushes is done.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool work_runnable_locked(struct k_work *work)
+{
+	if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+		work = CONTAINER_OF(work, struct z_work_flusher, work)->target;
+	}
+
+	return !flag_test(&work->flags, K_WORK_RUNNING_BIT);
+}
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+
+/* Take the next item to run off the pending list of a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @return the work item, or NULL if no pending item can be run now.
+ */
+static struct k_work *queue_next_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	struct k_work *work;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->pending, work, node) {
+		if (work_runnable_locked(work)) {
+			sys_slist_remove(&queue->pending, prev, &work->node);
+
+			/* Let another idle worker pick up what remains */
+			if (!sys_slist_is_empty(&queue->pending)) {
+				(void)notify_queue_locked(queue);
+			}
+
+			return work;
+		}
+		prev = &work->node;
+	}
+
+	return NULL;
+#else
+	sys_snode_t *node = sys_slist_get(&queue->pending);
+
+	/* The only way for work to be NULL with a non-NULL node would be
+	 * for node to be a member of a struct k_work placed at address
+	 * NULL, which should never happen.
+	 */
+	return (node != NULL) ? CONTAINER_OF(node, struct k_work, node) : NULL;
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+}
+
+/* Mark that a worker of the queue is running an item that is not on the
+ * pending list.
+ *
+ * Invoked with work lock held.
+ */
+static inline void queue_busy_set_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	queue->num_busy++;
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+	flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+/* Mark that a worker of the queue finished running an item.
+ *
+ * Invoked with work lock held.
+ */
+static inline void queue_busy_clear_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	queue->num_busy--;
+	if (queue->num_busy != 0U) {
+		return;
+	}
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+	flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+/* Check whether all work of the queue is done.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool queue_idle_locked(struct k_work_q *queue)
+{
+	return sys_slist_is_empty(&queue->pending) &&
+	       !flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+/* Account for a worker leaving the queue after a stop request.
+ *
+ * Invoked with work lock held.
+ *
+ * @retval true if this was the last worker of the queue.
+ */
+static inline bool queue_worker_exit_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	queue->num_active--;
+	if (queue->num_active != 0U) {
+		/* Workers that went back to sleep while others were busy
+		 * need to see the stop request too.
+		 */
+		(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+		return false;
+	}
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+
+	return true;
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -660,36 +962,28 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
 
 	while (true) {
-		sys_snode_t *node;
-		struct k_work *work = NULL;
+		struct k_work *work;
 		k_work_handler_t handler = NULL;
 		k_spinlock_key_t key = k_spin_lock(&lock);
+		stats_cycles_t start;
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
-		if (node != NULL) {
+		work = queue_next_locked(queue);
+		if (work != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
-			work = CONTAINER_OF(node, struct k_work, node);
+			queue_busy_set_locked(queue);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
-
-			/* Static code analysis tool can raise a false-positive violation
-			 * in the line below that 'work' is checked for null after being
-			 * dereferenced.
-			 *
-			 * The work is figured out by CONTAINER_OF, as a container
-			 * of type struct k_work that contains the node.
-			 * The only way for it to be NULL is if node would be a member
-			 * of struct k_work object that has been placed at address NULL,
-			 * which should never happen, even line 'if (work != NULL)'
-			 * ensures that.
-			 * This means that if node is not NULL, then work will not be NULL.
-			 */
 			handler = work->handler;
+		} else if (!queue_idle_locked(queue)) {
+			/* Other workers are still busy, either with items
+			 * of their own or with ones blocking what is left
+			 * on the pending list.
+			 */
+			;
 		} else if (flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
@@ -705,7 +999,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
-			flags_set(&queue->flags, 0);
+			if (queue_worker_exit_locked(queue)) {
+				flags_set(&queue->flags, 0);
+			}
 			k_spin_unlock(&lock, key);
 			return;
 		} else {
@@ -731,6 +1027,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		work_timeout_start_locked(queue, work);
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+		start = stats_now();
+		stats_started_locked(queue, work, start);
+
 		k_spin_unlock(&lock, key);
 
 		__ASSERT_NO_MSG(handler != NULL);
@@ -747,6 +1046,8 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		work_timeout_stop_locked(queue);
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+		stats_completed_locked(queue, stats_now() - start);
+
 		flag_clear(&work->flags, K_WORK_RUNNING_BIT);
 		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
 			finalize_flush_locked(work);
@@ -755,7 +1056,7 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		queue_busy_clear_locked(queue);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -779,6 +1080,38 @@ void k_work_queue_init(struct k_work_q *queue)
 	SYS_PORT_TRACING_OBJ_INIT(k_work_queue, queue);
 }
 
+/* Reset the worker and statistics state of a queue being started.
+ *
+ * @param queue the queue that is not yet started
+ */
+static void queue_workers_init(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	queue->num_workers = 0U;
+	queue->num_busy = 0U;
+	queue->num_active = 1U;
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+	queue->stats = (struct k_work_q_stats) {0};
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+/* Restrict a work queue thread that has not been started yet to a set of
+ * CPUs.
+ */
+static void worker_cpu_mask_set(k_tid_t thread, uint32_t cpu_mask)
+{
+	(void)k_thread_cpu_mask_clear(thread);
+
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		if ((cpu_mask & BIT(cpu)) != 0U) {
+			(void)k_thread_cpu_mask_enable(thread, cpu);
+		}
+	}
+}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *cfg)
 {
 	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
@@ -804,7 +1137,9 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+	queue_workers_init(queue);
 	queue->thread_id = _current;
+	work_q_obj_core_link(queue);
 	flags_set(&queue->flags, flags);
 	work_queue_main(queue, NULL, NULL);
 }
@@ -826,6 +1161,7 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+	queue_workers_init(queue);
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -849,6 +1185,12 @@ void k_work_queue_start(struct k_work_q *queue,
 		queue->thread.base.user_options |= K_ESSENTIAL;
 	}
 
+#ifdef CONFIG_SCHED_CPU_MASK
+	if ((cfg != NULL) && (cfg->cpu_mask != 0U)) {
+		worker_cpu_mask_set(&queue->thread, cfg->cpu_mask);
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 #if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
 	if ((cfg != NULL) && (cfg->work_timeout_ms)) {
 		queue->work_timeout = K_MSEC(cfg->work_timeout_ms);
@@ -857,12 +1199,76 @@ void k_work_queue_start(struct k_work_q *queue,
 	}
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+	work_q_obj_core_link(queue);
+
 	k_thread_start(&queue->thread);
 	queue->thread_id = &queue->thread;
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+int k_work_queue_add_worker(struct k_work_q *queue, struct k_thread *thread,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int prio, uint32_t cpu_mask)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(thread);
+	__ASSERT_NO_MSG(stack);
+
+	int ret = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT) ||
+	    flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
+		ret = -ENODEV;
+	} else if (queue->num_workers == ARRAY_SIZE(queue->workers)) {
+		ret = -ENOMEM;
+	} else {
+		/* Reserve the slot, the worker can't be woken before it
+		 * is started.
+		 */
+		queue->workers[queue->num_workers] = thread;
+		queue->num_workers++;
+		queue->num_active++;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	(void)k_thread_create(thread, stack, stack_size,
+			      work_queue_main, queue, NULL, NULL,
+			      prio, 0, K_FOREVER);
+
+#ifdef CONFIG_THREAD_NAME
+	const char *name = k_thread_name_get(queue->thread_id);
+
+	if (name != NULL) {
+		k_thread_name_set(thread, name);
+	}
+#endif /* CONFIG_THREAD_NAME */
+
+	if (z_is_thread_essential(queue->thread_id)) {
+		thread->base.user_options |= K_ESSENTIAL;
+	}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (cpu_mask != 0U) {
+		worker_cpu_mask_set(thread, cpu_mask);
+	}
+#else
+	ARG_UNUSED(cpu_mask);
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	k_thread_start(thread);
+
+	return 0;
+}
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -915,6 +1321,27 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+/* Wait for all threads of a stopping queue to exit.
+ *
+ * @retval 0 if all threads exited
+ * @retval nonzero if the timeout expired first
+ */
+static int queue_join_workers(struct k_work_q *queue, k_timeout_t timeout)
+{
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret = k_thread_join(queue->thread_id, timeout);
+
+	for (unsigned int i = 0; (ret == 0) && (i < queue->num_workers); i++) {
+		ret = k_thread_join(queue->workers[i], sys_timepoint_timeout(end));
+	}
+
+	return ret;
+#else
+	return k_thread_join(queue->thread_id, timeout);
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+}
+
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 {
 	__ASSERT_NO_MSG(queue);
@@ -940,10 +1367,14 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	}
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+	(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+#else
 	notify_queue_locked(queue);
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(queue->thread_id, timeout)) {
+	if (queue_join_workers(queue, timeout)) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
@@ -951,6 +1382,8 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 		return -ETIMEDOUT;
 	}
 
+	work_q_obj_core_unlink(queue);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, stop, queue, timeout, 0);
 	return 0;
 }
@@ -1035,12 +1468,15 @@ int k_work_delayable_busy_get(const struct k_work_delayable *dwork)
  *
  * @param delay the delay to use before scheduling.
  *
+ * @param slack how late the submission may happen, see z_timeout_slack_set().
+ *
  * @retval from submit_to_queue_locked() if delay is K_NO_WAIT; otherwise
  * @retval 1 to indicate successfully scheduled.
  */
 static int schedule_for_queue_locked(struct k_work_q **queuep,
 				     struct k_work_delayable *dwork,
-				     k_timeout_t delay)
+				     k_timeout_t delay,
+				     k_timeout_t slack)
 {
 	int ret = 1;
 	struct k_work *work = &dwork->work;
@@ -1053,6 +1489,7 @@ static int schedule_for_queue_locked(struct k_work_q **queuep,
 	dwork->queue = *queuep;
 
 	/* Add timeout */
+	z_timeout_slack_set(&dwork->timeout, slack);
 	z_add_timeout(&dwork->timeout, work_timeout, delay);
 
 	return ret;
@@ -1105,6 +1542,26 @@ static int cancel_delayable_async_locked(struct k_work_delayable *dwork)
 	return cancel_async_locked(&dwork->work);
 }
 
+/* Schedule a delayable work item if it's idle or running.
+ *
+ * Takes and releases work lock.
+ */
+static int schedule_if_idle(struct k_work_q *queue, struct k_work_delayable *dwork,
+			    k_timeout_t delay, k_timeout_t slack)
+{
+	struct k_work *work = &dwork->work;
+	int ret = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if ((work_busy_get_locked(work) & ~K_WORK_RUNNING) == 0U) {
+		ret = schedule_for_queue_locked(&queue, dwork, delay, slack);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
 int k_work_schedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork,
 			      k_timeout_t delay)
 {
@@ -1113,22 +1570,40 @@ int k_work_schedule_for_queue(struct k_work_q *queue, struct k_work_delayable *d
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule_for_queue, queue, dwork, delay);
 
-	struct k_work *work = &dwork->work;
-	int ret = 0;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = schedule_if_idle(queue, dwork, delay, K_NO_WAIT);
 
-	/* Schedule the work item if it's idle or running. */
-	if ((work_busy_get_locked(work) & ~K_WORK_RUNNING) == 0U) {
-		ret = schedule_for_queue_locked(&queue, dwork, delay);
-	}
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, schedule_for_queue, queue, dwork, delay, ret);
 
-	k_spin_unlock(&lock, key);
+	return ret;
+}
+
+int k_work_schedule_for_queue_slack(struct k_work_q *queue, struct k_work_delayable *dwork,
+				    k_timeout_t delay, k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(queue != NULL);
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule_for_queue, queue, dwork, delay);
+
+	int ret = schedule_if_idle(queue, dwork, delay, slack);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, schedule_for_queue, queue, dwork, delay, ret);
 
 	return ret;
 }
 
+int k_work_schedule_slack(struct k_work_delayable *dwork, k_timeout_t delay,
+			  k_timeout_t slack)
+{
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule, dwork, delay);
+
+	int ret = k_work_schedule_for_queue_slack(&k_sys_work_q, dwork, delay, slack);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, schedule, dwork, delay, ret);
+
+	return ret;
+}
+
 int k_work_schedule(struct k_work_delayable *dwork, k_timeout_t delay)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, schedule, dwork, delay);
@@ -1155,7 +1630,7 @@ int k_work_reschedule_for_queue(struct k_work_q *queue, struct k_work_delayable
 	(void)unschedule_locked(dwork);
 
 	/* Schedule the work item with the new parameters. */
-	ret = schedule_for_queue_locked(&queue, dwork, delay);
+	ret = schedule_for_queue_locked(&queue, dwork, delay, K_NO_WAIT);
 
 	k_spin_unlock(&lock, key);
 
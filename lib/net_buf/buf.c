@@ -241,6 +241,244 @@ static uint8_t *data_ref(struct net_buf *buf, uint8_t *data)
 	return pool->alloc->cb->ref(buf, data);
 }
 
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+
+BUILD_ASSERT(CONFIG_NET_BUF_POOL_CACHE_BATCH <= CONFIG_NET_BUF_POOL_CACHE_DEPTH,
+	     "NET_BUF_POOL_CACHE_BATCH must not exceed NET_BUF_POOL_CACHE_DEPTH");
+
+/* Smallest pool using the caches, so that the caches can never hold
+ * more than half of the buffers of a pool.
+ */
+#define CACHE_MIN_BUF_COUNT \
+	(2 * CONFIG_MP_MAX_NUM_CPUS * CONFIG_NET_BUF_POOL_CACHE_DEPTH)
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+#define CACHE_STAT(cache, stmt) ((cache)->stmt)
+#else
+#define CACHE_STAT(cache, stmt) do { } while (false)
+#endif
+
+static inline bool pool_is_cached(struct net_buf_pool *pool)
+{
+	return pool->buf_count >= CACHE_MIN_BUF_COUNT;
+}
+
+static inline struct net_buf_pool_cache *curr_cache(struct net_buf_pool *pool)
+{
+	/* Being migrated right after reading the CPU id is harmless: the
+	 * cache has its own lock, we just end up using a peer's cache.
+	 */
+	return &pool->cache[arch_curr_cpu()->id];
+}
+
+static struct net_buf *cache_get(struct net_buf_pool *pool)
+{
+	struct net_buf_pool_cache *cache;
+	k_spinlock_key_t key;
+	sys_slist_t batch;
+	sys_snode_t *node;
+	struct net_buf *buf;
+	uint16_t n;
+
+	if (!pool_is_cached(pool)) {
+		return NULL;
+	}
+
+	cache = curr_cache(pool);
+
+	key = k_spin_lock(&cache->lock);
+	node = sys_slist_get(&cache->free);
+	if (node != NULL) {
+		cache->count--;
+		CACHE_STAT(cache, hits++);
+	}
+	k_spin_unlock(&cache->lock, key);
+
+	if (node != NULL) {
+		return CONTAINER_OF(node, struct net_buf, node);
+	}
+
+	/* Empty cache, grab a batch of buffers from the pool. If there are
+	 * none, let the caller take the regular path, which initializes new
+	 * buffers, flushes the caches and waits as needed.
+	 */
+	buf = k_lifo_get(&pool->free, K_NO_WAIT);
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	sys_slist_init(&batch);
+	for (n = 1U; n < CONFIG_NET_BUF_POOL_CACHE_BATCH; n++) {
+		struct net_buf *extra = k_lifo_get(&pool->free, K_NO_WAIT);
+
+		if (extra == NULL) {
+			break;
+		}
+
+		sys_slist_append(&batch, &extra->node);
+	}
+
+	key = k_spin_lock(&cache->lock);
+	CACHE_STAT(cache, misses++);
+	CACHE_STAT(cache, refills++);
+	/* Concurrent frees may have refilled the cache in the meantime, it
+	 * then briefly holds more than the configured depth.
+	 */
+	sys_slist_merge_slist(&cache->free, &batch);
+	cache->count += n - 1U;
+	k_spin_unlock(&cache->lock, key);
+
+	return buf;
+}
+
+void net_buf_pool_cache_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	struct net_buf_pool_cache *cache;
+	k_spinlock_key_t key;
+	sys_slist_t batch;
+
+	if (!pool_is_cached(pool)) {
+		k_lifo_put(&pool->free, buf);
+		return;
+	}
+
+	cache = curr_cache(pool);
+
+	key = k_spin_lock(&cache->lock);
+
+	/* Feed the pool directly while somebody waits on it. A waiter is
+	 * registered before it flushes the caches, which takes this lock,
+	 * so either the flush picks up the buffer or we see the waiter.
+	 */
+	if (atomic_get(&pool->cache_waiters) != 0) {
+		k_spin_unlock(&cache->lock, key);
+		k_lifo_put(&pool->free, buf);
+		return;
+	}
+
+	if (cache->count < CONFIG_NET_BUF_POOL_CACHE_DEPTH) {
+		sys_slist_prepend(&cache->free, &buf->node);
+		cache->count++;
+		k_spin_unlock(&cache->lock, key);
+		return;
+	}
+
+	/* Full cache, return a batch of buffers to the pool */
+	sys_slist_init(&batch);
+	for (int i = 0; i < CONFIG_NET_BUF_POOL_CACHE_BATCH; i++) {
+		sys_slist_append(&batch, sys_slist_get_not_empty(&cache->free));
+	}
+	sys_slist_prepend(&cache->free, &buf->node);
+	cache->count -= CONFIG_NET_BUF_POOL_CACHE_BATCH - 1;
+	CACHE_STAT(cache, drains++);
+	k_spin_unlock(&cache->lock, key);
+
+	k_queue_merge_slist(&pool->free._queue, &batch);
+}
+
+void net_buf_pool_cache_flush(struct net_buf_pool *pool)
+{
+	__ASSERT_NO_MSG(pool);
+
+	if (!pool_is_cached(pool)) {
+		return;
+	}
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct net_buf_pool_cache *cache = &pool->cache[cpu];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+		sys_slist_t list = cache->free;
+
+		sys_slist_init(&cache->free);
+		cache->count = 0U;
+		k_spin_unlock(&cache->lock, key);
+
+		if (!sys_slist_is_empty(&list)) {
+			k_queue_merge_slist(&pool->free._queue, &list);
+		}
+	}
+}
+
+/* Register a thread about to wait on the pool, and make the buffers held
+ * by the per-CPU caches available to it. Frees bypass the caches until
+ * the matching cache_wait_end().
+ */
+static inline void cache_wait_begin(struct net_buf_pool *pool)
+{
+	atomic_inc(&pool->cache_waiters);
+	net_buf_pool_cache_flush(pool);
+}
+
+static inline void cache_wait_end(struct net_buf_pool *pool)
+{
+	atomic_dec(&pool->cache_waiters);
+}
+
+int net_buf_pool_cache_stats_get(struct net_buf_pool *pool,
+				 struct net_buf_pool_cache_stats *stats)
+{
+	if (pool == NULL || stats == NULL) {
+		return -EINVAL;
+	}
+
+	if (!IS_ENABLED(CONFIG_NET_BUF_POOL_USAGE)) {
+		return -ENOTSUP;
+	}
+
+	memset(stats, 0, sizeof(*stats));
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct net_buf_pool_cache *cache = &pool->cache[cpu];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		stats->hits += cache->hits;
+		stats->misses += cache->misses;
+		stats->refills += cache->refills;
+		stats->drains += cache->drains;
+		stats->cached += cache->count;
+		k_spin_unlock(&cache->lock, key);
+	}
+#endif
+
+	return 0;
+}
+
+#else /* CONFIG_NET_BUF_POOL_CACHE */
+
+static inline struct net_buf *cache_get(struct net_buf_pool *pool)
+{
+	ARG_UNUSED(pool);
+
+	return NULL;
+}
+
+void net_buf_pool_cache_flush(struct net_buf_pool *pool)
+{
+	ARG_UNUSED(pool);
+}
+
+static inline void cache_wait_begin(struct net_buf_pool *pool)
+{
+	ARG_UNUSED(pool);
+}
+
+static inline void cache_wait_end(struct net_buf_pool *pool)
+{
+	ARG_UNUSED(pool);
+}
+
+int net_buf_pool_cache_stats_get(struct net_buf_pool *pool,
+				 struct net_buf_pool_cache_stats *stats)
+{
+	ARG_UNUSED(pool);
+	ARG_UNUSED(stats);
+
+	return -ENOTSUP;
+}
+
+#endif /* CONFIG_NET_BUF_POOL_CACHE */
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -258,6 +496,11 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+	buf = cache_get(pool);
+	if (buf) {
+		goto success;
+	}
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -290,6 +533,11 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	k_spin_unlock(&pool->lock, key);
 
+	/* Make the buffers held by the per-CPU caches available before
+	 * waiting for one to be freed.
+	 */
+	cache_wait_begin(pool);
+
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
@@ -319,6 +567,7 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #else
 	buf = k_lifo_get(&pool->free, timeout);
 #endif
+	cache_wait_end(pool);
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
 		return NULL;
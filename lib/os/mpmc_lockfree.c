@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mpmc_lockfree.h>
+
+void mpmc_init(struct mpmc *q, struct mpmc_slot *slots, size_t sz)
+{
+	if (slots != NULL) {
+		__ASSERT(IS_POWER_OF_TWO(sz), "size %zu is not a power of 2", sz);
+
+		q->slots = slots;
+		q->mask = sz - 1;
+	}
+
+	/* Each slot starts out free for the first lap */
+	for (unsigned long i = 0; i <= q->mask; i++) {
+		atomic_set(&q->slots[i].seq, (atomic_val_t)i);
+		q->slots[i].data = NULL;
+	}
+
+	atomic_set(&q->head, 0);
+	atomic_set(&q->tail, 0);
+
+#ifdef CONFIG_MPMC_LOCKFREE_POLL
+	atomic_set(&q->waiters, 0);
+	k_poll_signal_init(&q->signal);
+#endif
+}
+
+#ifdef CONFIG_MPMC_LOCKFREE_POLL
+
+void mpmc_poll_prepare(struct mpmc *q, struct k_poll_event *event)
+{
+	/*
+	 * Producers raise the signal only when they see a waiter, so register
+	 * before looking at the queue: an object pushed from now on raises the
+	 * signal, one pushed before is seen below.
+	 */
+	atomic_inc(&q->waiters);
+	k_poll_signal_reset(&q->signal);
+
+	if (mpmc_count(q) != 0) {
+		(void)k_poll_signal_raise(&q->signal, 0);
+	}
+
+	k_poll_event_init(event, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &q->signal);
+}
+
+void *mpmc_poll_pop(struct mpmc *q)
+{
+	void *data;
+
+	atomic_dec(&q->waiters);
+
+	data = mpmc_pop(q);
+
+	/*
+	 * A signal raised for several objects only wakes a single waiter and
+	 * may have been reset by another consumer preparing to wait, so hand
+	 * the wakeup over while objects are left for the others.
+	 */
+	if ((data != NULL) && (mpmc_count(q) != 0)) {
+		z_mpmc_notify(q);
+	}
+
+	return data;
+}
+
+void *mpmc_pop_wait(struct mpmc *q, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_poll_event event;
+	void *data;
+
+	data = mpmc_pop(q);
+
+	while ((data == NULL) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		mpmc_poll_prepare(q, &event);
+		(void)k_poll(&event, 1, timeout);
+		data = mpmc_poll_pop(q);
+
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	return data;
+}
+
+#endif /* CONFIG_MPMC_LOCKFREE_POLL */
@@ -0,0 +1,560 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Each file descriptor of an interest set owns a triggered work item,
+ * registered with the k_poll events filled by its ZFD_IOCTL_POLL_PREPARE
+ * handler, exactly as zvfs_poll() would. When the file descriptor becomes
+ * ready the work handler moves it to the ready list of the instance and wakes
+ * up waiters, so that zvfs_epoll_wait() only ever looks at ready file
+ * descriptors. A file descriptor found no longer ready is armed again.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+
+#define ZVFS_EPOLL_IN_USE 0x1
+
+/* Events passed to zvfs_poll() to check a file descriptor */
+#define ZVFS_EPOLL_POLL_EVENTS (ZVFS_EPOLLIN | ZVFS_EPOLLPRI | ZVFS_EPOLLOUT)
+/* Events reported whether requested or not */
+#define ZVFS_EPOLL_ALWAYS_EVENTS (ZVFS_EPOLLERR | ZVFS_EPOLLHUP)
+
+/* One event to read and one to write, as registered by sockets and eventfds */
+#define ZVFS_EPOLL_ITEM_POLL_EVENTS 2
+
+enum zvfs_epoll_item_state {
+	/* Not watched: disabled after a one-shot event, or the fd failed */
+	ZVFS_EPOLL_ITEM_IDLE,
+	/* Triggered work registered, waiting for the fd to become ready */
+	ZVFS_EPOLL_ITEM_ARMED,
+	/* On the ready list */
+	ZVFS_EPOLL_ITEM_READY,
+	/* Edge-triggered and reported, waiting to be seen not ready */
+	ZVFS_EPOLL_ITEM_REPORTED,
+};
+
+struct zvfs_epoll;
+
+struct zvfs_epoll_item {
+	sys_dnode_t node;
+	struct zvfs_epoll *ep;
+	struct k_work_poll trigger;
+	struct k_poll_event poll_events[ZVFS_EPOLL_ITEM_POLL_EVENTS];
+	struct zvfs_epoll_event event;
+	int fd;
+	uint8_t state;
+};
+
+struct zvfs_epoll {
+	/* Serializes control operations and waiters */
+	struct k_mutex mutex;
+	/* Protects the ready list and item states against trigger handlers */
+	struct k_spinlock lock;
+	struct k_sem sem;
+	sys_dlist_t ready;
+	sys_dlist_t reported;
+	struct zvfs_epoll_item items[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	int flags;
+};
+
+/* Not part of the public API, see zvfs_poll.c */
+int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout);
+
+SYS_BITARRAY_DEFINE_STATIC(eps_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll eps[CONFIG_ZVFS_EPOLL_MAX];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static inline bool zvfs_epoll_is_in_use(struct zvfs_epoll *ep)
+{
+	return (ep->flags & ZVFS_EPOLL_IN_USE) != 0;
+}
+
+static struct zvfs_epoll_item *zvfs_epoll_find(struct zvfs_epoll *ep, int fd)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(ep->items); i++) {
+		if (ep->items[i].fd == fd) {
+			return &ep->items[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void zvfs_epoll_item_queue(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	k_spinlock_key_t key;
+	bool queued = false;
+
+	key = k_spin_lock(&ep->lock);
+
+	/* The item may have been disarmed while the handler was pending */
+	if (item->state == ZVFS_EPOLL_ITEM_ARMED) {
+		item->state = ZVFS_EPOLL_ITEM_READY;
+		sys_dlist_append(&ep->ready, &item->node);
+		queued = true;
+	}
+
+	k_spin_unlock(&ep->lock, key);
+
+	if (queued) {
+		k_sem_give(&ep->sem);
+	}
+}
+
+static void zvfs_epoll_trigger_handler(struct k_work *work)
+{
+	struct k_work_poll *trigger = CONTAINER_OF(work, struct k_work_poll, work);
+	struct zvfs_epoll_item *item = CONTAINER_OF(trigger, struct zvfs_epoll_item, trigger);
+
+	zvfs_epoll_item_queue(item->ep, item);
+}
+
+/* Must be called with the instance mutex held and the item not armed or ready */
+static int zvfs_epoll_item_arm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->event.events & ZVFS_EPOLL_POLL_EVENTS,
+	};
+	struct k_poll_event *pev = item->poll_events;
+	struct k_poll_event *pev_end = item->poll_events + ARRAY_SIZE(item->poll_events);
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	k_spinlock_key_t key;
+	void *obj;
+	int ret;
+
+	item->state = ZVFS_EPOLL_ITEM_IDLE;
+
+	obj = zvfs_get_fd_obj_and_vtable(item->fd, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zvfs_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_PREPARE, &pfd, &pev, pev_end);
+	k_mutex_unlock(lock);
+
+	if (ret == -EXDEV) {
+		/* Offloaded sockets only implement a one-shot poll */
+		return -EPERM;
+	} else if (ret < 0 && ret != -EALREADY) {
+		return ret;
+	}
+
+	key = k_spin_lock(&ep->lock);
+	item->state = ZVFS_EPOLL_ITEM_ARMED;
+	k_spin_unlock(&ep->lock, key);
+
+	if (ret == -EALREADY) {
+		zvfs_epoll_item_queue(ep, item);
+		return 0;
+	}
+
+	return k_work_poll_submit(&item->trigger, item->poll_events,
+				  pev - item->poll_events, K_FOREVER);
+}
+
+/* Must be called with the instance mutex held */
+static void zvfs_epoll_item_disarm(struct zvfs_epoll *ep, struct zvfs_epoll_item *item)
+{
+	struct k_work_sync sync;
+	k_spinlock_key_t key;
+	bool armed;
+
+	key = k_spin_lock(&ep->lock);
+
+	armed = item->state == ZVFS_EPOLL_ITEM_ARMED;
+	if (item->state == ZVFS_EPOLL_ITEM_READY || item->state == ZVFS_EPOLL_ITEM_REPORTED) {
+		sys_dlist_remove(&item->node);
+	}
+	item->state = ZVFS_EPOLL_ITEM_IDLE;
+
+	k_spin_unlock(&ep->lock, key);
+
+	if (armed && k_work_poll_cancel(&item->trigger) != 0) {
+		/* Already triggered, make sure the handler is done with the item */
+		(void)k_work_cancel_sync(&item->trigger.work, &sync);
+	}
+}
+
+static uint32_t zvfs_epoll_item_revents(struct zvfs_epoll_item *item)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->event.events & ZVFS_EPOLL_POLL_EVENTS,
+	};
+
+	if (zvfs_poll_internal(&pfd, 1, K_NO_WAIT) < 0) {
+		return ZVFS_EPOLLERR;
+	}
+
+	if ((pfd.revents & ZVFS_POLLNVAL) != 0) {
+		return 0;
+	}
+
+	return pfd.revents & (item->event.events | ZVFS_EPOLL_ALWAYS_EVENTS);
+}
+
+/* Must be called with the instance mutex held */
+static int zvfs_epoll_collect(struct zvfs_epoll *ep, struct zvfs_epoll_event *events,
+			      int maxevents)
+{
+	struct zvfs_epoll_item *item;
+	struct zvfs_epoll_item *next;
+	sys_dlist_t batch;
+	sys_dlist_t again;
+	sys_dnode_t *node;
+	k_spinlock_key_t key;
+	uint32_t revents;
+	bool more;
+	int n = 0;
+
+	/*
+	 * Reported edge-triggered items only go back to watching for the next
+	 * edge once they have been drained. Trigger handlers never touch them.
+	 */
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ep->reported, item, next, node) {
+		if (zvfs_epoll_item_revents(item) == 0) {
+			sys_dlist_remove(&item->node);
+			(void)zvfs_epoll_item_arm(ep, item);
+		}
+	}
+
+	sys_dlist_init(&batch);
+	sys_dlist_init(&again);
+
+	/* Items readied from now on are only looked at by the next call */
+	key = k_spin_lock(&ep->lock);
+	while ((node = sys_dlist_get(&ep->ready)) != NULL) {
+		sys_dlist_append(&batch, node);
+	}
+	k_spin_unlock(&ep->lock, key);
+
+	while (n < maxevents && (node = sys_dlist_get(&batch)) != NULL) {
+		item = CONTAINER_OF(node, struct zvfs_epoll_item, node);
+
+		revents = zvfs_epoll_item_revents(item);
+		if (revents == 0) {
+			/* Spurious or already consumed, wait for the next event */
+			(void)zvfs_epoll_item_arm(ep, item);
+			continue;
+		}
+
+		events[n].events = revents;
+		events[n].data = item->event.data;
+		n++;
+
+		if ((item->event.events & ZVFS_EPOLLONESHOT) != 0) {
+			item->state = ZVFS_EPOLL_ITEM_IDLE;
+		} else if ((item->event.events & ZVFS_EPOLLET) != 0) {
+			item->state = ZVFS_EPOLL_ITEM_REPORTED;
+			sys_dlist_append(&ep->reported, &item->node);
+		} else {
+			/* Level-triggered, report again for as long as it is ready */
+			sys_dlist_append(&again, &item->node);
+		}
+	}
+
+	/* Put back what did not fit ahead of newer items, and rotate the rest */
+	key = k_spin_lock(&ep->lock);
+	while ((node = sys_dlist_peek_tail(&batch)) != NULL) {
+		sys_dlist_remove(node);
+		sys_dlist_prepend(&ep->ready, node);
+	}
+	while ((node = sys_dlist_get(&again)) != NULL) {
+		sys_dlist_append(&ep->ready, node);
+	}
+	more = !sys_dlist_is_empty(&ep->ready);
+	k_spin_unlock(&ep->lock, key);
+
+	/* Let other waiters pick up what is left */
+	if (n > 0 && more) {
+		k_sem_give(&ep->sem);
+	}
+
+	return n;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+	int err;
+
+	(void)k_mutex_lock(&ep->mutex, K_FOREVER);
+
+	if (!zvfs_epoll_is_in_use(ep)) {
+		k_mutex_unlock(&ep->mutex);
+		errno = EBADF;
+		return -1;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(ep->items); i++) {
+		if (ep->items[i].fd >= 0) {
+			zvfs_epoll_item_disarm(ep, &ep->items[i]);
+			ep->items[i].fd = -1;
+		}
+	}
+
+	ep->flags = 0;
+
+	/* Wake up waiters so that they notice */
+	k_sem_reset(&ep->sem);
+
+	err = sys_bitarray_free(&eps_bitarray, 1, ep - eps);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	k_mutex_unlock(&ep->mutex);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	/* An epoll instance can not itself be polled */
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+/*
+ * Public-facing API
+ */
+
+int zvfs_epoll_create1(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&eps_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &eps[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&eps_bitarray, 1, offset);
+		return -1;
+	}
+
+	k_mutex_init(&ep->mutex);
+	k_sem_init(&ep->sem, 0, 1);
+	sys_dlist_init(&ep->ready);
+	sys_dlist_init(&ep->reported);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ep->items); i++) {
+		ep->items[i].ep = ep;
+		ep->items[i].fd = -1;
+		ep->items[i].state = ZVFS_EPOLL_ITEM_IDLE;
+		k_work_poll_init(&ep->items[i].trigger, zvfs_epoll_trigger_handler);
+	}
+
+	ep->flags = ZVFS_EPOLL_IN_USE;
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_create(int size)
+{
+	if (size <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	return zvfs_epoll_create1(0);
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event)
+{
+	const struct fd_op_vtable *vtable;
+	struct zvfs_epoll_item *item;
+	struct zvfs_epoll *ep;
+	int ret = 0;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (zvfs_get_fd_obj_and_vtable(fd, &vtable, NULL) == NULL) {
+		return -1;
+	}
+
+	if (vtable == &zvfs_epoll_fd_vtable) {
+		/* Nesting epoll instances is not supported */
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (op != ZVFS_EPOLL_CTL_DEL && event == NULL) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->mutex, K_FOREVER);
+
+	if (!zvfs_epoll_is_in_use(ep)) {
+		ret = -EBADF;
+		goto unlock;
+	}
+
+	item = zvfs_epoll_find(ep, fd);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (item != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		item = zvfs_epoll_find(ep, -1);
+		if (item == NULL) {
+			ret = -ENOSPC;
+			break;
+		}
+
+		item->fd = fd;
+		item->event = *event;
+
+		ret = zvfs_epoll_item_arm(ep, item);
+		if (ret < 0) {
+			zvfs_epoll_item_disarm(ep, item);
+			item->fd = -1;
+		}
+		break;
+
+	case ZVFS_EPOLL_CTL_MOD:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		zvfs_epoll_item_disarm(ep, item);
+		item->event = *event;
+
+		ret = zvfs_epoll_item_arm(ep, item);
+		break;
+
+	case ZVFS_EPOLL_CTL_DEL:
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		zvfs_epoll_item_disarm(ep, item);
+		item->fd = -1;
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+unlock:
+	k_mutex_unlock(&ep->mutex);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout)
+{
+	struct zvfs_epoll *ep;
+	k_timepoint_t end;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	if (maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+
+	while (true) {
+		(void)k_mutex_lock(&ep->mutex, K_FOREVER);
+
+		if (!zvfs_epoll_is_in_use(ep)) {
+			k_mutex_unlock(&ep->mutex);
+			errno = EBADF;
+			return -1;
+		}
+
+		ret = zvfs_epoll_collect(ep, events, maxevents);
+
+		k_mutex_unlock(&ep->mutex);
+
+		if (ret > 0) {
+			break;
+		}
+
+		/* Woken up by a trigger handler, or by close */
+		if (k_sem_take(&ep->sem, sys_timepoint_timeout(end)) != 0 &&
+		    sys_timepoint_expired(end)) {
+			break;
+		}
+	}
+
+	return ret;
+}
+
+void zvfs_epoll_fd_closed(int fd)
+{
+	struct zvfs_epoll_item *item;
+
+	for (size_t i = 0; i < ARRAY_SIZE(eps); i++) {
+		struct zvfs_epoll *ep = &eps[i];
+
+		if (!zvfs_epoll_is_in_use(ep)) {
+			continue;
+		}
+
+		(void)k_mutex_lock(&ep->mutex, K_FOREVER);
+
+		item = zvfs_epoll_is_in_use(ep) ? zvfs_epoll_find(ep, fd) : NULL;
+		if (item != NULL) {
+			zvfs_epoll_item_disarm(ep, item);
+			item->fd = -1;
+		}
+
+		k_mutex_unlock(&ep->mutex);
+	}
+}
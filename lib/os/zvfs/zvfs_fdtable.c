@@ -25,6 +25,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/fs/fs.h>
+#include <zephyr/zvfs/epoll.h>
 
 K_MEM_SLAB_DEFINE(file_desc_slab, sizeof(struct fs_file_t), ZVFS_OPEN_SIZE, 4);
 
@@ -408,6 +409,11 @@ int zvfs_close(int fd)
 		return -1;
 	}
 
+	if (IS_ENABLED(CONFIG_ZVFS_EPOLL)) {
+		/* Stop watching the object before it goes away */
+		zvfs_epoll_fd_closed(fd);
+	}
+
 	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 	if (fdtable[fd].vtable->close != NULL) {
 		/* close() is optional - e.g. stdinout_fd_op_vtable */
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+
+#define NUM_TIMERS     8
+#define NUM_WORK       4
+#define SLACK_MS       50
+#define MEASURE_SEC    5
+
+static struct k_timer timers[NUM_TIMERS];
+static struct k_work_delayable works[NUM_WORK];
+
+static atomic_t idle_entries;
+static atomic_t expiries;
+static bool use_slack;
+static bool running;
+
+/* Invoked by the idle thread each time it is about to idle the CPU */
+void sys_trace_idle_user(void)
+{
+	atomic_inc(&idle_entries);
+}
+
+/* Unrelated periods so that expiries rarely fall on the same tick */
+static uint32_t timer_period_ms(int i)
+{
+	return 100U + 37U * i;
+}
+
+static uint32_t work_period_ms(int i)
+{
+	return 250U + 41U * i;
+}
+
+static void timer_expired(struct k_timer *timer)
+{
+	atomic_inc(&expiries);
+}
+
+static void work_schedule(struct k_work_delayable *dwork)
+{
+	k_timeout_t period = K_MSEC(work_period_ms(dwork - works));
+
+	if (use_slack) {
+		(void)k_work_schedule_slack(dwork, period, K_MSEC(SLACK_MS));
+	} else {
+		(void)k_work_schedule(dwork, period);
+	}
+}
+
+static void work_handler(struct k_work *work)
+{
+	atomic_inc(&expiries);
+
+	if (running) {
+		work_schedule(k_work_delayable_from_work(work));
+	}
+}
+
+static void measure(bool slack)
+{
+	struct k_work_sync sync;
+	atomic_val_t wakeups;
+	atomic_val_t expired;
+
+	use_slack = slack;
+	running = true;
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timeout_t period = K_MSEC(timer_period_ms(i));
+
+		if (slack) {
+			k_timer_start_slack(&timers[i], period, period, K_MSEC(SLACK_MS));
+		} else {
+			k_timer_start(&timers[i], period, period);
+		}
+	}
+
+	for (int i = 0; i < NUM_WORK; i++) {
+		work_schedule(&works[i]);
+	}
+
+	/* Only count once everything is in place */
+	atomic_set(&idle_entries, 0);
+	atomic_set(&expiries, 0);
+
+	k_sleep(K_SECONDS(MEASURE_SEC));
+
+	wakeups = atomic_get(&idle_entries);
+	expired = atomic_get(&expiries);
+
+	running = false;
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_stop(&timers[i]);
+	}
+	for (int i = 0; i < NUM_WORK; i++) {
+		(void)k_work_cancel_delayable_sync(&works[i], &sync);
+	}
+
+	printk("%s: %ld wakeups/s, %ld expiries/s\n",
+	       slack ? "With slack" : "Without slack",
+	       (long)(wakeups / MEASURE_SEC), (long)(expired / MEASURE_SEC));
+}
+
+int main(void)
+{
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_init(&timers[i], timer_expired, NULL);
+	}
+	for (int i = 0; i < NUM_WORK; i++) {
+		k_work_init_delayable(&works[i], work_handler);
+	}
+
+	printk("Measuring for %d seconds, %d timers and %d work items, %d ms slack\n",
+	       MEASURE_SEC, NUM_TIMERS, NUM_WORK, SLACK_MS);
+
+	measure(false);
+	measure(true);
+
+	return 0;
+}
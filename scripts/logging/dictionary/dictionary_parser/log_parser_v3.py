@@ -55,6 +55,14 @@ FMT_MSG_TIMESTAMP_64 = "Q"
 # Keep message types in sync with include/logging/log_output_dict.h
 MSG_TYPE_NORMAL = 0
 MSG_TYPE_DROPPED = 1
+MSG_TYPE_NORMAL_COMPACT = 2
+MSG_TYPE_DROPPED_COMPACT = 3
+
+# Package words are encoded as varints in compact messages
+FMT_PKG_WORD = "I"
+
+# Sequence numbers of compact messages are 32-bit
+SEQ_MASK = 0xFFFFFFFF
 
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
@@ -63,6 +71,27 @@ FMT_DROPPED_CNT = "H"
 logger = logging.getLogger("parser")
 
 
+def decode_varint(logdata, offset):
+    """Decode one LEB128 varint at offset.
+
+    Returns a tuple of the value and the offset after it, or None
+    if the data ends before the varint does."""
+    value = 0
+    shift = 0
+
+    while offset < len(logdata):
+        one_byte = logdata[offset]
+        offset += 1
+
+        value |= (one_byte & 0x7F) << shift
+        if (one_byte & 0x80) == 0:
+            return value, offset
+
+        shift += 7
+
+    return None
+
+
 class LogParserV3(LogParser):
     """Log Parser V1"""
 
@@ -78,6 +107,10 @@ class LogParserV3(LogParser):
 
         self.fmt_msg_type = endian + FMT_MSG_TYPE
         self.fmt_dropped_cnt = endian + FMT_DROPPED_CNT
+        self.fmt_pkg_word = endian + FMT_PKG_WORD
+
+        # Sequence number expected in the next compact message
+        self.next_seq = None
 
         if self.database.is_tgt_64bit():
             self.fmt_msg_hdr = endian + FMT_MSG_HDR_64
@@ -365,6 +398,84 @@ class LogParserV3(LogParser):
         # Point to next message
         return next_msg_offset
 
+    def check_sequence(self, seq):
+        """Report messages lost in transport before a compact message"""
+        if self.next_seq is not None and seq > self.next_seq:
+            print(f"--- {seq - self.next_seq} messages lost ---")
+
+        # A lower number than expected means the target restarted.
+        self.next_seq = (seq + 1) & SEQ_MASK
+
+    def parse_one_compact_msg(self, logdata, offset):
+        """Parse one compact log message and print the encoded message.
+
+        The message is converted back to a normal one, so the same code
+        decodes both. Returns the offset of the next message, or None
+        if the message is not complete yet."""
+        if offset >= len(logdata):
+            return None
+
+        level = (logdata[offset] >> 4) & 0x0F
+        domain_id = logdata[offset] & 0x0F
+        offset += 1
+
+        fields = []
+        for _ in range(5):
+            ret = decode_varint(logdata, offset)
+            if ret is None:
+                return None
+
+            value, offset = ret
+            fields.append(value)
+
+        seq, source_id, timestamp, pkg_len, data_len = fields
+
+        # Package header and arguments come as one varint per 32-bit word.
+        # The first byte of the header is their length in words.
+        package = b''
+        args_len = 0 if pkg_len == 0 else None
+
+        while args_len is None or len(package) < args_len:
+            ret = decode_varint(logdata, offset)
+            if ret is None:
+                return None
+
+            word, offset = ret
+            package += struct.pack(self.fmt_pkg_word, word)
+
+            if args_len is None:
+                args_len = min(package[0] * self.data_types.get_sizeof(DataTypes.INT), pkg_len)
+
+        # String indexes, appended strings and hexdump data are raw.
+        remaining_len = pkg_len - len(package)
+        if offset + remaining_len + data_len > len(logdata):
+            return None
+
+        package += logdata[offset : (offset + remaining_len)]
+        offset += remaining_len
+
+        data = logdata[offset : (offset + data_len)]
+        offset += data_len
+
+        if self.is_big_endian:
+            domain_lvl = (domain_id << 4) | level
+        else:
+            domain_lvl = (level << 4) | domain_id
+
+        normal_msg = (
+            struct.pack(self.fmt_msg_hdr, domain_lvl, pkg_len, data_len, source_id)
+            + struct.pack(self.fmt_msg_timestamp, timestamp)
+            + package
+            + data
+        )
+
+        self.check_sequence(seq)
+
+        if self.parse_one_normal_msg(normal_msg, 0) is None:
+            raise ValueError("Error parsing compact log message")
+
+        return offset
+
     def parse_one_msg(self, logdata, offset):
         if offset + struct.calcsize(self.fmt_msg_type) > len(logdata):
             return False, offset
@@ -397,6 +508,29 @@ class LogParserV3(LogParser):
 
             offset = ret
 
+        elif msg_type == MSG_TYPE_NORMAL_COMPACT:
+            ret = self.parse_one_compact_msg(logdata, offset + struct.calcsize(self.fmt_msg_type))
+            if ret is None:
+                return False, offset
+
+            offset = ret
+
+        elif msg_type == MSG_TYPE_DROPPED_COMPACT:
+            ret = decode_varint(logdata, offset + struct.calcsize(self.fmt_msg_type))
+            if ret is None:
+                return False, offset
+
+            seq, next_offset = ret
+
+            ret = decode_varint(logdata, next_offset)
+            if ret is None:
+                return False, offset
+
+            num_dropped, offset = ret
+
+            self.check_sequence(seq)
+            print(f"--- {num_dropped} messages dropped ---")
+
         else:
             logger.error("------ Unknown message type: %s", msg_type)
             raise ValueError(f"Unknown message type: {msg_type}")
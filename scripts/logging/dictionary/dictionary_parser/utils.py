@@ -9,6 +9,15 @@ Utilities for Dictionary-based Logging Parser
 """
 
 import binascii
+import struct
+
+# Header of a block written by the file system backend in block mode,
+# see struct log_backend_fs_block_hdr.
+FS_BLOCK_HDR_FMT = "<HBBHHHHIQQ"
+FS_BLOCK_HDR_SIZE = struct.calcsize(FS_BLOCK_HDR_FMT)
+FS_BLOCK_MAGIC = 0x424C
+FS_BLOCK_FLAG_COMPRESSED = 0x01
+FS_LZ_MIN_MATCH = 4
 
 
 def convert_hex_file_to_bin(hexfile):
@@ -25,6 +34,66 @@ def convert_hex_file_to_bin(hexfile):
     return bin_data
 
 
+def lz_decompress(data, raw_len):
+    """Decompress the payload of a compressed file system backend block"""
+    out = bytearray()
+    idx = 0
+
+    while idx < len(data) and len(out) < raw_len:
+        ctrl = data[idx]
+        idx += 1
+
+        if ctrl & 0x80:
+            length = (ctrl & 0x7F) + FS_LZ_MIN_MATCH
+            dist = int.from_bytes(data[idx : idx + 2], "little") + 1
+            idx += 2
+
+            # Copy byte by byte as the match may overlap its own output
+            for _ in range(length):
+                out.append(out[-dist])
+        else:
+            length = ctrl + 1
+            out += data[idx : idx + length]
+            idx += length
+
+    return bytes(out)
+
+
+def extract_fs_log_blocks(data, since=None):
+    """
+    Extract dictionary-based log data from a file written by the file system
+    backend in block mode. Blocks with messages logged only before the
+    timestamp 'since' are skipped. Returns the log data and the number of
+    invalid blocks.
+    """
+    logdata = b''
+    invalid = 0
+    offset = 0
+
+    while offset + FS_BLOCK_HDR_SIZE <= len(data):
+        hdr = struct.unpack_from(FS_BLOCK_HDR_FMT, data, offset)
+        magic, _, flags, block_size, length, raw_len, _, _, _, ts_last = hdr
+
+        if magic != FS_BLOCK_MAGIC or block_size < FS_BLOCK_HDR_SIZE:
+            # Block sizes are not known without a valid header, so resync
+            # on the next possible block start.
+            invalid += 1
+            offset += FS_BLOCK_HDR_SIZE
+            continue
+
+        if since is None or ts_last >= since:
+            payload = data[offset + FS_BLOCK_HDR_SIZE : offset + FS_BLOCK_HDR_SIZE + length]
+
+            if flags & FS_BLOCK_FLAG_COMPRESSED:
+                payload = lz_decompress(payload, raw_len)
+
+            logdata += payload
+
+        offset += block_size
+
+    return logdata, invalid
+
+
 def extract_one_string_in_section(section, str_ptr):
     """Extract one string in an ELF section"""
     data = section['data']
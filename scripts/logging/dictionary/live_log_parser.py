@@ -170,7 +170,9 @@ def parse_args():
     serial_parser.add_argument("baudrate", type=int, help="Baudrate")
 
     # File subparser
-    file_parser = subparsers.add_parser("file", help="Read from file")
+    file_parser = subparsers.add_parser(
+        "file", help="Read from file, following it as it grows, or from stdin"
+    )
     file_parser.add_argument(
         "filepath", nargs="?", default=None, help="Input file path, leave empty for stdin"
     )
@@ -226,7 +228,14 @@ def main():
                 _, _, _ = select.select([reader], [], [])
             else:
                 time.sleep(args.polling_interval)
-            data += reader.read_non_blocking()
+            new_data = reader.read_non_blocking()
+            if not new_data and isinstance(reader, FileReader):
+                # End of file, wait for the capture to grow instead of
+                # spinning on it.
+                time.sleep(args.polling_interval)
+                continue
+
+            data += new_data
             parsed_data_offset = parserlib.parser(data, log_parser, logger)
             data = data[parsed_data_offset:]
 
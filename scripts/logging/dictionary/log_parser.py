@@ -38,6 +38,16 @@ def parse_args():
     argparser.add_argument(
         "--rawhex", action="store_true", help="Log file only contains hexadecimal log data"
     )
+    argparser.add_argument(
+        "--fs-blocks",
+        action="store_true",
+        help="Log Data file was written by the file system backend in block mode",
+    )
+    argparser.add_argument(
+        "--since",
+        type=int,
+        help="Skip blocks with messages older than this timestamp (with --fs-blocks)",
+    )
     argparser.add_argument("--debug", action="store_true", help="Print extra debugging information")
 
     return argparser.parse_args()
@@ -99,7 +109,7 @@ def read_log_file(args):
 
         # RTT logs add header information to the logdata, the actual log comes
         # after newline following "Process:" line in logdata
-        if b"Process:" in logdata:
+        if not args.fs_blocks and b"Process:" in logdata:
             process_idx = logdata.find(b"Process:")
             newline_idx = logdata.find(b"\n", process_idx)
             if newline_idx != -1:
@@ -107,6 +117,11 @@ def read_log_file(args):
                 logdata = logdata[newline_idx + 1 :]
                 logger.debug("Found 'Process:' in the RTT header, trimmed data")
 
+    if args.fs_blocks:
+        logdata, invalid = dictionary_parser.utils.extract_fs_log_blocks(logdata, args.since)
+        if invalid:
+            logger.warning("WARNING: skipped %d invalid blocks", invalid)
+
     return logdata
 
 
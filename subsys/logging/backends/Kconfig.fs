@@ -38,6 +38,8 @@ config LOG_BACKEND_FS_APPEND_TO_NEWEST_FILE
 	  When enabled and when there is space left in the newest log file,
 	  backend appends to it.
 	  When disabled backend creates a new log file on every startup.
+	  With LOG_BACKEND_FS_BLOCKS, a new log file is always created on
+	  startup, as the timestamps in the block headers restart at boot.
 
 config LOG_BACKEND_FS_FILE_PREFIX
 	string "Log file name prefix"
@@ -66,4 +68,50 @@ config LOG_BACKEND_FS_FILES_LIMIT
 	  Limit of number of files with logs. It is also limited by
 	  size of file system partition.
 
+config LOG_BACKEND_FS_BLOCKS
+	bool "Block based log storage"
+	depends on LOG_BACKEND_FS_OUTPUT_DICTIONARY
+	help
+	  Store dictionary-based log messages in fixed-size blocks instead of
+	  writing the output stream as it is produced. Messages are collected
+	  in RAM, optionally compressed and written as whole blocks, which
+	  keeps flash writes page aligned and reduces wear and storage use.
+	  Each block starts with a header holding the timestamps of its first
+	  and last message, so logs can be looked up by timestamp with
+	  log_backend_fs_block_find() or by a host tool reading block headers
+	  (e.g. through the mcumgr file system group).
+
+if LOG_BACKEND_FS_BLOCKS
+
+config LOG_BACKEND_FS_BLOCK_SIZE
+	int "Block size"
+	default 512
+	range 128 4096
+	help
+	  Size of a log block in bytes, including its header. It should be a
+	  power of two and a multiple of the program size of the file system
+	  (e.g. the littlefs prog-size), and LOG_BACKEND_FS_FILE_SIZE must be
+	  a multiple of it. RAM usage of the backend is about four times the
+	  block size when compression is enabled and twice otherwise.
+
+config LOG_BACKEND_FS_BLOCK_COMPRESSION
+	bool "Block compression"
+	default y
+	help
+	  Compress blocks with a lightweight LZ77 class algorithm. Dictionary
+	  log messages are highly repetitive (format string addresses, source
+	  IDs and timestamps), so blocks typically hold two to three times
+	  more messages.
+
+config LOG_BACKEND_FS_BLOCK_FLUSH_TIMEOUT_MS
+	int "Partially filled block flush timeout in milliseconds"
+	default 10000
+	help
+	  Maximum time messages stay in RAM before a partially filled block is
+	  written. Such blocks are padded to the block size. 0 means that only
+	  full blocks are written, unless log_backend_fs_block_flush() is
+	  called.
+
+endif # LOG_BACKEND_FS_BLOCKS
+
 endif # LOG_BACKEND_FS
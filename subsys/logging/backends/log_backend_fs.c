@@ -6,11 +6,15 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_fs.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_internal.h>
 #include <assert.h>
 #include <zephyr/fs/fs.h>
+#include <zephyr/sys/byteorder.h>
 
 #define MAX_PATH_LEN 256
 #define MAX_FLASH_WRITE_SIZE 256
@@ -27,6 +31,8 @@ enum backend_fs_state {
 static struct fs_file_t fs_file;
 static enum backend_fs_state backend_state = BACKEND_FS_NOT_INITIALIZED;
 static int file_ctr, newest, oldest;
+/* Number of log files created since boot. */
+static int boot_file_ctr;
 
 static int allocate_new_file(struct fs_file_t *file);
 static int del_oldest_log(void);
@@ -331,7 +337,11 @@ static int allocate_new_file(struct fs_file_t *file)
 			goto out;
 		}
 		file_size = fs_tell(file);
+		/* Block timestamps restart at every boot, so blocks are never
+		 * appended to a file of a previous boot.
+		 */
 		if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_APPEND_TO_NEWEST_FILE) &&
+		    !IS_ENABLED(CONFIG_LOG_BACKEND_FS_BLOCKS) &&
 		    file_size < CONFIG_LOG_BACKEND_FS_FILE_SIZE) {
 			/* There is space left to log to the latest file, no need to create
 			 * a new one or delete old ones at this point.
@@ -393,6 +403,7 @@ static int allocate_new_file(struct fs_file_t *file)
 		goto out;
 	}
 	++file_ctr;
+	++boot_file_ctr;
 	newest = curr_file_num;
 
 out:
@@ -429,15 +440,638 @@ static int del_oldest_log(void)
 BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE),
 	     "Immediate logging is not supported by LOG FS backend.");
 
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+static int block_stage(uint8_t *data, size_t length, void *ctx);
+#define LOG_FS_OUTPUT_FUNC block_stage
+#else
+#define LOG_FS_OUTPUT_FUNC write_log_to_file
+#endif
+
 static uint8_t __aligned(4) buf[MAX_FLASH_WRITE_SIZE];
-LOG_OUTPUT_DEFINE(log_output, write_log_to_file, buf, MAX_FLASH_WRITE_SIZE);
+LOG_OUTPUT_DEFINE(log_output, LOG_FS_OUTPUT_FUNC, buf, MAX_FLASH_WRITE_SIZE);
+
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+
+#define BLOCK_SIZE CONFIG_LOG_BACKEND_FS_BLOCK_SIZE
+#define BLOCK_HDR_SIZE sizeof(struct log_backend_fs_block_hdr)
+#define BLOCK_PAYLOAD_SIZE (BLOCK_SIZE - BLOCK_HDR_SIZE)
+
+/* With compression, messages are staged until they no longer compress into a
+ * single block, which is limited to a 2:1 ratio to bound RAM usage.
+ */
+#define BLOCK_RAW_SIZE (IS_ENABLED(CONFIG_LOG_BACKEND_FS_BLOCK_COMPRESSION) ? \
+			2 * BLOCK_PAYLOAD_SIZE : BLOCK_PAYLOAD_SIZE)
+#define BLOCK_IMAGES (IS_ENABLED(CONFIG_LOG_BACKEND_FS_BLOCK_COMPRESSION) ? 2 : 1)
+
+BUILD_ASSERT((CONFIG_LOG_BACKEND_FS_FILE_SIZE % BLOCK_SIZE) == 0,
+	     "Log file size must be a multiple of the block size.");
+
+#define LZ_MIN_MATCH 4
+#define LZ_MAX_MATCH (0x7f + LZ_MIN_MATCH)
+#define LZ_MAX_LITERALS 0x80
+#define LZ_MATCH_FLAG 0x80
+#define LZ_HASH_BITS 8
+
+struct block_image {
+	/* Staged bytes covered by the image. */
+	size_t raw_len;
+	/* Length of the payload stored in the image. */
+	size_t len;
+	uint16_t msg_cnt;
+	uint64_t ts_last;
+	bool compressed;
+};
+
+static struct {
+	uint8_t raw[BLOCK_RAW_SIZE];
+	/* Staged bytes, including a message being formatted. */
+	size_t raw_len;
+	/* Staged bytes of complete messages. */
+	size_t msg_len;
+	uint16_t msg_cnt;
+	uint64_t ts_first;
+	uint64_t ts_last;
+	bool overflow;
+	uint32_t seq;
+	/* Image of all staged messages, valid when msg_len exceeds the payload size. */
+	struct block_image ready;
+	uint8_t ready_idx;
+} block;
+
+static uint8_t __aligned(4) block_images[BLOCK_IMAGES][BLOCK_SIZE];
+static K_MUTEX_DEFINE(block_lock);
+static void block_flush_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(block_flush_work, block_flush_work_handler);
+
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCK_COMPRESSION
+static uint16_t lz_table[1 << LZ_HASH_BITS];
+
+static uint32_t lz_hash(const uint8_t *data)
+{
+	return (sys_get_le32(data) * 2654435761U) >> (32 - LZ_HASH_BITS);
+}
+
+static int lz_literals(uint8_t *dst, size_t dst_len, size_t *out,
+		       const uint8_t *src, size_t len)
+{
+	while (len > 0) {
+		size_t n = MIN(len, LZ_MAX_LITERALS);
+
+		if ((*out + n + 1) > dst_len) {
+			return -ENOSPC;
+		}
+
+		dst[(*out)++] = n - 1;
+		memcpy(&dst[*out], src, n);
+		*out += n;
+		src += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+/* Greedy LZ77 with a single entry hash table. Returns the compressed length
+ * or -ENOSPC when it does not fit in dst_len, which is detected early so a
+ * failed attempt costs at most one pass over the fitting part of the input.
+ */
+static int lz_compress(const uint8_t *src, size_t len, uint8_t *dst, size_t dst_len)
+{
+	size_t in = 0;
+	size_t lit = 0;
+	size_t out = 0;
+	int rc;
+
+	memset(lz_table, 0, sizeof(lz_table));
+
+	while ((in + LZ_MIN_MATCH) <= len) {
+		uint32_t h = lz_hash(&src[in]);
+		size_t cand = lz_table[h];
+		size_t match = 0;
+
+		/* Positions are stored incremented by one, 0 marks an empty entry. */
+		lz_table[h] = in + 1;
+		if (cand != 0) {
+			size_t max = MIN(len - in, LZ_MAX_MATCH);
+
+			cand--;
+			while ((match < max) && (src[cand + match] == src[in + match])) {
+				match++;
+			}
+		}
+
+		if (match < LZ_MIN_MATCH) {
+			in++;
+			continue;
+		}
+
+		rc = lz_literals(dst, dst_len, &out, &src[lit], in - lit);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if ((out + 3) > dst_len) {
+			return -ENOSPC;
+		}
+
+		dst[out++] = LZ_MATCH_FLAG | (match - LZ_MIN_MATCH);
+		sys_put_le16(in - cand - 1, &dst[out]);
+		out += 2;
+		in += match;
+		lit = in;
+	}
+
+	rc = lz_literals(dst, dst_len, &out, &src[lit], len - lit);
+
+	return (rc < 0) ? rc : (int)out;
+}
+#endif /* CONFIG_LOG_BACKEND_FS_BLOCK_COMPRESSION */
+
+/* Prepare an image of the first raw_len staged bytes in the spare image
+ * buffer. Data that fits uncompressed is stored as is if it does not compress.
+ */
+static int block_image_prepare(struct block_image *img, size_t raw_len)
+{
+	uint8_t *payload = &block_images[BLOCK_IMAGES - 1 - block.ready_idx][BLOCK_HDR_SIZE];
+
+	img->raw_len = raw_len;
+	img->compressed = false;
+
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCK_COMPRESSION
+	int rc = lz_compress(block.raw, raw_len, payload,
+			     MIN(raw_len, BLOCK_PAYLOAD_SIZE + 1) - 1);
+
+	if (rc >= 0) {
+		img->len = rc;
+		img->compressed = true;
+		return 0;
+	}
+#endif
+
+	if (raw_len > BLOCK_PAYLOAD_SIZE) {
+		return -ENOSPC;
+	}
+
+	memcpy(payload, block.raw, raw_len);
+	img->len = raw_len;
+
+	return 0;
+}
+
+/* Start a new file if a write was cut short, to keep blocks aligned. Readers
+ * ignore the incomplete block at the end of the previous file.
+ */
+static void block_file_align(void)
+{
+	off_t pos;
+
+	if (backend_state != BACKEND_FS_OK) {
+		return;
+	}
+
+	pos = fs_tell(&fs_file);
+	if ((pos < 0) || (((pos % BLOCK_SIZE) != 0) && (allocate_new_file(&fs_file) < 0))) {
+		backend_state = BACKEND_FS_CORRUPTED;
+	}
+}
+
+/* Write the image prepared in the spare buffer and drop the staged bytes it covers. */
+static void block_image_write(const struct block_image *img)
+{
+	uint8_t *data = block_images[BLOCK_IMAGES - 1 - block.ready_idx];
+	struct log_backend_fs_block_hdr *hdr = (struct log_backend_fs_block_hdr *)data;
+	size_t rest = block.raw_len - img->raw_len;
+	int rc;
+
+	hdr->magic = sys_cpu_to_le16(LOG_BACKEND_FS_BLOCK_MAGIC);
+	hdr->version = LOG_BACKEND_FS_BLOCK_VERSION;
+	hdr->flags = img->compressed ? LOG_BACKEND_FS_BLOCK_FLAG_COMPRESSED : 0;
+	hdr->block_size = sys_cpu_to_le16(BLOCK_SIZE);
+	hdr->len = sys_cpu_to_le16(img->len);
+	hdr->raw_len = sys_cpu_to_le16(img->raw_len);
+	hdr->msg_cnt = sys_cpu_to_le16(img->msg_cnt);
+	hdr->seq = sys_cpu_to_le32(block.seq++);
+	hdr->ts_first = sys_cpu_to_le64(block.ts_first);
+	hdr->ts_last = sys_cpu_to_le64(img->ts_last);
+	memset(&data[BLOCK_HDR_SIZE + img->len], 0xff, BLOCK_PAYLOAD_SIZE - img->len);
+
+	block_file_align();
+	rc = write_log_to_file(data, BLOCK_SIZE, NULL);
+	if (rc == 0) {
+		/* Oldest log was deleted to make space. Drop the part of the
+		 * block written before the file system ran out of space.
+		 */
+		block_file_align();
+		(void)write_log_to_file(data, BLOCK_SIZE, NULL);
+	}
+
+	memmove(block.raw, &block.raw[img->raw_len], rest);
+	block.raw_len = rest;
+	block.msg_len -= img->raw_len;
+	block.msg_cnt -= img->msg_cnt;
+}
+
+/* Write all complete staged messages. */
+static void block_flush(void)
+{
+	struct block_image img;
+
+	if (block.msg_len == 0) {
+		return;
+	}
+
+	if (block.msg_len > BLOCK_PAYLOAD_SIZE) {
+		/* Only reachable with compression, when the last attempt succeeded. */
+		block.ready_idx = BLOCK_IMAGES - 1 - block.ready_idx;
+		img = block.ready;
+	} else {
+		(void)block_image_prepare(&img, block.msg_len);
+		img.msg_cnt = block.msg_cnt;
+		img.ts_last = block.ts_last;
+	}
+
+	block_image_write(&img);
+	(void)k_work_cancel_delayable(&block_flush_work);
+}
+
+static int block_stage(uint8_t *data, size_t length, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	if ((block.raw_len + length) > BLOCK_RAW_SIZE) {
+		block.overflow = true;
+	} else {
+		memcpy(&block.raw[block.raw_len], data, length);
+		block.raw_len += length;
+	}
+
+	return length;
+}
+
+/* Make room for a message before it is formatted into the staging buffer. */
+static bool block_msg_begin(size_t max_len)
+{
+	if (max_len > BLOCK_RAW_SIZE) {
+		return false;
+	}
+
+	if ((block.msg_len + max_len) > BLOCK_RAW_SIZE) {
+		block_flush();
+	}
+
+	block.overflow = false;
+
+	return true;
+}
+
+/* Prepare the image of all staged messages, which exceed the payload size, to
+ * be written by the next flush.
+ */
+static int block_ready_prepare(void)
+{
+	struct block_image img;
+
+	if (block_image_prepare(&img, block.msg_len) < 0) {
+		return -ENOSPC;
+	}
+
+	img.msg_cnt = block.msg_cnt;
+	img.ts_last = block.ts_last;
+	block.ready = img;
+	block.ready_idx = BLOCK_IMAGES - 1 - block.ready_idx;
+
+	return 0;
+}
+
+/* Account a message formatted into the staging buffer. */
+static void block_msg_end(uint64_t timestamp)
+{
+	size_t prev_len = block.msg_len;
+	uint64_t prev_ts = block.ts_last;
+
+	if (block.overflow) {
+		block.raw_len = block.msg_len;
+		return;
+	}
+
+	if (block.msg_cnt == 0) {
+		block.ts_first = timestamp;
+		if (CONFIG_LOG_BACKEND_FS_BLOCK_FLUSH_TIMEOUT_MS > 0) {
+			k_work_schedule(&block_flush_work,
+					K_MSEC(CONFIG_LOG_BACKEND_FS_BLOCK_FLUSH_TIMEOUT_MS));
+		}
+	}
+
+	block.msg_len = block.raw_len;
+	block.msg_cnt++;
+	block.ts_last = timestamp;
+
+	if (block.msg_len <= BLOCK_PAYLOAD_SIZE) {
+		return;
+	}
+
+	/* Check if the block still compresses into a single block. If it does
+	 * not, write the image of the previous messages and keep the new one.
+	 */
+	if (block_ready_prepare() == 0) {
+		return;
+	}
+
+	if (prev_len > 0) {
+		struct block_image img;
+
+		if (prev_len > BLOCK_PAYLOAD_SIZE) {
+			block.ready_idx = BLOCK_IMAGES - 1 - block.ready_idx;
+			img = block.ready;
+		} else {
+			(void)block_image_prepare(&img, prev_len);
+			img.msg_cnt = block.msg_cnt - 1;
+			img.ts_last = prev_ts;
+		}
+
+		block_image_write(&img);
+		block.ts_first = timestamp;
+
+		/* The new message alone can still exceed the payload size. */
+		if ((block.msg_len <= BLOCK_PAYLOAD_SIZE) || (block_ready_prepare() == 0)) {
+			return;
+		}
+	}
+
+	/* Single message which does not fit in a block. */
+	block.raw_len = 0;
+	block.msg_len = 0;
+	block.msg_cnt = 0;
+}
+
+/* Upper bound of the size of a message in the dictionary-based output, in the
+ * normal and in the compact format.
+ */
+static size_t block_msg_max_len(struct log_msg *msg)
+{
+	size_t plen = msg->hdr.desc.package_len;
+
+	return sizeof(struct log_dict_output_normal_msg_hdr_t) + 32 +
+	       plen + (plen / 4) + msg->hdr.desc.data_len;
+}
+
+static void block_flush_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)log_backend_fs_block_flush();
+}
+
+int log_backend_fs_block_flush(void)
+{
+	int rc = 0;
+
+	k_mutex_lock(&block_lock, K_FOREVER);
+	block_flush();
+	if (backend_state == BACKEND_FS_OK) {
+		rc = fs_sync(&fs_file);
+	}
+	k_mutex_unlock(&block_lock);
+
+	return ((rc < 0) || (backend_state == BACKEND_FS_CORRUPTED)) ? -EIO : 0;
+}
+
+static int block_hdr_read(struct fs_file_t *file, off_t offset,
+			  struct log_backend_fs_block_hdr *hdr)
+{
+	int rc;
+
+	rc = fs_seek(file, offset, FS_SEEK_SET);
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = fs_read(file, hdr, sizeof(*hdr));
+	if (rc < 0) {
+		return rc;
+	}
+
+	if ((rc != sizeof(*hdr)) ||
+	    (sys_le16_to_cpu(hdr->magic) != LOG_BACKEND_FS_BLOCK_MAGIC) ||
+	    (sys_le16_to_cpu(hdr->block_size) != BLOCK_SIZE)) {
+		return -ENODATA;
+	}
+
+	return 0;
+}
+
+/* Find the first block in the file with messages logged at or after timestamp. */
+static int block_file_search(const char *fname, uint64_t timestamp, off_t *offset)
+{
+	struct log_backend_fs_block_hdr hdr;
+	struct fs_dirent ent;
+	struct fs_file_t file;
+	size_t lo = 0;
+	size_t end;
+	size_t hi;
+	int rc;
+
+	rc = fs_stat(fname, &ent);
+	if (rc < 0) {
+		return rc;
+	}
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, fname, FS_O_READ);
+	if (rc < 0) {
+		return rc;
+	}
+
+	end = ent.size / BLOCK_SIZE;
+	hi = end;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		rc = block_hdr_read(&file, mid * BLOCK_SIZE, &hdr);
+		if (rc == -ENODATA) {
+			/* Incomplete block at the end of the file. */
+			hi = mid;
+			end = mid;
+		} else if (rc < 0) {
+			break;
+		} else if (sys_le64_to_cpu(hdr.ts_last) < timestamp) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	(void)fs_close(&file);
+
+	if (rc < 0 && rc != -ENODATA) {
+		return rc;
+	}
+
+	if (lo >= end) {
+		return -ENOENT;
+	}
+
+	*offset = lo * BLOCK_SIZE;
+
+	return 0;
+}
+
+static int block_file_first_ts(const char *fname, uint64_t *timestamp)
+{
+	struct log_backend_fs_block_hdr hdr;
+	struct fs_file_t file;
+	int rc;
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, fname, FS_O_READ);
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = block_hdr_read(&file, 0, &hdr);
+	(void)fs_close(&file);
+	if (rc == 0) {
+		*timestamp = sys_le64_to_cpu(hdr.ts_first);
+	}
+
+	return rc;
+}
+
+int log_backend_fs_block_find(uint64_t timestamp, char *path, size_t path_len, off_t *offset)
+{
+	char fname[MAX_PATH_LEN];
+	int first = -1;
+	int cand = -1;
+	int next = -1;
+	int num;
+	int rc;
+
+	if (backend_state != BACKEND_FS_OK) {
+		return -EIO;
+	}
+
+	if (boot_file_ctr == 0) {
+		return -ENOENT;
+	}
+
+	/* Timestamps restart at every boot, only the files created since boot
+	 * are searched. Pick the newest file starting at or before the
+	 * timestamp, or the oldest file if all files start after it.
+	 */
+	num = newest - (MIN(boot_file_ctr, file_ctr) - 1);
+	if (num < 0) {
+		num += MAX_FILE_NUMERAL + 1;
+	}
+
+	while (true) {
+		uint64_t ts;
+
+		get_log_path(fname, sizeof(fname), num);
+		rc = block_file_first_ts(fname, &ts);
+		if (rc == 0) {
+			if (first < 0) {
+				first = num;
+			}
+
+			if (ts <= timestamp) {
+				cand = num;
+				next = -1;
+			} else if (next < 0) {
+				next = num;
+			}
+		} else if ((rc != -ENOENT) && (rc != -ENODATA)) {
+			return -EIO;
+		}
+
+		if (num == newest) {
+			break;
+		}
+
+		num = (num == MAX_FILE_NUMERAL) ? 0 : num + 1;
+	}
+
+	if (cand >= 0) {
+		get_log_path(fname, sizeof(fname), cand);
+		rc = block_file_search(fname, timestamp, offset);
+		if (rc == 0) {
+			goto found;
+		} else if (rc != -ENOENT) {
+			return -EIO;
+		}
+		/* Messages at or after the timestamp start in the next file. */
+		cand = next;
+	} else {
+		cand = first;
+	}
+
+	if (cand < 0) {
+		return -ENOENT;
+	}
+
+	get_log_path(fname, sizeof(fname), cand);
+	*offset = 0;
+
+found:
+	rc = strlen(fname);
+	if (rc >= path_len) {
+		return -EINVAL;
+	}
+
+	memcpy(path, fname, rc + 1);
+
+	return 0;
+}
+
+#else
+
+int log_backend_fs_block_flush(void)
+{
+	return -ENOTSUP;
+}
+
+int log_backend_fs_block_find(uint64_t timestamp, char *path, size_t path_len, off_t *offset)
+{
+	ARG_UNUSED(timestamp);
+	ARG_UNUSED(path);
+	ARG_UNUSED(path_len);
+	ARG_UNUSED(offset);
+
+	return -ENOTSUP;
+}
+
+#endif /* CONFIG_LOG_BACKEND_FS_BLOCKS */
 
 static void log_backend_fs_init(const struct log_backend *const backend)
 {
 }
 
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+/* Write the messages collected in RAM, unless the panic interrupted the
+ * backend while it was updating them.
+ */
+static void block_panic_flush(void)
+{
+	if (k_is_in_isr() || (k_mutex_lock(&block_lock, K_NO_WAIT) != 0)) {
+		return;
+	}
+
+	if (block_lock.lock_count == 1) {
+		block_flush();
+		if (backend_state == BACKEND_FS_OK) {
+			(void)fs_sync(&fs_file);
+		}
+	}
+
+	k_mutex_unlock(&block_lock);
+}
+#endif
+
 static void panic(struct log_backend const *const backend)
 {
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+	block_panic_flush();
+#endif
+
 	/* In case of panic deinitialize backend. It is better to keep
 	 * current data rather than log new and risk of failure.
 	 */
@@ -448,11 +1082,20 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 {
 	ARG_UNUSED(backend);
 
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+	k_mutex_lock(&block_lock, K_FOREVER);
+	if (block_msg_begin(sizeof(struct log_dict_output_dropped_msg_t) + 16)) {
+		log_dict_output_dropped_process(&log_output, cnt);
+		block_msg_end(z_log_timestamp());
+	}
+	k_mutex_unlock(&block_lock);
+#else
 	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY)) {
 		log_dict_output_dropped_process(&log_output, cnt);
 	} else {
 		log_backend_std_dropped(&log_output, cnt);
 	}
+#endif
 }
 
 static void process(const struct log_backend *const backend,
@@ -462,11 +1105,25 @@ static void process(const struct log_backend *const backend,
 
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+	k_mutex_lock(&block_lock, K_FOREVER);
+	if (block_msg_begin(block_msg_max_len(&msg->log))) {
+		log_output_func(&log_output, &msg->log, flags);
+		block_msg_end((uint64_t)log_msg_get_timestamp(&msg->log));
+	}
+	k_mutex_unlock(&block_lock);
+#else
 	log_output_func(&log_output, &msg->log, flags);
+#endif
 }
 
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_BLOCKS) && (log_type != LOG_OUTPUT_DICT)) {
+		/* Blocks can only hold dictionary-based messages. */
+		return -ENOTSUP;
+	}
+
 	log_format_current = log_type;
 	return 0;
 }
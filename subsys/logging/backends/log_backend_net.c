@@ -11,6 +11,7 @@ LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_net.h>
 #include <zephyr/net/hostname.h>
 #include <zephyr/net/net_if.h>
@@ -58,7 +59,10 @@ static int line_out(uint8_t *data, size_t length, void *output_ctx)
 #if defined(CONFIG_NET_TCP)
 	char len[sizeof("123456789")];
 
-	if (ctx->is_tcp) {
+	/* Dictionary-based output is a plain byte stream, it is not framed
+	 * like syslog messages.
+	 */
+	if (ctx->is_tcp && log_format_current != LOG_OUTPUT_DICT) {
 		(void)snprintk(len, sizeof(len), "%zu ", length);
 		io_vector[pos].iov_base = (void *)len;
 		io_vector[pos].iov_len = strlen(len);
@@ -180,6 +184,21 @@ static int format_set(const struct log_backend *const backend, uint32_t log_type
 	return 0;
 }
 
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	if (panic_mode) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) && log_format_current == LOG_OUTPUT_DICT) {
+		log_dict_output_dropped_process(&log_output_net, cnt);
+	} else {
+		log_output_dropped_process(&log_output_net, cnt);
+	}
+}
+
 static bool check_net_init_done(void)
 {
 	bool ret = false;
@@ -309,6 +328,7 @@ const struct log_backend_api log_backend_net_api = {
 	.init = init_net,
 	.is_ready = backend_ready,
 	.process = process,
+	.dropped = dropped,
 	.format_set = format_set,
 };
 
@@ -11,9 +11,11 @@ LOG_MODULE_REGISTER(log_backend_ws, CONFIG_LOG_DEFAULT_LEVEL);
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_ws.h>
 #include <zephyr/net/net_if.h>
 #include <zephyr/net/socket.h>
+#include <zephyr/net/websocket.h>
 
 static bool ws_init_done;
 static bool panic_mode;
@@ -36,6 +38,14 @@ static int ws_send_all(int sock, const char *output, size_t len)
 {
 	int ret;
 
+	if (log_format_current == LOG_OUTPUT_DICT) {
+		/* Dictionary-based output is binary, it cannot go in text frames. */
+		ret = websocket_send_msg(sock, (const uint8_t *)output, len,
+					 WEBSOCKET_OPCODE_DATA_BINARY, false, true, 0);
+
+		return (ret < 0) ? ret : 0;
+	}
+
 	while (len > 0) {
 		ret = zsock_send(sock, output, len, ZSOCK_MSG_DONTWAIT);
 		if ((ret < 0) && (errno == EAGAIN)) {
@@ -54,16 +64,52 @@ static int ws_send_all(int sock, const char *output, size_t len)
 	return 0;
 }
 
-static int ws_console_out(struct log_backend_ws_ctx *ctx, int c)
+static int ws_flush(struct log_backend_ws_ctx *ctx)
 {
 	static int max_cnt = CONFIG_LOG_BACKEND_WS_TX_RETRY_CNT;
-	bool printnow = false;
 	unsigned int cnt = 0;
 	int ret = 0;
 
+	if (pos == 0) {
+		return 0;
+	}
+
+	while (ctx->sock >= 0 && cnt < max_cnt) {
+		ret = ws_send_all(ctx->sock, output_buf, pos);
+		if (ret < 0) {
+			if (ret == -EAGAIN) {
+				wait();
+				cnt++;
+				continue;
+			}
+		}
+
+		break;
+	}
+
+	if (ctx->sock >= 0 && ret == 0) {
+		/* We could send data */
+		pos = 0;
+	} else {
+		/* If the line is full and we cannot send, then
+		 * ignore the output data in buffer.
+		 */
+		if (pos >= (sizeof(output_buf) - 1)) {
+			pos = 0;
+		}
+	}
+
+	return ret;
+}
+
+static int ws_console_out(struct log_backend_ws_ctx *ctx, int c)
+{
+	bool printnow = false;
+
 	__ASSERT_NO_MSG(pos < sizeof(output_buf));
 
-	if ((c != '\n') && (c != '\r')) {
+	/* Line endings are plain data in dictionary-based output. */
+	if (((c != '\n') && (c != '\r')) || (log_format_current == LOG_OUTPUT_DICT)) {
 		output_buf[pos++] = c;
 	} else {
 		printnow = true;
@@ -73,34 +119,11 @@ static int ws_console_out(struct log_backend_ws_ctx *ctx, int c)
 		printnow = true;
 	}
 
-	if (pos > 0 && printnow) {
-		while (ctx->sock >= 0 && cnt < max_cnt) {
-			ret = ws_send_all(ctx->sock, output_buf, pos);
-			if (ret < 0) {
-				if (ret == -EAGAIN) {
-					wait();
-					cnt++;
-					continue;
-				}
-			}
-
-			break;
-		}
-
-		if (ctx->sock >= 0 && ret == 0) {
-			/* We could send data */
-			pos = 0;
-		} else {
-			/* If the line is full and we cannot send, then
-			 * ignore the output data in buffer.
-			 */
-			if (pos >= (sizeof(output_buf) - 1)) {
-				pos = 0;
-			}
-		}
+	if (printnow) {
+		return ws_flush(ctx);
 	}
 
-	return ret;
+	return 0;
 }
 
 static int line_out(uint8_t *data, size_t length, void *output_ctx)
@@ -162,6 +185,11 @@ static void process(const struct log_backend *const backend,
 	log_output_func = log_format_func_t_get(log_format_current);
 
 	log_output_func(&log_output_ws, &msg->log, flags);
+
+	if (log_format_current == LOG_OUTPUT_DICT) {
+		/* There are no line endings to trigger sending of a message. */
+		(void)ws_flush(&ctx);
+	}
 }
 
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
@@ -170,6 +198,22 @@ static int format_set(const struct log_backend *const backend, uint32_t log_type
 	return 0;
 }
 
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	if (panic_mode) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) && log_format_current == LOG_OUTPUT_DICT) {
+		log_dict_output_dropped_process(&log_output_ws, cnt);
+		(void)ws_flush(&ctx);
+	} else {
+		log_output_dropped_process(&log_output_ws, cnt);
+	}
+}
+
 void log_backend_ws_start(void)
 {
 	const struct log_backend *backend = log_backend_ws_get();
@@ -217,6 +261,7 @@ const struct log_backend_api log_backend_ws_api = {
 	.panic = panic,
 	.init = init_ws,
 	.process = process,
+	.dropped = dropped,
 	.format_set = format_set,
 };
 
@@ -7,6 +7,7 @@
 #include <zephyr/shell/shell.h>
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend_fs.h>
 #include <zephyr/logging/log_internal.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <string.h>
@@ -429,6 +430,89 @@ static int cmd_log_mem(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+static int cmd_log_ratelimit(const struct shell *sh, size_t argc, char **argv)
+{
+	struct log_source_ratelimit_config config;
+	struct log_source_ratelimit_stats stats;
+	int err = 0;
+
+	(void)log_source_ratelimit_get(&config, &stats);
+
+	if (argc == 1) {
+		shell_print(sh, "Rate limit: %u messages/s, burst %u%s", config.rate,
+			    config.burst, (config.rate == 0U) ? " (disabled)" : "");
+		shell_print(sh, "Deduplication: %s", config.dedup ? "on" : "off");
+		shell_print(sh, "Suppressed: %u, repeated: %u", stats.suppressed,
+			    stats.repeated);
+		return 0;
+	}
+
+	config.rate = shell_strtoul(argv[1], 0, &err);
+	if (argc > 2) {
+		config.burst = shell_strtoul(argv[2], 0, &err);
+	}
+
+	if (err == 0) {
+		err = log_source_ratelimit_set(&config);
+	}
+
+	if (err < 0) {
+		shell_error(sh, "Invalid rate limit (%d)", err);
+		return -ENOEXEC;
+	}
+
+	return 0;
+}
+
+static int cmd_log_dedup(const struct shell *sh, size_t argc, char **argv)
+{
+	struct log_source_ratelimit_config config;
+	int err = 0;
+
+	(void)log_source_ratelimit_get(&config, NULL);
+
+	config.dedup = shell_strtobool(argv[1], 0, &err);
+	if (err == 0) {
+		err = log_source_ratelimit_set(&config);
+	}
+
+	if (err < 0) {
+		shell_error(sh, "Failed to set deduplication (%d)", err);
+		return -ENOEXEC;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+static int cmd_log_fs_find(const struct shell *sh, size_t argc, char **argv)
+{
+	char path[sizeof(CONFIG_LOG_BACKEND_FS_DIR) +
+		  sizeof(CONFIG_LOG_BACKEND_FS_FILE_PREFIX) + 4];
+	uint64_t timestamp;
+	off_t offset;
+	int err = 0;
+
+	timestamp = shell_strtoull(argv[1], 0, &err);
+	if (err != 0) {
+		shell_error(sh, "Invalid timestamp (%d)", err);
+		return -ENOEXEC;
+	}
+
+	(void)log_backend_fs_block_flush();
+
+	err = log_backend_fs_block_find(timestamp, path, sizeof(path), &offset);
+	if (err < 0) {
+		shell_error(sh, "No block found (%d)", err);
+		return -ENOEXEC;
+	}
+
+	shell_print(sh, "%s %ld", path, (long)offset);
+
+	return 0;
+}
+#endif /* CONFIG_LOG_BACKEND_FS_BLOCKS */
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_log_backend,
 	SHELL_CMD_ARG(disable, &dsub_module_name,
 		  "'log disable <module_0> .. <module_n>' disables logs in "
@@ -488,6 +572,18 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		       cmd_log_self_status),
 	SHELL_COND_CMD(CONFIG_LOG_MODE_DEFERRED, mem, NULL, "Logger memory usage",
 		       cmd_log_mem),
+	SHELL_COND_CMD_ARG(CONFIG_LOG_SOURCE_RATELIMIT, ratelimit, NULL,
+			   "'log ratelimit [<rate> [<burst>]]' shows or sets the number of "
+			   "messages per second and burst allowed from each source (0 disables).",
+			   cmd_log_ratelimit, 1, 2),
+	SHELL_COND_CMD_ARG(CONFIG_LOG_SOURCE_RATELIMIT_DEDUP, dedup, NULL,
+			   "'log dedup <on|off>' enables or disables deduplication of "
+			   "repeated messages.",
+			   cmd_log_dedup, 2, 0),
+	SHELL_COND_CMD_ARG(CONFIG_LOG_BACKEND_FS_BLOCKS, fs_find, NULL,
+			   "'log fs_find <timestamp>' prints the log file and offset of "
+			   "the first block with messages logged at or after timestamp.",
+			   cmd_log_fs_find, 2, 0),
 	SHELL_COND_CMD(CONFIG_LOG_FRONTEND, FRONTEND_NAME, &sub_log_backend,
 		"Frontend control", NULL),
 	SHELL_SUBCMD_SET_END);
@@ -123,16 +123,34 @@ static STRUCT_SECTION_ITERABLE(log_msg_ptr, log_msg_ptr);
 static STRUCT_SECTION_ITERABLE_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer, log_buffer);
 static struct mpsc_pbuf_buffer *curr_log_buffer;
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+#define LOG_BUFFER_COUNT CONFIG_MP_MAX_NUM_CPUS
+/* Buffers of CPUs other than CPU 0, which uses log_buffer. */
+static struct mpsc_pbuf_buffer cpu_log_buffer[LOG_BUFFER_COUNT - 1];
+/* Oldest message claimed from each per-CPU buffer, not yet processed. */
+static union log_msg_generic *cpu_log_msg[LOG_BUFFER_COUNT];
+#else
+#define LOG_BUFFER_COUNT 1
+#endif
+
 #ifdef CONFIG_MPSC_PBUF
+/* Every buffer must start at Z_LOG_MSG_ALIGNMENT, as the messages in it are
+ * aligned relative to its start.
+ */
+#define LOG_BUFFER_WALIGN MAX(1, Z_LOG_MSG_ALIGNMENT / sizeof(int))
+#define LOG_BUFFER_WLEN \
+	ROUND_DOWN(CONFIG_LOG_BUFFER_SIZE / sizeof(int) / LOG_BUFFER_COUNT, LOG_BUFFER_WALIGN)
+
 static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
 	buf32[CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+BUILD_ASSERT(LOG_BUFFER_WLEN > 0, "CONFIG_LOG_BUFFER_SIZE too small for the number of buffers");
 
 static void z_log_notify_drop(const struct mpsc_pbuf_buffer *buffer,
 			      const union mpsc_pbuf_generic *item);
 
 static const struct mpsc_pbuf_buffer_config mpsc_config = {
 	.buf = (uint32_t *)buf32,
-	.size = ARRAY_SIZE(buf32),
+	.size = LOG_BUFFER_WLEN,
 	.notify_drop = z_log_notify_drop,
 	.get_wlen = log_msg_generic_get_wlen,
 	.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?
@@ -652,6 +670,50 @@ void z_log_msg_init(void)
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (int i = 1; i < LOG_BUFFER_COUNT; i++) {
+		struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+		config.buf = &buf32[i * LOG_BUFFER_WLEN];
+		mpsc_pbuf_init(&cpu_log_buffer[i - 1], &config);
+	}
+#endif
+}
+
+static inline struct mpsc_pbuf_buffer *log_buffer_get(int idx)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	return (idx == 0) ? &log_buffer : &cpu_log_buffer[idx - 1];
+#else
+	ARG_UNUSED(idx);
+
+	return &log_buffer;
+#endif
+}
+
+/* Buffer for the messages logged on the current CPU. */
+static inline struct mpsc_pbuf_buffer *local_buffer_get(void)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	/* Being migrated right after reading the CPU id is harmless: every
+	 * buffer accepts messages from any CPU.
+	 */
+	return log_buffer_get(arch_curr_cpu()->id);
+#else
+	return &log_buffer;
+#endif
+}
+
+/* Buffer a message was allocated from, the producer may have migrated. */
+static inline struct mpsc_pbuf_buffer *msg_buffer_get(const struct log_msg *msg)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	return log_buffer_get(((const uint32_t *)msg - buf32) / LOG_BUFFER_WLEN);
+#else
+	ARG_UNUSED(msg);
+
+	return &log_buffer;
+#endif
 }
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
@@ -669,7 +731,7 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
-	return msg_alloc(&log_buffer, wlen);
+	return msg_alloc(local_buffer_get(), wlen);
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -701,12 +763,62 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
-	msg_commit(&log_buffer, msg);
+	msg_commit(msg_buffer_get(msg), msg);
+}
+
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+static inline bool timestamp_before(log_timestamp_t a, log_timestamp_t b)
+{
+	if (sizeof(log_timestamp_t) > sizeof(uint32_t)) {
+		return a < b;
+	}
+
+	/* Handle wrap around of 32 bit timestamps. */
+	return (int32_t)((uint32_t)a - (uint32_t)b) < 0;
+}
+
+/* Claim the oldest message (lowest timestamp) out of the per-CPU buffers. */
+static union log_msg_generic *cpu_msg_claim_oldest(void)
+{
+	union log_msg_generic *msg;
+	log_timestamp_t t_min = 0;
+	int chosen = -1;
+
+	for (int i = 0; i < LOG_BUFFER_COUNT; i++) {
+		log_timestamp_t t;
+
+		if (cpu_log_msg[i] == NULL) {
+			cpu_log_msg[i] = (union log_msg_generic *)mpsc_pbuf_claim(
+									log_buffer_get(i));
+			if (cpu_log_msg[i] == NULL) {
+				continue;
+			}
+		}
+
+		t = log_msg_get_timestamp(&cpu_log_msg[i]->log);
+		if ((chosen < 0) || timestamp_before(t, t_min)) {
+			t_min = t;
+			chosen = i;
+		}
+	}
+
+	if (chosen < 0) {
+		return NULL;
+	}
+
+	msg = cpu_log_msg[chosen];
+	cpu_log_msg[chosen] = NULL;
+	curr_log_buffer = log_buffer_get(chosen);
+
+	return msg;
 }
+#endif /* CONFIG_LOG_PER_CPU_BUFFERS */
 
 union log_msg_generic *z_log_msg_local_claim(void)
 {
-#ifdef CONFIG_MPSC_PBUF
+#if defined(CONFIG_LOG_PER_CPU_BUFFERS)
+	return cpu_msg_claim_oldest();
+#elif defined(CONFIG_MPSC_PBUF)
 	return (union log_msg_generic *)mpsc_pbuf_claim(&log_buffer);
 #else
 	return NULL;
@@ -824,7 +936,17 @@ bool z_log_msg_pending(void)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+		for (i = 0; i < LOG_BUFFER_COUNT; i++) {
+			if ((cpu_log_msg[i] != NULL) || msg_pending(log_buffer_get(i))) {
+				return true;
+			}
+		}
+
+		return false;
+#else
 		return msg_pending(&log_buffer);
+#endif
 	}
 
 	STRUCT_SECTION_FOREACH(log_msg_ptr, msg_ptr) {
@@ -850,7 +972,8 @@ void z_log_msg_enqueue(const struct log_link *link, const void *data, size_t len
 {
 	struct log_msg *log_msg = (struct log_msg *)data;
 	size_t wlen = DIV_ROUND_UP(ROUND_UP(len, Z_LOG_MSG_ALIGNMENT), sizeof(int));
-	struct mpsc_pbuf_buffer *mpsc_pbuffer = link->mpsc_pbuf ? link->mpsc_pbuf : &log_buffer;
+	struct mpsc_pbuf_buffer *mpsc_pbuffer = link->mpsc_pbuf ? link->mpsc_pbuf :
+							       local_buffer_get();
 	struct log_msg *local_msg = msg_alloc(mpsc_pbuffer, wlen);
 
 	if (!local_msg) {
@@ -903,7 +1026,17 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 		return -EINVAL;
 	}
 
-	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
+	*buf_size = 0;
+	*usage = 0;
+
+	for (int i = 0; i < LOG_BUFFER_COUNT; i++) {
+		uint32_t size;
+		uint32_t used;
+
+		mpsc_pbuf_get_utilization(log_buffer_get(i), &size, &used);
+		*buf_size += size;
+		*usage += used;
+	}
 
 	return 0;
 }
@@ -916,7 +1049,23 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
-	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+	*max = 0;
+
+	/* With per-CPU buffers this is the sum of the peak usage of each
+	 * buffer, an upper bound of the peak overall usage.
+	 */
+	for (int i = 0; i < LOG_BUFFER_COUNT; i++) {
+		uint32_t buf_max;
+		int err = mpsc_pbuf_get_max_utilization(log_buffer_get(i), &buf_max);
+
+		if (err < 0) {
+			return err;
+		}
+
+		*max += buf_max;
+	}
+
+	return 0;
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
@@ -593,6 +593,181 @@ uint32_t log_frontend_filter_get(int16_t source_id, bool runtime)
 	return filter_get(LOG_FRONTEND_SLOT_ID, Z_LOG_LOCAL_DOMAIN_ID, source_id, runtime);
 }
 
+#ifdef CONFIG_LOG_SOURCE_RATELIMIT
+#ifndef CONFIG_LOG_SOURCE_RATELIMIT_DEDUP_WINDOW_MS
+#define CONFIG_LOG_SOURCE_RATELIMIT_DEDUP_WINDOW_MS 0
+#endif
+
+/* Only protects updates of the settings. Sources are limited under their own
+ * lock and read each setting once, so a concurrent update is applied from the
+ * next message on.
+ */
+static struct k_spinlock ratelimit_lock;
+static atomic_t ratelimit_suppressed;
+static atomic_t ratelimit_repeated;
+static struct log_source_ratelimit_config ratelimit_config = {
+	.rate = CONFIG_LOG_SOURCE_RATELIMIT_RATE,
+	.burst = CONFIG_LOG_SOURCE_RATELIMIT_BURST,
+	.dedup = IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT_DEDUP),
+};
+
+/* Take a token from the source bucket, refilled at the configured rate. An
+ * empty (zeroed) state is a full bucket. Credit for a fraction of a token is
+ * carried over, so rates above one message per millisecond are not lost.
+ */
+static bool bucket_take(struct log_source_ratelimit_state *rl, uint32_t now,
+			uint32_t rate, uint32_t burst)
+{
+	if (rate == 0U) {
+		return true;
+	}
+
+	if (rl->used == 0U) {
+		rl->refill_time = now;
+		rl->refill_frac = 0U;
+	} else {
+		uint64_t credit = (uint64_t)(now - rl->refill_time) * rate + rl->refill_frac;
+		uint64_t refill = credit / MSEC_PER_SEC;
+
+		rl->refill_time = now;
+		if (refill >= rl->used) {
+			rl->used = 0U;
+			rl->refill_frac = 0U;
+		} else {
+			rl->used -= (uint16_t)refill;
+			rl->refill_frac = (uint16_t)(credit % MSEC_PER_SEC);
+		}
+	}
+
+	if (rl->used >= burst) {
+		return false;
+	}
+
+	rl->used++;
+
+	return true;
+}
+
+bool z_log_source_ratelimit_check(uint8_t level, void *source, const char *fmt)
+{
+	struct log_source_ratelimit_state *rl;
+	uint32_t rate = ratelimit_config.rate;
+	uint32_t burst = ratelimit_config.burst;
+	bool dedup = ratelimit_config.dedup;
+	uint32_t suppressed = 0U;
+	uint32_t repeated = 0U;
+	uint8_t repeated_level = 0U;
+	k_spinlock_key_t key;
+	uint32_t now;
+	bool ret = true;
+
+	/* Raw output is never limited and user mode cannot update the state. */
+	if ((level == LOG_LEVEL_NONE) || (source == NULL) || k_is_user_context()) {
+		return true;
+	}
+
+	rl = &((struct log_source_dynamic_data *)source)->ratelimit;
+	now = k_uptime_get_32();
+
+	key = k_spin_lock(&rl->lock);
+
+	if (dedup && (fmt != NULL) && (fmt == rl->fmt) &&
+	    (level == rl->level) &&
+	    ((now - rl->repeat_time) < CONFIG_LOG_SOURCE_RATELIMIT_DEDUP_WINDOW_MS)) {
+		if (rl->repeated < UINT16_MAX) {
+			rl->repeated++;
+		}
+		k_spin_unlock(&rl->lock, key);
+		atomic_inc(&ratelimit_repeated);
+
+		return false;
+	}
+
+	if (bucket_take(rl, now, rate, burst)) {
+		repeated = rl->repeated;
+		repeated_level = rl->level;
+		suppressed = rl->suppressed;
+
+		rl->fmt = fmt;
+		rl->level = level;
+		rl->repeat_time = now;
+		rl->repeated = 0U;
+		rl->suppressed = 0U;
+	} else {
+		if (rl->suppressed < UINT16_MAX) {
+			rl->suppressed++;
+		}
+		ret = false;
+	}
+
+	k_spin_unlock(&rl->lock, key);
+
+	if (!ret) {
+		atomic_inc(&ratelimit_suppressed);
+	}
+
+	/* Summaries are created directly so they are not subject to the check. */
+	if (repeated > 0U) {
+		z_log_msg_runtime_create(Z_LOG_LOCAL_DOMAIN_ID, source, repeated_level,
+					 NULL, 0, 0, "Previous message repeated %u times",
+					 repeated);
+	}
+
+	if (suppressed > 0U) {
+		z_log_msg_runtime_create(Z_LOG_LOCAL_DOMAIN_ID, source, level,
+					 NULL, 0, 0, "%u messages suppressed by rate limit",
+					 suppressed);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_LOG_SOURCE_RATELIMIT */
+
+int log_source_ratelimit_set(const struct log_source_ratelimit_config *config)
+{
+#ifdef CONFIG_LOG_SOURCE_RATELIMIT
+	k_spinlock_key_t key;
+
+	if ((config->burst == 0U) || (config->burst > UINT16_MAX) ||
+	    (config->dedup && !IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT_DEDUP))) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&ratelimit_lock);
+	ratelimit_config = *config;
+	k_spin_unlock(&ratelimit_lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(config);
+
+	return -ENOTSUP;
+#endif
+}
+
+int log_source_ratelimit_get(struct log_source_ratelimit_config *config,
+			      struct log_source_ratelimit_stats *stats)
+{
+#ifdef CONFIG_LOG_SOURCE_RATELIMIT
+	k_spinlock_key_t key = k_spin_lock(&ratelimit_lock);
+
+	*config = ratelimit_config;
+	if (stats != NULL) {
+		stats->suppressed = (uint32_t)atomic_get(&ratelimit_suppressed);
+		stats->repeated = (uint32_t)atomic_get(&ratelimit_repeated);
+	}
+
+	k_spin_unlock(&ratelimit_lock, key);
+
+	return 0;
+#else
+	ARG_UNUSED(config);
+	ARG_UNUSED(stats);
+
+	return -ENOTSUP;
+#endif
+}
+
 void z_log_links_initiate(void)
 {
 	int err;
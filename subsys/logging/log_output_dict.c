@@ -5,19 +5,148 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/cbprintf.h>
 #include <zephyr/sys/util.h>
 
+/* Maximum length of a LEB128 encoded 64 bit value. */
+#define VARINT_MAX_LEN 10
+
+static size_t varint_encode(uint8_t *buf, uint64_t value)
+{
+	size_t len = 0;
+
+	do {
+		buf[len] = value & 0x7FU;
+		value >>= 7;
+		if (value != 0U) {
+			buf[len] |= 0x80U;
+		}
+		len++;
+	} while (value != 0U);
+
+	return len;
+}
+
+/* Compact records are assembled in the output buffer so that a record which
+ * fits in it reaches the backend in a single call, e.g. a single datagram.
+ */
+static void compact_write(const struct log_output *output, const uint8_t *data, size_t len)
+{
+	struct log_output_control_block *cb = output->control_block;
+
+	if (IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
+		/* Output buffer cannot be shared in synchronous operation. */
+		log_output_write(output->func, (uint8_t *)data, len, cb->ctx);
+		return;
+	}
+
+	while (len > 0U) {
+		size_t offset = (size_t)atomic_get(&cb->offset);
+		size_t chunk;
+
+		if (offset == output->size) {
+			log_output_flush(output);
+			offset = 0;
+		}
+
+		chunk = MIN(len, output->size - offset);
+		memcpy(&output->buf[offset], data, chunk);
+		atomic_add(&cb->offset, chunk);
+
+		data += chunk;
+		len -= chunk;
+	}
+}
+
+static uint32_t compact_seq_next(const struct log_output *output)
+{
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+	return (uint32_t)atomic_inc(&output->control_block->dict_seq);
+#else
+	ARG_UNUSED(output);
+
+	return 0;
+#endif
+}
+
+static void compact_msg_process(const struct log_output *output, struct log_msg *msg)
+{
+	uint8_t hdr[2 + 5 * VARINT_MAX_LEN];
+	void *source = (void *)log_msg_get_source(msg);
+	size_t args_len = 0;
+	size_t hdr_len = 0;
+	size_t pkg_len;
+	size_t data_len;
+	uint8_t *package = log_msg_get_package(msg, &pkg_len);
+	uint8_t *data = log_msg_get_data(msg, &data_len);
+
+	if (pkg_len > 0U) {
+		union cbprintf_package_hdr *pkg_hdr = (union cbprintf_package_hdr *)package;
+
+		args_len = MIN(pkg_len, pkg_hdr->desc.len * sizeof(uint32_t));
+	}
+
+	hdr[hdr_len++] = MSG_NORMAL_COMPACT;
+	hdr[hdr_len++] = (msg->hdr.desc.level << 4) | (msg->hdr.desc.domain & 0x0F);
+	hdr_len += varint_encode(&hdr[hdr_len], compact_seq_next(output));
+	hdr_len += varint_encode(&hdr[hdr_len], (source != NULL) ? log_source_id(source) : 0U);
+	hdr_len += varint_encode(&hdr[hdr_len], msg->hdr.timestamp);
+	hdr_len += varint_encode(&hdr[hdr_len], pkg_len);
+	hdr_len += varint_encode(&hdr[hdr_len], data_len);
+
+	compact_write(output, hdr, hdr_len);
+
+	/* Arguments are mostly small integers. String indexes and appended
+	 * strings which follow them are output as is.
+	 */
+	for (size_t i = 0; i < args_len; i += sizeof(uint32_t)) {
+		uint8_t word[VARINT_MAX_LEN];
+		size_t len = varint_encode(word, UNALIGNED_GET((uint32_t *)&package[i]));
+
+		compact_write(output, word, len);
+	}
+
+	if (pkg_len > args_len) {
+		compact_write(output, &package[args_len], pkg_len - args_len);
+	}
+
+	if (data_len > 0U) {
+		compact_write(output, data, data_len);
+	}
+
+	log_output_flush(output);
+}
+
+static void compact_dropped_process(const struct log_output *output, uint32_t cnt)
+{
+	uint8_t buf[1 + 2 * VARINT_MAX_LEN];
+	size_t len = 0;
+
+	buf[len++] = MSG_DROPPED_MSG_COMPACT;
+	len += varint_encode(&buf[len], compact_seq_next(output));
+	len += varint_encode(&buf[len], cnt);
+
+	compact_write(output, buf, len);
+	log_output_flush(output);
+}
+
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
 {
 	struct log_dict_output_normal_msg_hdr_t output_hdr;
 	void *source = (void *)log_msg_get_source(msg);
 
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_COMPACT)) {
+		compact_msg_process(output, msg);
+		return;
+	}
+
 	/* Keep sync with header in struct log_msg */
 	output_hdr.type = MSG_NORMAL;
 	output_hdr.domain = msg->hdr.desc.domain;
@@ -50,6 +179,11 @@ void log_dict_output_dropped_process(const struct log_output *output, uint32_t c
 {
 	struct log_dict_output_dropped_msg_t msg;
 
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_COMPACT)) {
+		compact_dropped_process(output, cnt);
+		return;
+	}
+
 	msg.type = MSG_DROPPED_MSG;
 	msg.num_dropped_messages = MIN(cnt, 9999);
 
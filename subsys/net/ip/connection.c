@@ -18,6 +18,7 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #include <errno.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/hash_function.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
@@ -113,6 +114,217 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+/* Copy what net_conn_update() may change */
+static void conn_copy_update(struct net_conn *conn, const struct net_conn *updated)
+{
+	conn->remote_addr = updated->remote_addr;
+	conn->local_addr = updated->local_addr;
+	conn->cb = updated->cb;
+	conn->user_data = updated->user_data;
+	conn->flags = updated->flags;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_CONN_HASH_SIZE),
+	     "CONFIG_NET_CONN_HASH_SIZE must be a power of 2");
+
+/** All local and remote address and port bits set */
+#define NET_CONN_EXACT (NET_CONN_REMOTE_ADDR_SPEC | NET_CONN_LOCAL_ADDR_SPEC | \
+			NET_CONN_REMOTE_PORT_SPEC | NET_CONN_LOCAL_PORT_SPEC)
+
+struct net_conn_bucket {
+	sys_slist_t list;
+	struct k_spinlock lock;
+};
+
+/* UDP and TCP connections are kept in one of these tables, in addition
+ * to the conn_used list, so that received packets can be matched against
+ * a few candidates. The buckets have their own locks, the RX path does not
+ * need conn_lock.
+ */
+
+/* Fully specified connections, hashed by protocol, addresses and ports */
+static struct net_conn_bucket conn_exact[CONFIG_NET_CONN_HASH_SIZE];
+
+/* Other connections bound to a local port, hashed by protocol and port */
+static struct net_conn_bucket conn_listen[CONFIG_NET_CONN_HASH_SIZE];
+
+/* Connections not bound to a local port */
+static struct net_conn_bucket conn_wild;
+
+/* Ports are in network byte order */
+static uint32_t conn_exact_hash(uint16_t proto, uint8_t family,
+				const uint8_t *remote_addr,
+				const uint8_t *local_addr,
+				uint16_t remote_port, uint16_t local_port)
+{
+	struct {
+		uint8_t remote_addr[NET_IPV6_ADDR_SIZE];
+		uint8_t local_addr[NET_IPV6_ADDR_SIZE];
+		uint16_t remote_port;
+		uint16_t local_port;
+		uint16_t proto;
+		uint16_t family;
+	} key = {
+		.remote_port = remote_port,
+		.local_port = local_port,
+		.proto = proto,
+		.family = family,
+	};
+	size_t len = (family == NET_AF_INET6) ? NET_IPV6_ADDR_SIZE : NET_IPV4_ADDR_SIZE;
+
+	memcpy(key.remote_addr, remote_addr, len);
+	memcpy(key.local_addr, local_addr, len);
+
+	return sys_hash32_murmur3(&key, sizeof(key)) & (CONFIG_NET_CONN_HASH_SIZE - 1);
+}
+
+static uint32_t conn_listen_hash(uint16_t proto, uint16_t local_port)
+{
+	uint16_t key[] = { proto, local_port };
+
+	return sys_hash32_murmur3(key, sizeof(key)) & (CONFIG_NET_CONN_HASH_SIZE - 1);
+}
+
+static const uint8_t *conn_addr_raw(const struct net_sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == NET_AF_INET6) {
+		return net_sin6(addr)->sin6_addr.s6_addr;
+	}
+
+	return net_sin(addr)->sin_addr.s4_addr;
+}
+
+static struct net_conn_bucket *conn_hash_bucket(const struct net_conn *conn)
+{
+	if (conn->proto != NET_IPPROTO_UDP && conn->proto != NET_IPPROTO_TCP) {
+		return NULL;
+	}
+
+	if (conn->family != NET_AF_INET && conn->family != NET_AF_INET6) {
+		/* Matched against packets of any IP family */
+		return (conn->family == NET_AF_UNSPEC) ? &conn_wild : NULL;
+	}
+
+	if ((conn->flags & NET_CONN_EXACT) == NET_CONN_EXACT &&
+	    conn->remote_addr.sa_family == conn->family &&
+	    conn->local_addr.sa_family == conn->family) {
+		return &conn_exact[conn_exact_hash(conn->proto, conn->family,
+						   conn_addr_raw(&conn->remote_addr),
+						   conn_addr_raw(&conn->local_addr),
+						   net_sin(&conn->remote_addr)->sin_port,
+						   net_sin(&conn->local_addr)->sin_port)];
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0) {
+		return &conn_listen[conn_listen_hash(conn->proto,
+						     net_sin(&conn->local_addr)->sin_port)];
+	}
+
+	return &conn_wild;
+}
+
+static void conn_hash_add(struct net_conn *conn)
+{
+	struct net_conn_bucket *bucket = conn_hash_bucket(conn);
+	k_spinlock_key_t key;
+
+	if (bucket == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&bucket->lock);
+	sys_slist_prepend(&bucket->list, &conn->hash_node);
+	conn->bucket = bucket;
+	k_spin_unlock(&bucket->lock, key);
+}
+
+static void conn_hash_remove(struct net_conn *conn)
+{
+	struct net_conn_bucket *bucket = conn->bucket;
+	k_spinlock_key_t key;
+
+	if (bucket == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&bucket->lock);
+	sys_slist_find_and_remove(&bucket->list, &conn->hash_node);
+	conn->bucket = NULL;
+	k_spin_unlock(&bucket->lock, key);
+}
+
+/* Apply the addresses and callback of @a updated to @a conn and move it to
+ * the bucket they map to. Both buckets are locked while the connection
+ * changes, so the RX path sees it either before or after the update, and
+ * always finds it.
+ */
+static void conn_hash_update(struct net_conn *conn, const struct net_conn *updated)
+{
+	struct net_conn_bucket *from = conn->bucket;
+	struct net_conn_bucket *to = conn_hash_bucket(updated);
+	struct net_conn_bucket *first = from;
+	struct net_conn_bucket *second = to;
+	k_spinlock_key_t key1 = { 0 };
+	k_spinlock_key_t key2 = { 0 };
+
+	/* Connections are only updated with conn_lock held, so any fixed
+	 * order is enough to avoid deadlocks.
+	 */
+	if ((first == NULL) || ((second != NULL) && (second < first))) {
+		first = to;
+		second = from;
+	}
+
+	if (second == first) {
+		second = NULL;
+	}
+
+	if (first != NULL) {
+		key1 = k_spin_lock(&first->lock);
+	}
+
+	if (second != NULL) {
+		key2 = k_spin_lock(&second->lock);
+	}
+
+	if (from != NULL) {
+		sys_slist_find_and_remove(&from->list, &conn->hash_node);
+	}
+
+	conn_copy_update(conn, updated);
+
+	if (to != NULL) {
+		sys_slist_prepend(&to->list, &conn->hash_node);
+	}
+
+	conn->bucket = to;
+
+	if (second != NULL) {
+		k_spin_unlock(&second->lock, key2);
+	}
+
+	if (first != NULL) {
+		k_spin_unlock(&first->lock, key1);
+	}
+}
+#else
+static inline void conn_hash_add(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void conn_hash_remove(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void conn_hash_update(struct net_conn *conn, const struct net_conn *updated)
+{
+	conn_copy_update(conn, updated);
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -138,6 +350,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -462,6 +675,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 	NET_DBG("Connection handler %p removed", conn);
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_remove(conn);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
 	k_mutex_unlock(&conn_lock);
 
@@ -479,6 +693,7 @@ int net_conn_update(struct net_conn_handle *handle,
 		    uint16_t local_port)
 {
 	struct net_conn *conn = (struct net_conn *)handle;
+	struct net_conn updated;
 	int ret;
 
 	if (conn < &conns[0] || conn > &conns[CONFIG_NET_MAX_CONN]) {
@@ -489,14 +704,23 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
-	net_conn_change_callback(conn, cb, user_data);
+	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	ret = net_conn_change_local(conn, local_addr, local_port);
-	if (ret < 0) {
-		return ret;
+	/* The addresses decide which hash bucket the connection is in, so
+	 * prepare the update on a copy and apply it in one go.
+	 */
+	updated = *conn;
+
+	net_conn_change_callback(&updated, cb, user_data);
+
+	ret = net_conn_change_local(&updated, local_addr, local_port);
+	if (ret == 0) {
+		ret = net_conn_change_remote(&updated, remote_addr, remote_port);
 	}
 
-	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	conn_hash_update(conn, &updated);
+
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -608,6 +832,170 @@ static bool is_iface_matching(struct net_conn *conn, struct net_pkt *pkt)
 	return (net_pkt_iface(pkt) == net_context_get_iface(conn->context));
 }
 
+/* Is the candidate connection accepting the UDP or TCP packet? */
+static bool conn_match(struct net_conn *conn, struct net_pkt *pkt,
+		       union net_ip_header *ip_hdr, uint8_t proto,
+		       uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (!is_iface_matching(conn, pkt)) {
+		return false; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != NET_AF_UNSPEC && conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == NET_AF_INET6 && pkt_family == NET_AF_INET &&
+			      !conn->v6only && conn->type != NET_SOCK_RAW)) {
+				return false;
+			}
+		} else {
+			return false; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != proto) {
+		return false; /* wrong protocol */
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	if (!(IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) ||
+	    !(conn->family == NET_AF_INET || conn->family == NET_AF_INET6 ||
+	      conn->family == NET_AF_UNSPEC)) {
+		return false;
+	}
+
+	/* Is the candidate connection matching the packet's TCP/UDP
+	 * address and port?
+	 */
+	if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == NET_AF_INET6 &&
+			      pkt_family == NET_AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping,
+		 * continue with rank checking.
+		 */
+	}
+
+	return true;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+/* Find the best connection for a unicast or broadcast UDP/TCP packet
+ * without going through all connections.
+ */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port, uint16_t dst_port,
+					 net_conn_cb_t *cb, void **user_data)
+{
+	struct net_conn_bucket *buckets[] = {
+		&conn_listen[conn_listen_hash(proto, dst_port)],
+		&conn_wild,
+	};
+	struct net_conn_bucket *bucket;
+	struct net_conn *best_match = NULL;
+	int16_t best_rank = -1;
+	k_spinlock_key_t key;
+	struct net_conn *conn;
+
+	/* A fully specified connection has the highest possible rank */
+	if (net_pkt_family(pkt) == NET_AF_INET6) {
+		bucket = &conn_exact[conn_exact_hash(proto, NET_AF_INET6,
+						     ip_hdr->ipv6->src, ip_hdr->ipv6->dst,
+						     src_port, dst_port)];
+	} else {
+		bucket = &conn_exact[conn_exact_hash(proto, NET_AF_INET,
+						     ip_hdr->ipv4->src, ip_hdr->ipv4->dst,
+						     src_port, dst_port)];
+	}
+
+	key = k_spin_lock(&bucket->lock);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&bucket->list, conn, hash_node) {
+		if (conn_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			*cb = conn->cb;
+			*user_data = conn->user_data;
+			k_spin_unlock(&bucket->lock, key);
+
+			return conn;
+		}
+	}
+
+	k_spin_unlock(&bucket->lock, key);
+
+	/* Otherwise rank the connections bound to the local port, and those
+	 * not bound to any port.
+	 */
+	ARRAY_FOR_EACH(buckets, i) {
+		bucket = buckets[i];
+		key = k_spin_lock(&bucket->lock);
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&bucket->list, conn, hash_node) {
+			if (best_rank >= NET_CONN_RANK(conn->flags) ||
+			    !conn_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+				continue;
+			}
+
+			best_rank = NET_CONN_RANK(conn->flags);
+			best_match = conn;
+			*cb = conn->cb;
+			*user_data = conn->user_data;
+		}
+
+		k_spin_unlock(&bucket->lock, key);
+	}
+
+	return best_match;
+}
+#else
+static inline struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+						union net_ip_header *ip_hdr,
+						uint8_t proto,
+						uint16_t src_port, uint16_t dst_port,
+						net_conn_cb_t *cb, void **user_data)
+{
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 #if defined(CONFIG_NET_SOCKETS_PACKET) || defined(CONFIG_NET_SOCKETS_INET_RAW)
 static void conn_raw_socket_deliver(struct net_pkt *pkt, struct net_conn *conn,
 				    bool is_ip)
@@ -907,119 +1295,55 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		is_mcast_pkt = net_ipv6_is_addr_mcast_raw(ip_hdr->ipv6->dst);
 	}
 
+	if (IS_ENABLED(CONFIG_NET_CONN_HASH) && !is_mcast_pkt) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port,
+					      &cb, &user_data);
+		goto deliver;
+	}
+
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
+		if (!conn_match(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			continue;
 		}
 
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != NET_AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == NET_AF_INET6 && pkt_family == NET_AF_INET &&
-				      !conn->v6only && conn->type != NET_SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
-			}
-
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
+		if (best_rank < NET_CONN_RANK(conn->flags)) {
+			struct net_pkt *mcast_pkt;
 
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
-		}
+			if (!is_mcast_pkt) {
+				best_rank = NET_CONN_RANK(conn->flags);
+				best_match = conn;
 
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
+				continue; /* found a match - but maybe not yet the best */
+			}
 
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == NET_AF_INET || conn_family == NET_AF_INET6 ||
-		     conn_family == NET_AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
+			/* If we have a multicast packet, and we found
+			 * a match, then deliver the packet immediately
+			 * to the handler. As there might be several
+			 * sockets interested about these, we need to
+			 * clone the received pkt.
 			 */
-			if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
 
-			if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
+			NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
+				conn->user_data);
 
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
+			mcast_pkt = net_pkt_clone(
+				pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
+			if (!mcast_pkt) {
+				k_mutex_unlock(&conn_lock);
+				goto drop;
 			}
 
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == NET_AF_INET6 &&
-					      pkt_family == NET_AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
+			    NET_DROP) {
+				net_stats_update_per_proto_drop(pkt_iface, proto);
+				net_pkt_unref(mcast_pkt);
+			} else {
+				net_stats_update_per_proto_recv(pkt_iface, proto);
 			}
 
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
-
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
-
-					continue; /* found a match - but maybe not yet the best */
-				}
-
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
-
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
-
-				mcast_pkt = net_pkt_clone(
-					pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
-
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
-
-				mcast_pkt_delivered = true;
-			}
+			mcast_pkt_delivered = true;
 		}
 	} /* loop end */
 
@@ -1030,6 +1354,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_unlock(&conn_lock);
 
+deliver:
 	if (is_mcast_pkt && mcast_pkt_delivered) {
 		/* As one or more multicast packets
 		 * have already been delivered in the loop above,
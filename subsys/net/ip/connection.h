@@ -30,6 +30,8 @@ struct net_conn;
 
 struct net_conn_handle;
 
+struct net_conn_bucket;
+
 /**
  * @brief Function that is called by connection subsystem when a
  * net packet is received which matches local and remote address
@@ -54,6 +56,14 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Internal slist node of the hash bucket */
+	sys_snode_t hash_node;
+
+	/** Hash bucket the connection is in, NULL if none */
+	struct net_conn_bucket *bucket;
+#endif
+
 	/** Remote socket address */
 	struct net_sockaddr remote_addr;
 
@@ -585,14 +585,23 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 
 	net_pkt_set_iface(pkt, iface);
 
-	if (!net_pkt_filter_recv_ok(pkt)) {
+	switch (net_pkt_filter_recv(pkt)) {
+	case NET_DROP:
 		/* Silently drop the packet, but update the statistics in order
 		 * to be able to monitor filter activity.
 		 */
-		net_stats_update_filter_rx_drop(net_pkt_iface(pkt));
+		net_stats_update_filter_rx_drop(iface);
 		net_pkt_unref(pkt);
-	} else {
+		break;
+	case NET_OK:
+		/* The packet was redirected by a filter rule and no longer
+		 * belongs to us.
+		 */
+		net_stats_update_filter_rx_redirect(iface);
+		break;
+	default:
 		net_queue_rx(iface, pkt);
+		break;
 	}
 
 	ret = 0;
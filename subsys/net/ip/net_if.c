@@ -502,6 +502,13 @@ enum net_verdict net_if_try_send_data(struct net_if *iface, struct net_pkt *pkt,
 				       net_pkt_lladdr_if(pkt)->len);
 	}
 
+	/* Cut large TCP packets into segments unless the device does it */
+	if (net_pkt_gso_size(pkt) > 0 && !net_if_tx_tso_supported(iface)) {
+		status = net_tcp_gso_segment(pkt);
+		verdict = status < 0 ? NET_DROP : NET_CONTINUE;
+		goto done;
+	}
+
 #if defined(CONFIG_NET_LOOPBACK)
 	/* If the packet is destined back to us, then there is no need to do
 	 * additional checks, so let the packet through.
@@ -5626,6 +5633,34 @@ void net_if_call_link_cb(struct net_if *iface, struct net_linkaddr *lladdr,
 	k_mutex_unlock(&lock);
 }
 
+#if defined(CONFIG_NET_L2_ETHERNET)
+/* Return the Ethernet interface doing the offloading for the given one,
+ * or NULL if it cannot offload anything.
+ */
+static struct net_if *get_offload_iface(struct net_if *iface)
+{
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		return iface;
+	}
+
+	/* For VLANs, figure out the main Ethernet interface and
+	 * get the offloading capabilities from it.
+	 */
+	if (IS_ENABLED(CONFIG_NET_VLAN) && net_eth_is_vlan_interface(iface)) {
+		iface = net_eth_get_vlan_main(iface);
+		if (iface == NULL) {
+			return NULL;
+		}
+
+		NET_ASSERT(net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET));
+
+		return iface;
+	}
+
+	return NULL;
+}
+#endif
+
 static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps,
 			      enum net_if_checksum_type chksum_type)
 {
@@ -5633,20 +5668,9 @@ static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps,
 	struct ethernet_config config;
 	enum ethernet_config_type config_type;
 
-	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
-		/* For VLANs, figure out the main Ethernet interface and
-		 * get the offloading capabilities from it.
-		 */
-		if (IS_ENABLED(CONFIG_NET_VLAN) && net_eth_is_vlan_interface(iface)) {
-			iface = net_eth_get_vlan_main(iface);
-			if (iface == NULL) {
-				return true;
-			}
-
-			NET_ASSERT(net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET));
-		} else {
-			return true;
-		}
+	iface = get_offload_iface(iface);
+	if (iface == NULL) {
+		return true;
 	}
 
 	if (!(net_eth_get_hw_capabilities(iface) & caps)) {
@@ -5683,6 +5707,22 @@ bool net_if_need_calc_rx_checksum(struct net_if *iface, enum net_if_checksum_typ
 	return need_calc_checksum(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD, chksum_type);
 }
 
+bool net_if_tx_tso_supported(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	iface = get_offload_iface(iface);
+	if (iface == NULL) {
+		return false;
+	}
+
+	return !!(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TX_TSO);
+#else
+	ARG_UNUSED(iface);
+
+	return false;
+#endif
+}
+
 int net_if_get_by_iface(struct net_if *iface)
 {
 	if (!(iface >= _net_if_list_start && iface < _net_if_list_end)) {
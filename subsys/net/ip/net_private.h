@@ -61,6 +61,7 @@ extern void net_if_post_init(void);
 extern void net_if_stats_reset(struct net_if *iface);
 extern void net_if_stats_reset_all(void);
 extern const char *net_if_oper_state2str(enum net_if_oper_state state);
+extern bool net_if_tx_tso_supported(struct net_if *iface);
 extern void net_process_rx_packet(struct net_pkt *pkt);
 extern void net_process_tx_packet(struct net_pkt *pkt);
 
@@ -211,6 +212,9 @@ enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 extern enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
 extern int net_tc_tx_thread_priority(int tc);
 extern int net_tc_rx_thread_priority(int tc);
+#if defined(CONFIG_NET_TCP_GRO)
+extern struct net_tcp_gro *net_tc_rx_gro_get(void);
+#endif
 static inline bool net_tc_tx_is_immediate(int tc, int prio)
 {
 	ARG_UNUSED(prio);
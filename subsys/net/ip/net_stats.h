@@ -91,12 +91,20 @@ static inline void net_stats_update_filter_rx_local_drop(struct net_if *iface)
 	UPDATE_STAT(iface, stats.pkt_filter.rx.local_drop++);
 #endif
 }
+
+static inline void net_stats_update_filter_rx_redirect(struct net_if *iface)
+{
+#if defined(CONFIG_NET_PKT_FILTER_REDIRECT)
+	UPDATE_STAT(iface, stats.pkt_filter.rx.redirect++);
+#endif
+}
 #else /* CONFIG_NET_STATISTICS_PKT_FILTER */
 #define net_stats_update_filter_rx_drop(iface)
 #define net_stats_update_filter_tx_drop(iface)
 #define net_stats_update_filter_rx_ipv4_drop(iface)
 #define net_stats_update_filter_rx_ipv6_drop(iface)
 #define net_stats_update_filter_rx_local_drop(iface)
+#define net_stats_update_filter_rx_redirect(iface)
 #endif /* CONFIG_NET_STATISTICS_PKT_FILTER */
 #else
 #define net_stats_update_processing_error(iface)
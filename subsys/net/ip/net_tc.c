@@ -13,26 +13,34 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/sys/byteorder.h>
 
 #include "net_private.h"
+#include "ipv4.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "tcp_internal.h"
 
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
-#define NET_TC_RX_SLOTS (CONFIG_NET_PKT_RX_COUNT / NET_TC_RX_EFFECTIVE_COUNT)
+#define NET_TC_RX_SLOTS \
+	(CONFIG_NET_PKT_RX_COUNT / (NET_TC_RX_EFFECTIVE_COUNT * NET_TC_RX_QUEUES))
 BUILD_ASSERT(NET_TC_RX_SLOTS > 0,
 		"Misconfiguration: There are more traffic classes then packets, "
 		"either increase CONFIG_NET_PKT_RX_COUNT or decrease "
-		"CONFIG_NET_TC_RX_COUNT or disable CONFIG_NET_TC_RX_SKIP_FOR_HIGH_PRIO");
+		"CONFIG_NET_TC_RX_COUNT or CONFIG_NET_TC_RX_QUEUES or disable "
+		"CONFIG_NET_TC_RX_SKIP_FOR_HIGH_PRIO");
 #endif
 
 
 #if NET_TC_TX_EFFECTIVE_COUNT > 1
-#define NET_TC_TX_SLOTS (CONFIG_NET_PKT_TX_COUNT / NET_TC_TX_EFFECTIVE_COUNT)
+#define NET_TC_TX_SLOTS \
+	(CONFIG_NET_PKT_TX_COUNT / (NET_TC_TX_EFFECTIVE_COUNT * NET_TC_TX_QUEUES))
 BUILD_ASSERT(NET_TC_TX_SLOTS > 0,
 		"Misconfiguration: There are more traffic classes then packets, "
 		"either increase CONFIG_NET_PKT_TX_COUNT or decrease "
-		"CONFIG_NET_TC_TX_COUNT or disable CONFIG_NET_TC_TX_SKIP_FOR_HIGH_PRIO");
+		"CONFIG_NET_TC_TX_COUNT or CONFIG_NET_TC_TX_QUEUES or disable "
+		"CONFIG_NET_TC_TX_SKIP_FOR_HIGH_PRIO");
 #endif
 
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
@@ -41,38 +49,219 @@ BUILD_ASSERT(NET_TC_TX_SLOTS > 0,
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
  * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * If a traffic class has several queues, ".z" is the index of the queue in
+ * the class.
  */
-#define MAX_NAME_LEN sizeof("xx_q[y]")
+#define MAX_NAME_LEN sizeof("xx_q[y.z]")
 
 /* Stacks for TX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT * NET_TC_TX_QUEUES,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT * NET_TC_RX_QUEUES,
 			    CONFIG_NET_RX_STACK_SIZE);
 
+/* The queues of the traffic class tc are at [tc * NET_TC_xX_QUEUES] */
 #if NET_TC_TX_COUNT > 0
-static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
+static struct net_traffic_class tx_classes[NET_TC_TX_COUNT * NET_TC_TX_QUEUES];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+static struct net_traffic_class rx_classes[NET_TC_RX_COUNT * NET_TC_RX_QUEUES];
+
+#if defined(CONFIG_NET_TCP_GRO)
+/* Segments held for coalescing by each RX queue, see rx_classes */
+static struct net_tcp_gro rx_gro[NET_TC_RX_COUNT * NET_TC_RX_QUEUES];
+#endif
+#endif
+
+#if NET_TC_TX_QUEUES > 1 || NET_TC_RX_QUEUES > 1
+#define FLOW_HASH_INIT 2166136261U
+#define FLOW_HASH_PRIME 16777619U
+
+/* FNV-1a, cheap and good enough to spread the flows over a few queues */
+static uint32_t flow_hash_add(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *ptr = data;
+
+	while (len-- > 0) {
+		hash = (hash ^ *ptr++) * FLOW_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+/* Move the cursor of a received packet past its L2 header, the packet has
+ * not been through L2 yet. Returns false if the L2 header is not known to be
+ * followed by an IP header, e.g. with IEEE 802.15.4 the IP header is only
+ * there after 6LoWPAN decompression.
+ */
+static bool flow_skip_l2(struct net_pkt *pkt)
+{
+	const struct net_l2 *l2 = net_if_l2(net_pkt_iface(pkt));
+
+#if defined(CONFIG_NET_L2_DUMMY)
+	/* Dummy L2, like the loopback interface, carries raw IP packets */
+	if (l2 == &NET_L2_GET_NAME(DUMMY)) {
+		return true;
+	}
+#endif
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (l2 == &NET_L2_GET_NAME(ETHERNET)) {
+		uint16_t type;
+
+		if (net_pkt_skip(pkt, offsetof(struct net_eth_hdr, type)) ||
+		    net_pkt_read_be16(pkt, &type)) {
+			return false;
+		}
+
+		if (type == NET_ETH_PTYPE_VLAN &&
+		    (net_pkt_skip(pkt, sizeof(uint16_t)) ||
+		     net_pkt_read_be16(pkt, &type))) {
+			return false;
+		}
+
+		return type == NET_ETH_PTYPE_IP || type == NET_ETH_PTYPE_IPV6;
+	}
+#endif
+
+	ARG_UNUSED(l2);
+
+	return false;
+}
+
+/* Software fallback of the receive side scaling: hash the addresses, the
+ * protocol and, when they are there, the TCP or UDP ports of the packet.
+ * Packets which are not IP, or received on an L2 not delivering plain IP
+ * packets, all get the same hash.
+ */
+static uint32_t flow_hash_calc(struct net_pkt *pkt, bool rx)
+{
+	union {
+		struct net_ipv4_hdr ipv4;
+		struct net_ipv6_hdr ipv6;
+	} hdr;
+	bool overwrite = net_pkt_is_being_overwritten(pkt);
+	struct net_pkt_cursor backup;
+	uint32_t hash = FLOW_HASH_INIT;
+	bool has_ports = true;
+	uint16_t ports[2];
+	size_t opts_len;
+	uint8_t proto;
+
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (rx ? !flow_skip_l2(pkt) :
+	    net_pkt_family(pkt) != NET_AF_INET && net_pkt_family(pkt) != NET_AF_INET6) {
+		goto out;
+	}
+
+	if (net_pkt_read(pkt, &hdr.ipv4, sizeof(hdr.ipv4))) {
+		goto out;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && (hdr.ipv4.vhl & 0xf0) == 0x40) {
+		proto = hdr.ipv4.proto;
+		opts_len = (hdr.ipv4.vhl & NET_IPV4_IHL_MASK) * 4U - sizeof(hdr.ipv4);
+		hash = flow_hash_add(hash, hdr.ipv4.src, 2 * NET_IPV4_ADDR_SIZE);
+
+		/* Only the first fragment has the ports, keep the fragments
+		 * of a datagram together.
+		 */
+		if (sys_get_be16(hdr.ipv4.offset) &
+		    ((NET_IPV4_MF << 13) | NET_IPV4_FRAGH_OFFSET_MASK)) {
+			has_ports = false;
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && (hdr.ipv4.vhl & 0xf0) == 0x60) {
+		if (net_pkt_read(pkt, (uint8_t *)&hdr + sizeof(hdr.ipv4),
+				 sizeof(hdr.ipv6) - sizeof(hdr.ipv4))) {
+			goto out;
+		}
+
+		/* Extension headers are not walked, the ports are only used
+		 * if the transport header follows the IPv6 one.
+		 */
+		proto = hdr.ipv6.nexthdr;
+		opts_len = 0;
+		hash = flow_hash_add(hash, hdr.ipv6.src, 2 * NET_IPV6_ADDR_SIZE);
+	} else {
+		goto out;
+	}
+
+	hash = flow_hash_add(hash, &proto, sizeof(proto));
+
+	if (has_ports && (proto == NET_IPPROTO_TCP || proto == NET_IPPROTO_UDP) &&
+	    !net_pkt_skip(pkt, opts_len) && !net_pkt_read(pkt, ports, sizeof(ports))) {
+		hash = flow_hash_add(hash, ports, sizeof(ports));
+	}
+
+out:
+	net_pkt_cursor_restore(pkt, &backup);
+	net_pkt_set_overwrite(pkt, overwrite);
+
+	return hash;
+}
+
+/* Use the hash reported by the driver if any, so that devices with several
+ * hardware rings keep their flows on the same queue.
+ */
+static uint32_t flow_hash_get(struct net_pkt *pkt, bool rx)
+{
+	if (!net_pkt_has_flow_hash(pkt)) {
+		net_pkt_set_flow_hash(pkt, flow_hash_calc(pkt, rx));
+	}
+
+	return net_pkt_flow_hash(pkt);
+}
+#endif /* NET_TC_TX_QUEUES > 1 || NET_TC_RX_QUEUES > 1 */
+
+#if NET_TC_TX_COUNT > 0
+static struct net_traffic_class *tx_queue_get(uint8_t tc, struct net_pkt *pkt)
+{
+#if NET_TC_TX_QUEUES > 1
+	return &tx_classes[tc * NET_TC_TX_QUEUES +
+			   flow_hash_get(pkt, false) % NET_TC_TX_QUEUES];
+#else
+	ARG_UNUSED(pkt);
+
+	return &tx_classes[tc];
+#endif
+}
+#endif
+
+#if NET_TC_RX_COUNT > 0
+static struct net_traffic_class *rx_queue_get(uint8_t tc, struct net_pkt *pkt)
+{
+#if NET_TC_RX_QUEUES > 1
+	return &rx_classes[tc * NET_TC_RX_QUEUES +
+			   flow_hash_get(pkt, true) % NET_TC_RX_QUEUES];
+#else
+	ARG_UNUSED(pkt);
+
+	return &rx_classes[tc];
+#endif
+}
 #endif
 
 enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 					       k_timeout_t timeout)
 {
 #if NET_TC_TX_COUNT > 0
+	struct net_traffic_class *queue = tx_queue_get(tc, pkt);
+
 	net_pkt_set_tx_stats_tick(pkt, k_cycle_get_32());
 
 #if NET_TC_TX_EFFECTIVE_COUNT > 1
-	if (k_sem_take(&tx_classes[tc].fifo_slot, timeout) != 0) {
+	if (k_sem_take(&queue->fifo_slot, timeout) != 0) {
 		return NET_DROP;
 	}
 #endif
 
-	k_fifo_put(&tx_classes[tc].fifo, pkt);
+	k_fifo_put(&queue->fifo, pkt);
 	return NET_OK;
 #else
 	ARG_UNUSED(tc);
@@ -84,13 +273,14 @@ enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 #if NET_TC_RX_COUNT > 0
+	struct net_traffic_class *queue = rx_queue_get(tc, pkt);
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	uint8_t retry_cnt = NET_TC_RETRY_CNT;
 #endif
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
-	while (k_sem_take(&rx_classes[tc].fifo_slot, K_NO_WAIT) != 0) {
+	while (k_sem_take(&queue->fifo_slot, K_NO_WAIT) != 0) {
 		if (k_is_in_isr() || retry_cnt == 0) {
 			return NET_DROP;
 		}
@@ -103,7 +293,7 @@ enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 	}
 #endif
 
-	k_fifo_put(&rx_classes[tc].fifo, pkt);
+	k_fifo_put(&queue->fifo, pkt);
 	return NET_OK;
 #else
 	ARG_UNUSED(tc);
@@ -252,17 +442,45 @@ static void net_tc_rx_stats_priority_setup(struct net_if *iface,
 #endif
 #endif
 
+#if defined(CONFIG_NET_TCP_GRO)
+/* Return the GRO state of the RX queue whose thread is running, NULL if the
+ * packet is not processed by an RX queue thread, e.g. it was received in
+ * the immediate path or looped back by the sending thread. Nothing is held
+ * then, as nothing would flush it.
+ */
+struct net_tcp_gro *net_tc_rx_gro_get(void)
+{
+#if NET_TC_RX_COUNT > 0
+	uintptr_t thread = (uintptr_t)k_current_get();
+	size_t idx;
+
+	if (thread < (uintptr_t)&rx_classes[0] ||
+	    thread >= (uintptr_t)&rx_classes[ARRAY_SIZE(rx_classes)]) {
+		return NULL;
+	}
+
+	idx = (thread - (uintptr_t)&rx_classes[0]) / sizeof(rx_classes[0]);
+	if (thread != (uintptr_t)&rx_classes[idx].handler) {
+		return NULL;
+	}
+
+	return &rx_gro[idx];
+#else
+	return NULL;
+#endif
+}
+#endif /* CONFIG_NET_TCP_GRO */
+
 #if NET_TC_RX_COUNT > 0
 static void tc_rx_handler(void *p1, void *p2, void *p3)
 {
-	ARG_UNUSED(p3);
-
 	struct k_fifo *fifo = p1;
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	struct k_sem *fifo_slot = p2;
 #else
 	ARG_UNUSED(p2);
 #endif
+	struct net_tcp_gro *gro = p3;
 	struct net_pkt *pkt;
 
 	while (1) {
@@ -276,6 +494,11 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 #endif
 
 		net_process_rx_packet(pkt);
+
+		/* End of the burst, process what was held for coalescing */
+		if (k_fifo_is_empty(fifo)) {
+			net_tcp_gro_flush(gro);
+		}
 	}
 }
 #endif
@@ -325,9 +548,9 @@ void net_tc_tx_init(void)
 	net_if_foreach(net_tc_tx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_TX_COUNT; i++) {
+	for (i = 0; i < NET_TC_TX_COUNT * NET_TC_TX_QUEUES; i++) {
 		k_tid_t tid;
-		int priority = net_tc_tx_thread_priority(i);
+		int priority = net_tc_tx_thread_priority(i / NET_TC_TX_QUEUES);
 
 		NET_DBG("[%d] Starting TX handler %p stack size %zd prio %d", i,
 			&tx_classes[i].handler,
@@ -356,10 +579,23 @@ void net_tc_tx_init(void)
 			continue;
 		}
 
+#if defined(CONFIG_SCHED_CPU_MASK) && NET_TC_TX_QUEUES > 1
+		/* Spread the queues of the class over the CPUs */
+		if (k_thread_cpu_pin(tid, (i % NET_TC_TX_QUEUES) % arch_num_cpus()) < 0) {
+			NET_ERR("Cannot pin TC handler thread %d", i);
+		}
+#endif
+
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "tx_q[%d]", i);
+			if (NET_TC_TX_QUEUES > 1) {
+				snprintk(name, sizeof(name), "tx_q[%d.%d]",
+					 i / NET_TC_TX_QUEUES, i % NET_TC_TX_QUEUES);
+			} else {
+				snprintk(name, sizeof(name), "tx_q[%d]", i);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
@@ -382,9 +618,9 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+	for (i = 0; i < NET_TC_RX_COUNT * NET_TC_RX_QUEUES; i++) {
 		k_tid_t tid;
-		int priority = net_tc_rx_thread_priority(i);
+		int priority = net_tc_rx_thread_priority(i / NET_TC_RX_QUEUES);
 
 
 		NET_DBG("[%d] Starting RX handler %p stack size %zd prio %d", i,
@@ -407,17 +643,34 @@ void net_tc_rx_init(void)
 #else
 				      NULL,
 #endif
+#if defined(CONFIG_NET_TCP_GRO)
+				      &rx_gro[i],
+#else
 				      NULL,
+#endif
 				      priority, 0, K_FOREVER);
 		if (!tid) {
 			NET_ERR("Cannot create TC handler thread %d", i);
 			continue;
 		}
 
+#if defined(CONFIG_SCHED_CPU_MASK) && NET_TC_RX_QUEUES > 1
+		/* Spread the queues of the class over the CPUs */
+		if (k_thread_cpu_pin(tid, (i % NET_TC_RX_QUEUES) % arch_num_cpus()) < 0) {
+			NET_ERR("Cannot pin TC handler thread %d", i);
+		}
+#endif
+
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "rx_q[%d]", i);
+			if (NET_TC_RX_QUEUES > 1) {
+				snprintk(name, sizeof(name), "rx_q[%d.%d]",
+					 i / NET_TC_RX_QUEUES, i % NET_TC_RX_QUEUES);
+			} else {
+				snprintk(name, sizeof(name), "rx_q[%d]", i);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
@@ -25,6 +25,7 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #include "net_stats.h"
 #include "net_private.h"
 #include "tcp_internal.h"
+#include "tcp_ca.h"
 #include "pmtu.h"
 
 #define ACK_TIMEOUT_MS tcp_max_timeout_ms
@@ -65,10 +66,6 @@ static int tcp_tx_window =
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
-/* Define the number of MSS sections the congestion window is initialized at */
-#define TCP_CONGESTION_INITIAL_WIN 1
-#define TCP_CONGESTION_INITIAL_SSTHRESH 3
-
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -82,6 +79,7 @@ static K_KERNEL_STACK_DEFINE(work_q_stack, CONFIG_NET_TCP_WORKQ_STACK_SIZE);
 static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt);
 static bool is_destination_local(struct net_pkt *pkt);
 static void tcp_out(struct tcp *conn, uint8_t flags);
+static int tcp_send_data(struct tcp *conn);
 static const char *tcp_state_to_str(enum tcp_state state, bool prefix);
 
 int (*tcp_send_cb)(struct net_pkt *pkt) = NULL;
@@ -495,112 +493,321 @@ static void tcp_derive_rto(struct tcp *conn)
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-/* Implementation according to RFC6582 */
+static const struct tcp_ca_ops *tcp_ca_default;
 
-static void tcp_new_reno_log(struct tcp *conn, char *step)
+const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len)
 {
-	NET_DBG("[%p] ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
-		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
-		conn->ca.pending_fast_retransmit_bytes);
+	STRUCT_SECTION_FOREACH(tcp_ca_ops, ops) {
+		if (strlen(ops->name) == len && strncmp(ops->name, name, len) == 0) {
+			return ops;
+		}
+	}
+
+	return NULL;
 }
 
-static void tcp_new_reno_init(struct tcp *conn)
+static void tcp_ca_init(struct tcp *conn)
 {
-	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
-	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
-	conn->ca.pending_fast_retransmit_bytes = 0;
-	tcp_new_reno_log(conn, "init");
+	conn->ca.ops->init(conn);
 }
 
-static void tcp_new_reno_fast_retransmit(struct tcp *conn)
+static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	if (conn->ca.pending_fast_retransmit_bytes == 0) {
-		conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
-		/* Account for the lost segments */
-		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
-		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
-		tcp_new_reno_log(conn, "fast_retransmit");
-	}
+	conn->ca.ops->fast_retransmit(conn);
 }
 
-static void tcp_new_reno_timeout(struct tcp *conn)
+static void tcp_ca_timeout(struct tcp *conn)
 {
-	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
-	conn->ca.cwnd = conn_mss(conn);
-	tcp_new_reno_log(conn, "timeout");
+	conn->ca.ops->timeout(conn);
 }
 
-/* For every duplicate ack increment the cwnd by mss */
-static void tcp_new_reno_dup_ack(struct tcp *conn)
+static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	int32_t new_win = conn->ca.cwnd;
+	conn->ca.ops->dup_ack(conn);
+}
 
-	new_win += conn_mss(conn);
-	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
-	tcp_new_reno_log(conn, "dup_ack");
+static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	conn->ca.ops->pkts_acked(conn, acked_len);
 }
 
-static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
+static void tcp_ca_param_copy(struct tcp *to, struct tcp *from)
 {
-	int32_t new_win = conn->ca.cwnd;
-	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+	to->ca.ops = from->ca.ops;
+}
+#else
 
-	if (conn->ca.pending_fast_retransmit_bytes == 0) {
-		if (conn->ca.cwnd < conn->ca.ssthresh) {
-			new_win += win_inc;
-		} else {
-			/* Implement a div_ceil	to avoid rounding to 0 */
-			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
+static void tcp_ca_init(struct tcp *conn) { }
+
+static void tcp_ca_fast_retransmit(struct tcp *conn) { }
+
+static void tcp_ca_timeout(struct tcp *conn) { }
+
+static void tcp_ca_dup_ack(struct tcp *conn) { }
+
+static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
+
+#define tcp_ca_param_copy(...)
+
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+
+/* Implementation according to RFC 2018 and RFC 6675 */
+
+#define TCP_SACK_OPT_HDR_SIZE (NET_TCP_NOP_SIZE * 2 + 2)
+
+static bool tcp_sack_ok(struct tcp *conn)
+{
+	/* SACK permitted is offered in every SYN and answered in every
+	 * SYN-ACK, so getting it from the peer means that both ends agreed.
+	 */
+	return conn->recv_options.sack_perm_found;
+}
+
+static size_t tcp_sack_options_len(struct tcp *conn, uint8_t flags)
+{
+	if (flags & SYN) {
+		if (!(flags & ACK) || tcp_sack_ok(conn)) {
+			return NET_TCP_NOP_SIZE * 2 + NET_TCP_SACK_PERM_SIZE;
 		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+
+		return 0;
+	}
+
+	/* The out-of-order queue has no holes, a single block covers it */
+	if ((flags & ACK) && tcp_sack_ok(conn) && conn->queue_recv_data != NULL) {
+		return TCP_SACK_OPT_HDR_SIZE + NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	return 0;
+}
+
+static int tcp_sack_options_add(struct tcp *conn, struct net_pkt *pkt,
+				uint8_t flags)
+{
+	uint8_t opts[TCP_SACK_OPT_HDR_SIZE + NET_TCP_SACK_BLOCK_SIZE];
+	size_t len = tcp_sack_options_len(conn, flags);
+	uint32_t start;
+	uint32_t end;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	opts[0] = NET_TCP_NOP_OPT;
+	opts[1] = NET_TCP_NOP_OPT;
+
+	if (flags & SYN) {
+		opts[2] = NET_TCP_SACK_PERM_OPT;
+		opts[3] = NET_TCP_SACK_PERM_SIZE;
 	} else {
-		/* Check if it is still in fast recovery mode */
-		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
-			conn->ca.pending_fast_retransmit_bytes = 0;
-			conn->ca.cwnd = conn->ca.ssthresh;
-		} else {
-			conn->ca.pending_fast_retransmit_bytes -= acked_len;
-			conn->ca.cwnd -= acked_len;
+		start = tcp_get_seq(conn->queue_recv_data);
+		end = start + net_buf_frags_len(conn->queue_recv_data);
+
+		opts[2] = NET_TCP_SACK_OPT;
+		opts[3] = 2 + NET_TCP_SACK_BLOCK_SIZE;
+		UNALIGNED_PUT(net_htonl(start), (uint32_t *)&opts[4]);
+		UNALIGNED_PUT(net_htonl(end), (uint32_t *)&opts[8]);
+	}
+
+	return net_pkt_write(pkt, opts, len);
+}
+
+static void tcp_sack_insert(struct tcp_sack_scoreboard *sb, uint32_t start,
+			    uint32_t end)
+{
+	int i = 0;
+	int j;
+
+	/* Skip the blocks entirely below the new one */
+	while (i < sb->count && net_tcp_seq_cmp(sb->blocks[i].end, start) < 0) {
+		i++;
+	}
+
+	/* Absorb the blocks overlapping or adjacent to the new one */
+	for (j = i; j < sb->count && net_tcp_seq_cmp(sb->blocks[j].start, end) <= 0; j++) {
+		if (net_tcp_seq_cmp(sb->blocks[j].start, start) < 0) {
+			start = sb->blocks[j].start;
 		}
+
+		if (net_tcp_seq_cmp(sb->blocks[j].end, end) > 0) {
+			end = sb->blocks[j].end;
+		}
+	}
+
+	if (j == i) {
+		if (sb->count == ARRAY_SIZE(sb->blocks)) {
+			/* Keep the lowest blocks, they tell which data to
+			 * retransmit next.
+			 */
+			if (i == sb->count) {
+				return;
+			}
+
+			sb->count--;
+		}
+
+		memmove(&sb->blocks[i + 1], &sb->blocks[i],
+			(sb->count - i) * sizeof(sb->blocks[0]));
+		sb->count++;
+	} else if (j > i + 1) {
+		memmove(&sb->blocks[i + 1], &sb->blocks[j],
+			(sb->count - j) * sizeof(sb->blocks[0]));
+		sb->count -= j - i - 1;
 	}
-	tcp_new_reno_log(conn, "pkts_acked");
+
+	sb->blocks[i].start = start;
+	sb->blocks[i].end = end;
 }
 
-static void tcp_ca_init(struct tcp *conn)
+static void tcp_sack_update(struct tcp *conn, uint32_t ack,
+			    const struct tcp_sack_option *sack)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t snd_nxt = conn->seq + conn->unacked_len;
+	uint8_t count = 0;
+
+	if (!tcp_sack_ok(conn)) {
+		return;
+	}
+
+	/* Forget the blocks covered by the cumulative acknowledgment. A block
+	 * starting right at it means that the peer discarded the data before,
+	 * forget it too.
+	 */
+	for (int i = 0; i < sb->count; i++) {
+		if (net_tcp_seq_greater(sb->blocks[i].start, ack)) {
+			sb->blocks[count++] = sb->blocks[i];
+		}
+	}
+
+	sb->count = count;
+
+	for (int i = 0; i < sack->count; i++) {
+		const struct tcp_sack_block *blk = &sack->blocks[i];
+
+		/* Ignore duplicate SACK (RFC 2883) and bogus blocks. Data beyond
+		 * SND.NXT was not sent, or not sent again since a timeout, so
+		 * the peer cannot hold it.
+		 */
+		if (!net_tcp_seq_greater(blk->start, ack) ||
+		    !net_tcp_seq_greater(blk->end, blk->start) ||
+		    net_tcp_seq_greater(blk->end, snd_nxt)) {
+			continue;
+		}
+
+		tcp_sack_insert(sb, blk->start, blk->end);
+	}
+
+	if (sb->in_recovery && !net_tcp_seq_greater(sb->recovery_point, ack)) {
+		sb->in_recovery = false;
+	}
+}
+
+/* Move the next transmission past the data already held by the peer */
+static void tcp_sack_skip(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t next = conn->seq + conn->unacked_len;
+
+	for (int i = 0; i < sb->count; i++) {
+		if (net_tcp_seq_cmp(sb->blocks[i].start, next) <= 0 &&
+		    net_tcp_seq_greater(sb->blocks[i].end, next)) {
+			conn->unacked_len += sb->blocks[i].end - next;
+			break;
+		}
+	}
 }
 
-static void tcp_ca_fast_retransmit(struct tcp *conn)
+/* Stop the next transmission where the data held by the peer starts */
+static int tcp_sack_clamp(struct tcp *conn, int len)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t next = conn->seq + conn->unacked_len;
+
+	for (int i = 0; i < sb->count; i++) {
+		if (net_tcp_seq_greater(sb->blocks[i].start, next)) {
+			return MIN(len, (int)(sb->blocks[i].start - next));
+		}
+	}
+
+	return len;
 }
 
-static void tcp_ca_timeout(struct tcp *conn)
+static void tcp_sack_recovery_start(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->sack.in_recovery = true;
+	conn->sack.high_rxt = conn->seq;
+	conn->sack.recovery_point = conn->seq + conn->unacked_len;
 }
 
-static void tcp_ca_dup_ack(struct tcp *conn)
+/* While in loss recovery, retransmit the first hole below the highest
+ * SACKed block that was not retransmitted yet.
+ */
+static bool tcp_sack_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	int temp_unacked_len;
+	uint32_t next;
+	int ret;
+
+	if (!sb->in_recovery || sb->count == 0) {
+		return false;
+	}
+
+	next = net_tcp_seq_greater(sb->high_rxt, conn->seq) ? sb->high_rxt : conn->seq;
+
+	/* The data above the highest SACKed block is not deemed lost */
+	if (net_tcp_seq_cmp(next, sb->blocks[sb->count - 1].start) >= 0) {
+		return false;
+	}
+
+	temp_unacked_len = conn->unacked_len;
+	conn->unacked_len = next - conn->seq;
+
+	ret = tcp_send_data(conn);
+	if (ret == 0) {
+		sb->high_rxt = conn->seq + conn->unacked_len;
+	}
+
+	/* Restore the current transmission */
+	conn->unacked_len = temp_unacked_len;
+
+	return ret == 0;
 }
 
-static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
+static void tcp_sack_timeout(struct tcp *conn)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	conn->sack.in_recovery = false;
+
+	/* The peer is allowed to discard the data it reported (RFC 2018,
+	 * section 8). Keep the scoreboard on the first timeout only, which
+	 * is where it saves most of the retransmissions.
+	 */
+	if (conn->send_data_retries > 0) {
+		conn->sack.count = 0;
+	}
 }
 #else
 
-static void tcp_ca_init(struct tcp *conn) { }
+static size_t tcp_sack_options_len(struct tcp *conn, uint8_t flags) { return 0; }
 
-static void tcp_ca_fast_retransmit(struct tcp *conn) { }
+static int tcp_sack_options_add(struct tcp *conn, struct net_pkt *pkt,
+				uint8_t flags) { return 0; }
 
-static void tcp_ca_timeout(struct tcp *conn) { }
+static void tcp_sack_update(struct tcp *conn, uint32_t ack,
+			    const struct tcp_sack_option *sack) { }
 
-static void tcp_ca_dup_ack(struct tcp *conn) { }
+static void tcp_sack_skip(struct tcp *conn) { }
 
-static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
+static int tcp_sack_clamp(struct tcp *conn, int len) { return len; }
+
+static void tcp_sack_recovery_start(struct tcp *conn) { }
+
+static bool tcp_sack_retransmit(struct tcp *conn) { return false; }
+
+static void tcp_sack_timeout(struct tcp *conn) { }
 
 #endif
 
@@ -1097,6 +1304,7 @@ static uint8_t *tcp_options_get(struct net_pkt *pkt, int tcp_options_len,
 }
 
 static bool tcp_options_check(struct tcp_options *recv_options,
+			      struct tcp_sack_option *sack,
 			      struct net_pkt *pkt, ssize_t len)
 {
 	uint8_t options_buf[40]; /* TCP header max options size is 40 */
@@ -1107,8 +1315,7 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	sack->count = 0;
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1157,6 +1364,25 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			/* SACK is only an optimization, ignore it if malformed */
+			if (opt_len == NET_TCP_SACK_PERM_SIZE) {
+				recv_options->sack_perm_found = IS_ENABLED(CONFIG_NET_TCP_SACK);
+			}
+			break;
+		case NET_TCP_SACK_OPT:
+			if ((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE != 0) {
+				break;
+			}
+
+			for (int i = 2; i < opt_len && sack->count < NET_TCP_SACK_MAX_BLOCKS;
+			     i += NET_TCP_SACK_BLOCK_SIZE) {
+				struct tcp_sack_block *blk = &sack->blocks[sack->count++];
+
+				blk->start = net_ntohl(UNALIGNED_GET((uint32_t *)(options + i)));
+				blk->end = net_ntohl(UNALIGNED_GET((uint32_t *)(options + i + 4)));
+			}
+			break;
 		default:
 			continue;
 		}
@@ -1347,7 +1573,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1361,11 +1587,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_sport));
 	UNALIGNED_PUT(conn->dst.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_dport));
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(net_htons(conn->recv_win), UNALIGNED_MEMBER_ADDR(th, th_win));
@@ -1557,33 +1779,41 @@ err:
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	size_t opts_len = tcp_sack_options_len(conn, flags);
+	size_t data_len = 0;
 	struct net_pkt *pkt;
 	int ret = 0;
 
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		opts_len += NET_TCP_MSS_SIZE;
 	}
 
-	pkt = tcp_pkt_alloc(conn, alloc_len);
+	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr) + opts_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
 		goto out;
 	}
 
 	if (data) {
+		data_len = net_pkt_get_len(data);
+
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
 	}
 
+	if (data_len > conn_mss(conn)) {
+		/* Let the interface or the device cut it into segments */
+		net_pkt_set_gso_size(pkt, conn_mss(conn));
+	}
+
 	ret = ip_header_add(conn, pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1597,6 +1827,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	ret = tcp_sack_options_add(conn, pkt, flags);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1814,17 +2050,41 @@ static void tcp_setup_retransmission(struct tcp *conn)
 	k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer, K_MSEC(TCP_RTO_MS));
 }
 
-static int tcp_send_data(struct tcp *conn)
+#if defined(CONFIG_NET_TCP_GSO)
+/* Keep the IP total length of the GSO packets in 16 bits */
+#define TCP_GSO_MAX_LEN (UINT16_MAX - NET_IPV6H_LEN - 60)
+
+static int tcp_gso_max_len(struct tcp *conn)
+{
+	return MIN(conn_mss(conn) * CONFIG_NET_TCP_GSO_MAX_SEGS, TCP_GSO_MAX_LEN);
+}
+#else
+#define tcp_gso_max_len(conn) conn_mss(conn)
+#endif
+
+/* Send up to max_len bytes of the unsent data, in a single packet which is
+ * cut into segments later on if it is larger than the MSS.
+ */
+static int tcp_send_data_len(struct tcp *conn, int max_len)
 {
 	int ret = 0;
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	tcp_sack_skip(conn);
+
+	len = MIN(tcp_unsent_len(conn), max_len);
 	if (len < 0) {
 		ret = len;
 		goto out;
 	}
+
+	len = tcp_sack_clamp(conn, len);
+	if (len > conn_mss(conn)) {
+		/* Do not leave a small segment in the middle of the stream */
+		len -= len % conn_mss(conn);
+	}
+
 	if (len == 0) {
 		NET_DBG("[%p] no data to send", conn);
 		ret = -ENODATA;
@@ -1870,6 +2130,11 @@ static int tcp_send_data(struct tcp *conn)
 	return ret;
 }
 
+static int tcp_send_data(struct tcp *conn)
+{
+	return tcp_send_data_len(conn, conn_mss(conn));
+}
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1895,7 +2160,7 @@ static int tcp_send_queued_data(struct tcp *conn)
 			}
 		}
 
-		ret = tcp_send_data(conn);
+		ret = tcp_send_data_len(conn, tcp_gso_max_len(conn));
 		if (ret < 0) {
 			break;
 		}
@@ -1969,6 +2234,8 @@ static void tcp_resend_data(struct k_work *work)
 			}
 		}
 
+		tcp_sack_timeout(conn);
+
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
 
@@ -2204,6 +2471,7 @@ static struct tcp *tcp_conn_alloc(void)
 	 * is available as soon as the connection is established
 	 */
 	conn->ca.cwnd = UINT16_MAX;
+	conn->ca.ops = tcp_ca_default;
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -2290,8 +2558,198 @@ static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 	return found ? conn : NULL;
 }
 
+/* A connection registers its own handler once its endpoints are known, so
+ * check the connection of the context the packet was delivered to before
+ * searching through all of them.
+ */
+static struct tcp *tcp_conn_search_context(struct net_context *context,
+					   struct net_pkt *pkt)
+{
+	struct tcp *conn = NULL;
+
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+
+	if (context != NULL && context->tcp != NULL &&
+	    net_context_get_state(context) != NET_CONTEXT_LISTENING &&
+	    tcp_conn_cmp(context->tcp, pkt)) {
+		conn = context->tcp;
+	}
+
+	k_mutex_unlock(&tcp_lock);
+
+	return (conn != NULL) ? conn : tcp_conn_search(pkt);
+}
+
 static struct tcp *tcp_conn_new(struct net_pkt *pkt);
 
+#if defined(CONFIG_NET_TCP_GRO)
+/* Data segments are held back while the next ones of the same connection are
+ * received, and appended to them. Each RX queue holds a single flow at a
+ * time, the segments of another connection flush it. The GRO state is only
+ * used by the thread of its RX queue, so it needs no locking.
+ */
+static void tcp_gro_complete(struct tcp *conn, struct net_pkt *pkt)
+{
+	if (tcp_in(conn, pkt) == NET_DROP) {
+		tcp_pkt_unref(pkt);
+	}
+
+	tcp_conn_unref(conn);
+}
+
+static struct net_pkt *tcp_gro_detach(struct net_tcp_gro *gro, struct tcp **conn)
+{
+	struct net_pkt *pkt = gro->pkt;
+
+	*conn = gro->conn;
+	gro->pkt = NULL;
+	gro->conn = NULL;
+
+	return pkt;
+}
+
+/* Append the payload of a segment to the held one */
+static int tcp_gro_merge(struct net_tcp_gro *gro, struct net_pkt *pkt,
+			 struct tcphdr *th, size_t len)
+{
+	struct tcphdr *held_th;
+	size_t total;
+
+	held_th = th_get(gro->pkt);
+	if (held_th == NULL) {
+		return -EINVAL;
+	}
+
+	/* The coalesced segment acknowledges and advertises what the last
+	 * one did.
+	 */
+	UNALIGNED_PUT(UNALIGNED_GET(UNALIGNED_MEMBER_ADDR(th, th_ack)),
+		      UNALIGNED_MEMBER_ADDR(held_th, th_ack));
+	UNALIGNED_PUT(th_win(th), UNALIGNED_MEMBER_ADDR(held_th, th_win));
+	UNALIGNED_PUT(th_flags(held_th) | (th_flags(th) & PSH),
+		      UNALIGNED_MEMBER_ADDR(held_th, th_flags));
+
+	if (tcp_pkt_pull(pkt, net_pkt_get_len(pkt) - len) < 0) {
+		return -EINVAL;
+	}
+
+	net_pkt_append_buffer(gro->pkt, pkt->buffer);
+	pkt->buffer = NULL;
+	tcp_pkt_unref(pkt);
+
+	/* The checksums were verified already, only keep the length right */
+	total = net_pkt_get_len(gro->pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(gro->pkt) == NET_AF_INET) {
+		NET_IPV4_HDR(gro->pkt)->len = net_htons(total);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   net_pkt_family(gro->pkt) == NET_AF_INET6) {
+		NET_IPV6_HDR(gro->pkt)->len = net_htons(total - NET_IPV6H_LEN);
+	}
+
+	net_pkt_cursor_init(gro->pkt);
+
+	gro->next_seq += len;
+	gro->segs++;
+
+	return 0;
+}
+
+static bool tcp_gro_can_hold(struct tcp *conn, struct net_pkt *pkt,
+			     struct tcphdr *th, size_t len)
+{
+	return conn->state == TCP_ESTABLISHED && len > 0 &&
+		th_off(th) == 5 && (th_flags(th) & ~PSH) == ACK &&
+		net_pkt_ip_opts_len(pkt) == 0 && !net_pkt_is_ip_reassembled(pkt);
+}
+
+/* Hold or coalesce an incoming segment. Returns NET_OK if the segment was
+ * consumed, NET_CONTINUE if it must be processed right away.
+ */
+static enum net_verdict tcp_gro_receive(struct tcp *conn, struct net_pkt *pkt)
+{
+	enum net_verdict verdict = NET_CONTINUE;
+	struct net_pkt *flush_pkt = NULL;
+	struct tcp *flush_conn = NULL;
+	struct net_tcp_gro *gro;
+	struct tcphdr *th;
+	bool can_hold;
+	size_t len;
+
+	/* Packets looped back by the sending thread are processed right away,
+	 * nothing would flush them otherwise.
+	 */
+	if (net_pkt_is_loopback(pkt)) {
+		return NET_CONTINUE;
+	}
+
+	gro = net_tc_rx_gro_get();
+	if (gro == NULL) {
+		return NET_CONTINUE;
+	}
+
+	th = th_get(pkt);
+	if (th == NULL) {
+		return NET_CONTINUE;
+	}
+
+	len = tcp_data_len(pkt);
+	can_hold = tcp_gro_can_hold(conn, pkt, th, len);
+
+	if (gro->pkt != NULL) {
+		if (can_hold && gro->conn == conn && th_seq(th) == gro->next_seq &&
+		    net_pkt_get_len(gro->pkt) + len <= UINT16_MAX &&
+		    tcp_gro_merge(gro, pkt, th, len) == 0) {
+			if ((th_flags(th) & PSH) ||
+			    gro->segs >= CONFIG_NET_TCP_GRO_MAX_SEGS) {
+				flush_pkt = tcp_gro_detach(gro, &flush_conn);
+			}
+
+			verdict = NET_OK;
+			goto out;
+		}
+
+		/* Process the held data before anything else */
+		flush_pkt = tcp_gro_detach(gro, &flush_conn);
+	}
+
+	/* Only start from the next expected segment, the others are handled
+	 * by the usual out of order processing.
+	 */
+	if (can_hold && !(th_flags(th) & PSH) && th_seq(th) == conn->ack) {
+		tcp_conn_ref(conn);
+		gro->conn = conn;
+		gro->pkt = pkt;
+		gro->next_seq = th_seq(th) + len;
+		gro->segs = 1;
+		verdict = NET_OK;
+	}
+
+out:
+	if (flush_pkt != NULL) {
+		tcp_gro_complete(flush_conn, flush_pkt);
+	}
+
+	return verdict;
+}
+
+void net_tcp_gro_flush(struct net_tcp_gro *gro)
+{
+	struct net_pkt *pkt;
+	struct tcp *conn;
+
+	pkt = tcp_gro_detach(gro, &conn);
+	if (pkt != NULL) {
+		tcp_gro_complete(conn, pkt);
+	}
+}
+#else
+static enum net_verdict tcp_gro_receive(struct tcp *conn, struct net_pkt *pkt)
+{
+	return NET_CONTINUE;
+}
+#endif /* CONFIG_NET_TCP_GRO */
+
 static enum net_verdict tcp_recv(struct net_conn *net_conn,
 				 struct net_pkt *pkt,
 				 union net_ip_header *ip,
@@ -2305,7 +2763,7 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 	ARG_UNUSED(net_conn);
 	ARG_UNUSED(proto);
 
-	conn = tcp_conn_search(pkt);
+	conn = tcp_conn_search_context(user_data, pkt);
 	if (conn) {
 		goto in;
 	}
@@ -2333,7 +2791,10 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 	}
 in:
 	if (conn) {
-		verdict = tcp_in(conn, pkt);
+		verdict = tcp_gro_receive(conn, pkt);
+		if (verdict == NET_CONTINUE) {
+			verdict = tcp_in(conn, pkt);
+		}
 	} else {
 		net_tcp_reply_rst(pkt);
 	}
@@ -2908,6 +3369,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	bool do_close = false;
 	bool connection_ok = false;
 	size_t tcp_options_len;
+	struct tcp_sack_option sack = { .count = 0 };
 	struct net_conn *conn_handler = NULL;
 	struct net_pkt *recv_pkt;
 	void *recv_user_data;
@@ -2999,7 +3461,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
-	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
+	if (tcp_options_len && !tcp_options_check(&conn->recv_options, &sack, pkt,
 						  tcp_options_len)) {
 		NET_DBG("[%p] DROP: Invalid TCP option list", conn);
 		net_tcp_reply_rst(pkt);
@@ -3123,6 +3585,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+				tcp_ca_param_copy(conn, conn->accepted_conn);
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
@@ -3252,6 +3715,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		keep_alive_timer_restart(conn);
 
+		tcp_sack_update(conn, th_ack(th), &sack);
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3273,19 +3738,27 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
 			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
 				/* Apply a fast retransmit */
-				int temp_unacked_len = conn->unacked_len;
+				tcp_sack_recovery_start(conn);
 
-				conn->unacked_len = 0;
+				if (!tcp_sack_retransmit(conn)) {
+					int temp_unacked_len = conn->unacked_len;
 
-				(void)tcp_send_data(conn);
+					conn->unacked_len = 0;
 
-				/* Restore the current transmission */
-				conn->unacked_len = temp_unacked_len;
+					(void)tcp_send_data(conn);
+
+					/* Restore the current transmission */
+					conn->unacked_len = temp_unacked_len;
+				}
 
 				tcp_ca_fast_retransmit(conn);
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+			} else if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+				   (conn->dup_ack_cnt > DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
+				/* Further duplicate ACKs may report more holes */
+				(void)tcp_sack_retransmit(conn);
 			}
 		}
 #endif
@@ -3375,6 +3848,11 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				break;
 			}
 
+			/* A partial acknowledgment during loss recovery
+			 * uncovers the next hole.
+			 */
+			(void)tcp_sack_retransmit(conn);
+
 			ret = tcp_send_queued_data(conn);
 			if (ret < 0 && ret != -ENOBUFS) {
 				net_tcp_reply_rst(pkt);
@@ -3894,6 +4372,51 @@ out:
 	return ret;
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+int net_tcp_queue_buf(struct net_context *context, struct net_buf *buf)
+{
+	struct tcp *conn = context->tcp;
+	size_t len = net_buf_frags_len(buf);
+	int ret;
+
+	if (!conn || conn->state != TCP_ESTABLISHED) {
+		return -ENOTCONN;
+	}
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	/* The fragments are adopted as a whole, so wait until the window
+	 * has room for all of them. If nothing is queued they are taken
+	 * anyway, the window then only limits how much of them is sent.
+	 */
+	if (tcp_window_full(conn) ||
+	    (conn->send_data_total > 0 && len > conn->send_win - conn->send_data_total)) {
+		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+		ret = -EAGAIN;
+		goto out;
+	}
+
+	net_pkt_append_buffer(conn->send_data, buf);
+	conn->send_data_total += len;
+
+	/* The data is now owned by the connection, any transmit error is
+	 * handled like in net_tcp_queue() and reported by the next calls.
+	 */
+	ret = tcp_send_queued_data(conn);
+	if (ret < 0 && ret != -ENOBUFS) {
+		tcp_conn_close(conn, ret);
+	} else if (tcp_window_full(conn)) {
+		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+	}
+
+	ret = len;
+out:
+	k_mutex_unlock(&conn->lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 /* net context is about to send out queued data - inform caller only */
 int net_tcp_send_data(struct net_context *context, net_context_send_cb_t cb,
 		      void *user_data)
@@ -4653,6 +5176,49 @@ uint16_t net_tcp_get_mtu(struct net_sockaddr *dst)
 }
 #endif /* CONFIG_NET_TEST */
 
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+static int set_tcp_congestion(struct tcp *conn, const void *value, uint32_t len)
+{
+	const struct tcp_ca_ops *ops;
+
+	ops = tcp_ca_find(value, strnlen(value, len));
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	if (ops == conn->ca.ops) {
+		return 0;
+	}
+
+	conn->ca.ops = ops;
+
+	/* Start over from the initial window of the new algorithm */
+	if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+		tcp_ca_init(conn);
+		if (tcp_window_full(conn)) {
+			(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+		}
+	}
+
+	return 0;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, uint32_t *len)
+{
+	if (len == NULL) {
+		return -EINVAL;
+	}
+
+	*len = MIN(*len, strlen(conn->ca.ops->name) + 1);
+	memcpy(value, conn->ca.ops->name, *len);
+
+	return 0;
+}
+#else
+#define set_tcp_congestion(...) (-ENOPROTOOPT)
+#define get_tcp_congestion(...) (-ENOPROTOOPT)
+#endif /* CONFIG_NET_TCP_CONGESTION_AVOIDANCE */
+
 int net_tcp_set_option(struct net_context *context,
 		       enum tcp_conn_option option,
 		       const void *value, uint32_t len)
@@ -4683,6 +5249,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4720,6 +5289,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4824,6 +5396,13 @@ void net_tcp_init(void)
 		tcp_max_timeout_ms += tcp_max_timeout_ms >> 1;
 	}
 
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+	tcp_ca_default = tcp_ca_find(CONFIG_NET_TCP_CONGESTION_DEFAULT,
+				     strlen(CONFIG_NET_TCP_CONGESTION_DEFAULT));
+	NET_ASSERT(tcp_ca_default != NULL, "Unknown congestion avoidance algorithm %s",
+		   CONFIG_NET_TCP_CONGESTION_DEFAULT);
+#endif
+
 	k_thread_name_set(&tcp_work_q.thread, "tcp_work");
 	NET_DBG("Workq started. Thread ID: %p", &tcp_work_q.thread);
 }
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ * @brief TCP congestion avoidance algorithms
+ *
+ * Internal API between the TCP stack and the congestion avoidance algorithms
+ * it can use. Every algorithm registers a set of operations, and each
+ * connection can select the one it uses with the TCP_CONGESTION socket option.
+ */
+
+#ifndef __TCP_CA_H
+#define __TCP_CA_H
+
+#include <zephyr/sys/iterable_sections.h>
+
+#include "tcp_internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Maximum length of an algorithm name, including the terminating NUL */
+#define TCP_CA_NAME_MAX 16
+
+/**
+ * @brief Congestion avoidance algorithm operations
+ *
+ * All the operations are called with the connection lock held. They maintain
+ * conn->ca.cwnd and conn->ca.ssthresh, and can keep their own state in
+ * conn->ca.priv, see TCP_CA_PRIV().
+ */
+struct tcp_ca_ops {
+	/** Name of the algorithm, as given to the TCP_CONGESTION socket option */
+	const char *name;
+
+	/** Connection established, set the initial window */
+	void (*init)(struct tcp *conn);
+
+	/** Third duplicate ACK received, entering fast recovery */
+	void (*fast_retransmit)(struct tcp *conn);
+
+	/** Retransmission timer expired */
+	void (*timeout)(struct tcp *conn);
+
+	/** Duplicate ACK received, after the fast retransmit */
+	void (*dup_ack)(struct tcp *conn);
+
+	/** New data acknowledged */
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
+};
+
+/**
+ * @brief Register a congestion avoidance algorithm
+ *
+ * @param _id Unique identifier of the algorithm
+ */
+#define TCP_CA_DEFINE(_id) \
+	static const STRUCT_SECTION_ITERABLE(tcp_ca_ops, _id)
+
+/**
+ * @brief Get the private state of the algorithm used by a connection
+ *
+ * @param _conn TCP connection
+ * @param _type Type of the state, must fit in TCP_CA_PRIV_SIZE words
+ */
+#define TCP_CA_PRIV(_conn, _type) ((_type *)(_conn)->ca.priv)
+
+/**
+ * @brief Find a congestion avoidance algorithm by name
+ *
+ * @param name Name of the algorithm, does not need to be NUL terminated
+ * @param len Length of the name
+ *
+ * @return Algorithm operations, NULL if not found
+ */
+const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TCP_CA_H */
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Implementation according to RFC9438 */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+
+#include "tcp_ca.h"
+
+/* Multiplicative decrease factor, beta_cubic = 0.7 */
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+
+/* Aggressiveness of the cubic function, C = 0.4 segments per s^3 */
+#define CUBIC_C_NUM 4
+#define CUBIC_C_DEN 10
+
+/* Additive increase of the Reno-friendly estimate,
+ * alpha_cubic = 3 * (1 - beta_cubic) / (1 + beta_cubic) = 9 / 17
+ */
+#define CUBIC_ALPHA_NUM 9
+#define CUBIC_ALPHA_DEN 17
+
+/* Bound the time elapsed in an epoch, so that the cube fits in 64 bits */
+#define CUBIC_MAX_TIME_MS 100000U
+
+#define MSEC_PER_SEC_CUBED (1000ULL * 1000ULL * 1000ULL)
+
+struct tcp_cubic {
+	/* Start of the congestion avoidance epoch (ms) */
+	uint32_t epoch_start;
+	/* Time the window takes to get back to the origin point (ms) */
+	uint32_t k;
+	/* Window size just before the last reduction */
+	uint32_t w_max;
+	/* Plateau of the cubic function in the current epoch */
+	uint32_t origin;
+	/* Window of a Reno flow on the same path, 0 outside of an epoch */
+	uint32_t w_est;
+};
+
+BUILD_ASSERT(sizeof(struct tcp_cubic) <= sizeof(uint32_t) * TCP_CA_PRIV_SIZE);
+
+static void tcp_cubic_log(struct tcp *conn, char *step)
+{
+	struct tcp_cubic *cubic = TCP_CA_PRIV(conn, struct tcp_cubic);
+
+	NET_DBG("[%p] ca %s, cwnd=%d, ssthres=%d, fast_pend=%i, w_max=%u, k=%u",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+		conn->ca.pending_fast_retransmit_bytes, cubic->w_max, cubic->k);
+}
+
+/* Integer cube root, rounded down */
+static uint32_t tcp_cubic_cbrt(uint64_t x)
+{
+	uint64_t y = 0;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		uint64_t b;
+
+		y <<= 1;
+		b = 3 * y * (y + 1) + 1;
+		if ((x >> s) >= b) {
+			x -= b << s;
+			y++;
+		}
+	}
+
+	return (uint32_t)y;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	struct tcp_cubic *cubic = TCP_CA_PRIV(conn, struct tcp_cubic);
+	uint16_t mss = conn_mss(conn);
+
+	*cubic = (struct tcp_cubic){ 0 };
+
+	/* Initial window from RFC5681, and slow start until the first loss */
+	conn->ca.cwnd = MIN(mss * 4, MAX(mss * 2, 4380));
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_cubic_log(conn, "init");
+}
+
+/* Multiplicative decrease, at the detection of a loss */
+static void tcp_cubic_reduce(struct tcp *conn)
+{
+	struct tcp_cubic *cubic = TCP_CA_PRIV(conn, struct tcp_cubic);
+	uint32_t cwnd = conn->ca.cwnd;
+
+	/* Fast convergence: release bandwidth for the newer flows when the
+	 * window keeps shrinking.
+	 */
+	if (cwnd < cubic->w_max) {
+		cubic->w_max = cwnd * (CUBIC_BETA_DEN + CUBIC_BETA_NUM) /
+			       (2 * CUBIC_BETA_DEN);
+	} else {
+		cubic->w_max = cwnd;
+	}
+
+	cubic->w_est = 0;
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2,
+				cwnd * CUBIC_BETA_NUM / CUBIC_BETA_DEN);
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_reduce(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = MIN(conn_mss(conn) * 3 + conn->ca.ssthresh,
+				    UINT16_MAX);
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_cubic_log(conn, "timeout");
+}
+
+static void tcp_cubic_dup_ack(struct tcp *conn)
+{
+	int32_t new_win = conn->ca.cwnd;
+
+	new_win += conn_mss(conn);
+	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	tcp_cubic_log(conn, "dup_ack");
+}
+
+/* Window increase in congestion avoidance, returns the number of bytes to add
+ * to the congestion window.
+ */
+static uint32_t tcp_cubic_increase(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_cubic *cubic = TCP_CA_PRIV(conn, struct tcp_cubic);
+	uint32_t now = k_uptime_get_32();
+	uint32_t cwnd = conn->ca.cwnd;
+	uint16_t mss = conn_mss(conn);
+	uint64_t offs;
+	uint64_t delta;
+	uint32_t target;
+	uint32_t alpha_num;
+	uint32_t alpha_den;
+	uint32_t t;
+
+	if (cubic->w_est == 0) {
+		cubic->epoch_start = now;
+		cubic->w_est = cwnd;
+
+		if (cwnd < cubic->w_max) {
+			/* K = cbrt((W_max - cwnd) / C), in ms */
+			cubic->k = tcp_cubic_cbrt((uint64_t)(cubic->w_max - cwnd) *
+						  CUBIC_C_DEN * MSEC_PER_SEC_CUBED /
+						  (CUBIC_C_NUM * mss));
+			cubic->origin = cubic->w_max;
+		} else {
+			cubic->k = 0;
+			cubic->origin = cwnd;
+		}
+	}
+
+	/* W_cubic(t) = C * (t - K)^3 + W_max */
+	t = MIN(now - cubic->epoch_start, CUBIC_MAX_TIME_MS);
+	offs = (t > cubic->k) ? (t - cubic->k) : (cubic->k - t);
+	delta = (offs * offs * offs / 1000U) * CUBIC_C_NUM * mss /
+		(CUBIC_C_DEN * MSEC_PER_SEC_CUBED / 1000U);
+
+	if (t < cubic->k) {
+		target = (delta < cubic->origin) ? cubic->origin - (uint32_t)delta : 0;
+	} else {
+		target = cubic->origin + (uint32_t)MIN(delta, UINT16_MAX);
+	}
+
+	/* Do not grow slower than Reno would */
+	if (cubic->w_est < cubic->w_max) {
+		alpha_num = CUBIC_ALPHA_NUM;
+		alpha_den = CUBIC_ALPHA_DEN;
+	} else {
+		alpha_num = 1;
+		alpha_den = 1;
+	}
+
+	cubic->w_est += DIV_ROUND_UP((uint64_t)alpha_num * mss * acked_len,
+				     (uint64_t)alpha_den * cwnd);
+	cubic->w_est = MIN(cubic->w_est, UINT16_MAX);
+
+	target = MAX(target, cubic->w_est);
+	target = MIN(target, cwnd + cwnd / 2);
+
+	if (target <= cwnd) {
+		return 0;
+	}
+
+	return DIV_ROUND_UP((uint64_t)(target - cwnd) * acked_len, cwnd);
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	int32_t new_win = conn->ca.cwnd;
+
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		if (conn->ca.cwnd < conn->ca.ssthresh) {
+			new_win += MIN(acked_len, conn_mss(conn));
+		} else {
+			new_win += tcp_cubic_increase(conn, acked_len);
+		}
+	} else {
+		/* Check if it is still in fast recovery mode */
+		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+			conn->ca.pending_fast_retransmit_bytes = 0;
+			new_win = conn->ca.ssthresh;
+		} else {
+			conn->ca.pending_fast_retransmit_bytes -= acked_len;
+			new_win = MAX(new_win - (int32_t)acked_len, conn_mss(conn));
+		}
+	}
+
+	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	tcp_cubic_log(conn, "pkts_acked");
+}
+
+TCP_CA_DEFINE(tcp_ca_cubic) = {
+	.name = "cubic",
+	.init = tcp_cubic_init,
+	.fast_retransmit = tcp_cubic_fast_retransmit,
+	.timeout = tcp_cubic_timeout,
+	.dup_ack = tcp_cubic_dup_ack,
+	.pkts_acked = tcp_cubic_pkts_acked,
+};
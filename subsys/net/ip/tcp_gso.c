@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Software fallback of the TCP segmentation offload */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "ipv6.h"
+#include "tcp_internal.h"
+
+/* Timeout for the allocation of the segments */
+#define NET_BUF_TIMEOUT K_MSEC(100)
+
+static void copy_ip_attributes(struct net_pkt *pkt, struct net_pkt *seg)
+{
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+	net_pkt_set_ll_proto_type(seg, net_pkt_ll_proto_type(pkt));
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+	net_pkt_set_ip_dscp(seg, net_pkt_ip_dscp(pkt));
+	net_pkt_set_ip_ecn(seg, net_pkt_ip_ecn(pkt));
+	net_pkt_set_vlan_tci(seg, net_pkt_vlan_tci(pkt));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == NET_AF_INET) {
+		net_pkt_set_ipv4_ttl(seg, net_pkt_ipv4_ttl(pkt));
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == NET_AF_INET6) {
+		net_pkt_set_ipv6_hop_limit(seg, net_pkt_ipv6_hop_limit(pkt));
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+		net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+		net_pkt_set_ipv6_hdr_prev(seg, net_pkt_ipv6_hdr_prev(pkt));
+	}
+}
+
+static int send_tcp_segment(struct net_pkt *pkt, size_t hdr_len, size_t offset,
+			    size_t len, bool final)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	struct tcphdr *th;
+	struct net_pkt_cursor cur_pkt;
+	struct net_pkt *seg;
+	int ret = -ENOBUFS;
+
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), hdr_len + len,
+					net_pkt_family(pkt), 0, NET_BUF_TIMEOUT);
+	if (!seg) {
+		return -ENOMEM;
+	}
+
+	net_pkt_cursor_backup(pkt, &cur_pkt);
+	net_pkt_cursor_init(pkt);
+
+	/* Copy the IP and TCP headers, then the payload of this segment */
+	if (net_pkt_copy(seg, pkt, hdr_len) ||
+	    net_pkt_skip(pkt, offset) ||
+	    net_pkt_copy(seg, pkt, len)) {
+		net_pkt_cursor_restore(pkt, &cur_pkt);
+		goto fail;
+	}
+
+	net_pkt_cursor_restore(pkt, &cur_pkt);
+
+	copy_ip_attributes(pkt, seg);
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (net_pkt_skip(seg, ip_len)) {
+		goto fail;
+	}
+
+	th = (struct tcphdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!th) {
+		goto fail;
+	}
+
+	UNALIGNED_PUT(net_htonl(th_seq(th) + offset), UNALIGNED_MEMBER_ADDR(th, th_seq));
+
+	/* Only the last segment ends the data pushed by the application */
+	if (!final) {
+		UNALIGNED_PUT(th_flags(th) & ~(PSH | FIN), UNALIGNED_MEMBER_ADDR(th, th_flags));
+	}
+
+	net_pkt_set_data(seg, &tcp_access);
+
+	/* Update the lengths and the checksums of the segment */
+	net_pkt_cursor_init(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == NET_AF_INET) {
+		ret = net_ipv4_finalize(seg, NET_IPPROTO_TCP);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(seg) == NET_AF_INET6) {
+		ret = net_ipv6_finalize(seg, NET_IPPROTO_TCP);
+	} else {
+		ret = -EINVAL;
+	}
+
+	if (ret < 0) {
+		goto fail;
+	}
+
+	net_pkt_set_overwrite(seg, false);
+	net_pkt_cursor_init(seg);
+
+	/* The sender is notified once, when the last segment is sent */
+	if (final) {
+		net_pkt_set_context(seg, net_pkt_context(pkt));
+	}
+
+	ret = net_send_data(seg);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return 0;
+
+fail:
+	NET_DBG("Cannot send segment (%d)", ret);
+	net_pkt_unref(seg);
+
+	return ret;
+}
+
+int net_tcp_gso_segment(struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	uint16_t gso_size = net_pkt_gso_size(pkt);
+	struct tcphdr *th;
+	size_t payload_len;
+	size_t hdr_len;
+	size_t offset;
+	int ret;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, ip_len)) {
+		return -EINVAL;
+	}
+
+	th = (struct tcphdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (!th) {
+		return -EINVAL;
+	}
+
+	hdr_len = ip_len + th_off(th) * 4U;
+	payload_len = net_pkt_get_len(pkt) - hdr_len;
+
+	net_pkt_cursor_init(pkt);
+
+	NET_DBG("pkt %p, %zu bytes in segments of %u", pkt, payload_len, gso_size);
+
+	for (offset = 0; offset < payload_len; offset += gso_size) {
+		size_t len = MIN(gso_size, payload_len - offset);
+
+		ret = send_tcp_segment(pkt, hdr_len, offset, len,
+				       offset + len == payload_len);
+		if (ret < 0) {
+			if (offset == 0) {
+				return ret;
+			}
+
+			/* The first segments are on their way already, the
+			 * rest of the data is still unacknowledged and is
+			 * retransmitted by TCP.
+			 */
+			NET_DBG("pkt %p, %zu of %zu bytes sent", pkt, offset, payload_len);
+			break;
+		}
+	}
+
+	/* The segments are sent, simulate the sending of the original packet */
+	net_pkt_unref(pkt);
+
+	return offset;
+}
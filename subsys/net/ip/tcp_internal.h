@@ -50,6 +50,7 @@ enum tcp_conn_option {
 	TCP_OPT_KEEPIDLE = 3,
 	TCP_OPT_KEEPINTVL = 4,
 	TCP_OPT_KEEPCNT = 5,
+	TCP_OPT_CONGESTION = 6,
 };
 
 /**
@@ -301,6 +302,64 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 }
 #endif
 
+/**
+ * @brief Cut a GSO packet into segments and send them
+ *
+ * @param pkt TCP packet larger than its GSO size
+ *
+ * @return Number of payload bytes sent, the packet is then released. If a
+ *         segment cannot be sent, the ones after it are not either, the
+ *         unsent data is left to the retransmissions of TCP. Negative errno
+ *         if nothing was sent, the packet is then still owned by the caller.
+ */
+#if defined(CONFIG_NET_TCP_GSO)
+int net_tcp_gso_segment(struct net_pkt *pkt);
+#else
+static inline int net_tcp_gso_segment(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return -ENOTSUP;
+}
+#endif
+
+struct tcp;
+
+/**
+ * @brief Received segments held for coalescing by one RX queue
+ *
+ * Owned by the thread of the RX queue: only that thread holds segments in
+ * it and flushes it, so the segments of a flow, which are all received on
+ * the same queue, are processed in order.
+ */
+struct net_tcp_gro {
+	/** Connection of the held segments */
+	struct tcp *conn;
+	/** Held segments, coalesced into a single packet */
+	struct net_pkt *pkt;
+	/** Sequence number expected in the next segment to coalesce */
+	uint32_t next_seq;
+	/** Number of coalesced segments */
+	uint8_t segs;
+};
+
+/**
+ * @brief Process the received segments held for coalescing
+ *
+ * Called by the thread owning the GRO state once there are no more packets
+ * pending in its RX queue.
+ *
+ * @param gro GRO state of the RX queue
+ */
+#if defined(CONFIG_NET_TCP_GRO)
+void net_tcp_gro_flush(struct net_tcp_gro *gro);
+#else
+static inline void net_tcp_gro_flush(struct net_tcp_gro *gro)
+{
+	ARG_UNUSED(gro);
+}
+#endif
+
 /**
  * @brief Enqueue data for transmission
  *
@@ -327,6 +386,28 @@ static inline int net_tcp_queue(struct net_context *context, const void *data,
 }
 #endif
 
+/**
+ * @brief Enqueue network buffers for transmission without copying them
+ *
+ * @param context	Network context
+ * @param buf		Fragments holding the data, owned by the connection
+ *			once the function succeeds
+ *
+ * @return Number of bytes queued if ok, < 0 if error
+ */
+#if defined(CONFIG_NET_NATIVE_TCP) && defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+int net_tcp_queue_buf(struct net_context *context, struct net_buf *buf);
+#else
+static inline int net_tcp_queue_buf(struct net_context *context,
+				    struct net_buf *buf)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(buf);
+
+	return -EPROTONOSUPPORT;
+}
+#endif
+
 /**
  * @brief Update TCP receive window
  *
@@ -229,26 +229,69 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* At most 4 SACK blocks fit in the 40 bytes of TCP options */
+#define NET_TCP_SACK_MAX_BLOCKS   4
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
+};
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
+
+/* SACK blocks carried by a received segment */
+struct tcp_sack_option {
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t count;
+};
+
+#ifdef CONFIG_NET_TCP_SACK
+
+struct tcp_sack_scoreboard {
+	/* Data held by the peer above SND.UNA, sorted and not overlapping */
+	struct tcp_sack_block blocks[CONFIG_NET_TCP_SACK_SCOREBOARD_SIZE];
+	/* End of the data retransmitted during the current loss recovery */
+	uint32_t high_rxt;
+	/* Loss recovery ends once everything up to here is acknowledged */
+	uint32_t recovery_point;
+	uint8_t count;
+	bool in_recovery : 1;
 };
+#endif
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-struct tcp_collision_avoidance_reno {
+struct tcp_ca_ops;
+
+/* Room for the per connection state of the congestion avoidance algorithm,
+ * in 32-bit words.
+ */
+#define TCP_CA_PRIV_SIZE 5
+
+struct tcp_congestion_avoidance {
+	/* Algorithm in use, see tcp_ca.h */
+	const struct tcp_ca_ops *ops;
 	uint16_t cwnd;
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
+	uint32_t priv[TCP_CA_PRIV_SIZE];
 };
 #endif
 
@@ -335,7 +378,10 @@ struct tcp { /* TCP connection */
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	struct tcp_collision_avoidance_reno ca;
+	struct tcp_congestion_avoidance ca;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_scoreboard sack;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -51,6 +51,17 @@ static const char *verdict2str(enum net_verdict verdict)
 	return "<UNK>";
 }
 
+static const char *rule_result2str(struct npf_rule *rule, enum npf_rule_type type)
+{
+#if defined(CONFIG_NET_PKT_FILTER_REDIRECT)
+	if (rule->redirect != NULL && type == NPF_RULE_TYPE_RECV) {
+		return "REDIRECT";
+	}
+#endif
+
+	return verdict2str(rule->result);
+}
+
 static void rule_cb(struct npf_rule *rule, enum npf_rule_type type, void *user_data)
 {
 	struct net_shell_user_data *data = user_data;
@@ -60,7 +71,7 @@ static void rule_cb(struct npf_rule *rule, enum npf_rule_type type, void *user_d
 	int thread_prio;
 
 	PR("[%2d]  %-10s  %-8s  ",
-	   (*count) + 1, rule_type2str(type), verdict2str(rule->result));
+	   (*count) + 1, rule_type2str(type), rule_result2str(rule, type));
 
 	if (rule->result == NET_CONTINUE && type == NPF_RULE_TYPE_SEND) {
 		tc = net_tx_priority2tc(rule->priority);
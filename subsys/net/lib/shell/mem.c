@@ -91,6 +91,22 @@ static void context_info(struct net_context *context, void *user_data)
 	info->pos++;
 #endif /* CONFIG_NET_CONTEXT_NET_PKT_POOL */
 }
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE) && defined(CONFIG_NET_BUF_POOL_USAGE)
+static void print_pool_cache_stats(const struct shell *sh,
+				   struct net_buf_pool *pool, const char *name)
+{
+	struct net_buf_pool_cache_stats stats;
+
+	if (net_buf_pool_cache_stats_get(pool, &stats) < 0) {
+		return;
+	}
+
+	PR("%s cache: %u hits, %u misses, %u refills, %u drains, %u cached\n",
+	   name, stats.hits, stats.misses, stats.refills, stats.drains,
+	   stats.cached);
+}
+#endif /* CONFIG_NET_BUF_POOL_CACHE && CONFIG_NET_BUF_POOL_USAGE */
 #endif /* CONFIG_NET_OFFLOAD || CONFIG_NET_NATIVE */
 
 static int cmd_net_mem(const struct shell *sh, size_t argc, char *argv[])
@@ -133,6 +149,11 @@ static int cmd_net_mem(const struct shell *sh, size_t argc, char *argv[])
 
 	PR("%p\t%d\t%ld\t%d\tTX DATA (%s)\n", tx_data, tx_data->buf_count,
 	   atomic_get(&tx_data->avail_count), tx_data->max_used, tx_data->name);
+
+#if defined(CONFIG_NET_BUF_POOL_CACHE)
+	print_pool_cache_stats(sh, rx_data, "RX DATA");
+	print_pool_cache_stats(sh, tx_data, "TX DATA");
+#endif
 #else
 	PR("Address\t\tTotal\tName\n");
 
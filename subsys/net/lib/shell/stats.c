@@ -626,6 +626,9 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	   IF_ENABLED(CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK,
 		      (GET_STAT(iface, pkt_filter.rx.local_drop),))
 	   GET_STAT(iface, pkt_filter.tx.drop));
+#if defined(CONFIG_NET_PKT_FILTER_REDIRECT)
+	PR("Filter redir rx %u\n", GET_STAT(iface, pkt_filter.rx.redirect));
+#endif
 #endif /* CONFIG_NET_STATISTICS_DNS */
 
 	PR("Bytes received %llu\n", GET_STAT(iface, bytes.received));
@@ -14,6 +14,7 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/timeutil.h>
 
 #include "sockets_internal.h"
 
@@ -710,6 +711,276 @@ fail:
 #include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+static int sendmmsg_internal(int sock, struct net_mmsghdr *msgvec,
+			     unsigned int vlen, int flags,
+			     ssize_t (*send_one)(int sock,
+						 const struct net_msghdr *msg,
+						 int flags))
+{
+	const struct socket_op_vtable *vtable;
+	unsigned int count = 0;
+	struct k_mutex *lock;
+	bool locked = false;
+	ssize_t ret = 0;
+
+	if (get_sock_vtable(sock, &vtable, &lock) == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	vlen = MIN(vlen, NET_MMSG_VLEN_MAX);
+
+	/* Keep other senders from interleaving their data with the batch.
+	 * As for receiving, a blocking send must not hold the lock, as the
+	 * native socket code only releases it once while waiting for room.
+	 */
+	if (flags & ZSOCK_MSG_DONTWAIT) {
+		(void)k_mutex_lock(lock, K_FOREVER);
+		locked = true;
+	}
+
+	while (count < vlen) {
+		ret = send_one(sock, &msgvec[count].msg_hdr, flags);
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[count].msg_len = (unsigned int)ret;
+		count++;
+	}
+
+	if (locked) {
+		k_mutex_unlock(lock);
+	}
+
+	return (count > 0) ? (int)count : (int)ret;
+}
+
+int z_impl_zsock_sendmmsg(int sock, struct net_mmsghdr *msgvec,
+			  unsigned int vlen, int flags)
+{
+	return sendmmsg_internal(sock, msgvec, vlen, flags,
+				 z_impl_zsock_sendmsg);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct net_mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	vlen = MIN(vlen, NET_MMSG_VLEN_MAX);
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(*msgvec)));
+
+	return sendmmsg_internal(sock, msgvec, vlen, flags,
+				 z_vrfy_zsock_sendmsg);
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+/* Wait for a message until the end of the batch, returns 0 once readable */
+static int recvmmsg_wait(int sock, k_timepoint_t end)
+{
+	struct zsock_pollfd pfd = {
+		.fd = sock,
+		.events = ZSOCK_POLLIN,
+	};
+	k_timeout_t timeout = sys_timepoint_timeout(end);
+	int ret;
+
+	ret = zsock_poll(&pfd, 1, K_TIMEOUT_EQ(timeout, K_FOREVER) ? -1 :
+			 (int)k_ticks_to_ms_ceil32(timeout.ticks));
+	if (ret == 0) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	return (ret < 0) ? -1 : 0;
+}
+
+static int recvmmsg_internal(int sock, struct net_mmsghdr *msgvec,
+			     unsigned int vlen, int flags,
+			     const struct timespec *timeout,
+			     ssize_t (*recv_one)(int sock,
+						 struct net_msghdr *msg,
+						 int flags))
+{
+	const struct socket_op_vtable *vtable;
+	k_timepoint_t end = sys_timepoint_calc(K_FOREVER);
+	unsigned int count = 0;
+	bool wait_for_one = (flags & ZSOCK_MSG_WAITFORONE) != 0;
+	struct k_mutex *lock;
+	bool locked = false;
+	ssize_t ret = 0;
+
+	if (get_sock_vtable(sock, &vtable, &lock) == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (timeout != NULL) {
+		if (!timespec_is_valid(timeout)) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		end = sys_timepoint_calc(timespec_to_timeout(timeout, NULL));
+	}
+
+	vlen = MIN(vlen, NET_MMSG_VLEN_MAX);
+	flags &= ~ZSOCK_MSG_WAITFORONE;
+
+	while (count < vlen) {
+		int msg_flags = flags;
+
+		/* With a timeout, the queued messages are taken without
+		 * waiting, and the socket is only polled once it is empty.
+		 */
+		if (timeout != NULL) {
+			msg_flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		/* Queued messages are drained with the socket lock held
+		 * across the whole batch. A blocking receive must not hold it
+		 * though, as it only releases the lock once while waiting.
+		 */
+		if ((msg_flags & ZSOCK_MSG_DONTWAIT) && !locked) {
+			(void)k_mutex_lock(lock, K_FOREVER);
+			locked = true;
+		}
+
+		ret = recv_one(sock, &msgvec[count].msg_hdr, msg_flags);
+		if ((ret < 0) && (errno == EAGAIN) && (timeout != NULL) &&
+		    !(flags & ZSOCK_MSG_DONTWAIT)) {
+			/* Do not keep other users out of the socket while
+			 * waiting.
+			 */
+			k_mutex_unlock(lock);
+			locked = false;
+
+			ret = recvmmsg_wait(sock, end);
+			if (ret < 0) {
+				break;
+			}
+
+			continue;
+		}
+
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[count].msg_len = (unsigned int)ret;
+		count++;
+
+		if (wait_for_one) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+	}
+
+	if (locked) {
+		k_mutex_unlock(lock);
+	}
+
+	return (count > 0) ? (int)count : (int)ret;
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct net_mmsghdr *msgvec,
+			  unsigned int vlen, int flags,
+			  const struct timespec *timeout)
+{
+	return recvmmsg_internal(sock, msgvec, vlen, flags, timeout,
+				 z_impl_zsock_recvmsg);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct net_mmsghdr *msgvec,
+					unsigned int vlen, int flags,
+					const struct timespec *timeout)
+{
+	struct timespec timeout_copy;
+
+	vlen = MIN(vlen, NET_MMSG_VLEN_MAX);
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(*msgvec)));
+
+	if (timeout != NULL) {
+		K_OOPS(k_usermode_from_copy(&timeout_copy, (void *)timeout,
+					    sizeof(timeout_copy)));
+	}
+
+	return recvmmsg_internal(sock, msgvec, vlen, flags,
+				 (timeout != NULL) ? &timeout_copy : NULL,
+				 z_vrfy_zsock_recvmsg);
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+/* Only the native sockets know about the network buffers of their data */
+static struct net_context *get_native_sock(int sock, struct k_mutex **lock)
+{
+	const struct socket_op_vtable *vtable;
+	struct net_context *ctx;
+
+	ctx = get_sock_vtable(sock, &vtable, lock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	if (vtable != &sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return NULL;
+	}
+
+	return ctx;
+}
+
+ssize_t zsock_recv_buf(int sock, struct net_buf **buf, int flags)
+{
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	if (buf == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ctx = get_native_sock(sock, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zsock_recv_buf_ctx(ctx, buf, flags);
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+ssize_t zsock_send_buf(int sock, struct net_buf *buf, int flags)
+{
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	if (buf == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ctx = get_native_sock(sock, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zsock_send_buf_ctx(ctx, buf, flags);
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -1608,6 +1608,220 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct net_msghdr *msg,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+/* Copy the unread data of a packet to new fragments */
+static struct net_buf *pkt_copy_data(struct net_pkt *pkt, size_t len)
+{
+	struct net_pkt_cursor backup;
+	struct net_buf *head = NULL;
+	struct net_buf *frag;
+	size_t copy_len;
+
+	net_pkt_cursor_backup(pkt, &backup);
+
+	while (len > 0) {
+		frag = net_pkt_get_frag(pkt, len, K_NO_WAIT);
+		if (frag == NULL) {
+			goto fail;
+		}
+
+		copy_len = MIN(len, net_buf_tailroom(frag));
+		head = net_buf_frag_add(head, frag);
+
+		if (net_pkt_read(pkt, net_buf_add(frag, copy_len), copy_len)) {
+			goto fail;
+		}
+
+		len -= copy_len;
+	}
+
+	return head;
+
+fail:
+	net_pkt_cursor_restore(pkt, &backup);
+
+	if (head != NULL) {
+		net_buf_unref(head);
+	}
+
+	return NULL;
+}
+
+/* Return the unread data of a packet as a fragment chain owned by the
+ * caller, without copying it unless the fragments are shared.
+ */
+static struct net_buf *pkt_detach_data(struct net_pkt *pkt, size_t len)
+{
+	struct net_buf *frag = pkt->cursor.buf;
+	size_t offset;
+
+	if (len == 0 || frag == NULL) {
+		return NULL;
+	}
+
+	if (pkt->buffer->ref > 1 || frag->ref > 1) {
+		return pkt_copy_data(pkt, len);
+	}
+
+	offset = pkt->cursor.pos - frag->data;
+
+	while (offset == frag->len && frag->frags != NULL) {
+		frag = frag->frags;
+		offset = 0;
+	}
+
+	/* The extra reference keeps the fragments from the cursor on alive
+	 * when the packet releases its buffer, the ones before it are freed.
+	 */
+	frag = net_buf_ref(frag);
+	net_buf_pull(frag, offset);
+
+	return frag;
+}
+
+ssize_t zsock_recv_buf_ctx(struct net_context *ctx, struct net_buf **buf,
+			   int flags)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	size_t len;
+	int ret;
+
+	*buf = NULL;
+
+	if (flags & ZSOCK_MSG_PEEK) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (sock_type == NET_SOCK_STREAM) {
+		if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+			errno = ENOTCONN;
+			return -1;
+		}
+
+		if (sock_is_error(ctx)) {
+			errno = POINTER_TO_INT(ctx->user_data);
+			return -1;
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+	} else if (sock_type != NET_SOCK_DGRAM && sock_type != NET_SOCK_RAW) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	pkt = k_fifo_peek_head(&ctx->recv_q);
+	if (pkt == NULL) {
+		if (sock_type == NET_SOCK_STREAM && sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		errno = EAGAIN;
+		return -1;
+	}
+
+	len = net_pkt_remaining_data(pkt);
+
+	/* The packet stays queued if its data cannot be returned */
+	*buf = pkt_detach_data(pkt, len);
+	if (len > 0 && *buf == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+
+	if (sock_type == NET_SOCK_STREAM && net_pkt_eof(pkt)) {
+		sock_set_eof(ctx);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	net_pkt_unref(pkt);
+
+	if (sock_type == NET_SOCK_STREAM) {
+		net_context_update_recv_wnd(ctx, len);
+	}
+
+	return len;
+}
+
+ssize_t zsock_send_buf_ctx(struct net_context *ctx, struct net_buf *buf,
+			   int flags)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
+	k_timepoint_t buf_timeout, end;
+	int status;
+
+	if (net_context_get_type(ctx) != NET_SOCK_STREAM ||
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+		buf_timeout = sys_timepoint_calc(K_NO_WAIT);
+	} else {
+		net_context_get_option(ctx, NET_OPT_SNDTIMEO, &timeout, NULL);
+		buf_timeout = sys_timepoint_calc(MAX_WAIT_BUFS);
+	}
+	end = sys_timepoint_calc(timeout);
+
+	/* Register the callback before sending in order to receive the response
+	 * from the peer.
+	 */
+	if (!sock_is_eof(ctx)) {
+		status = net_context_recv(ctx, zsock_received_cb,
+					  K_NO_WAIT, ctx->user_data);
+		if (status < 0) {
+			errno = -status;
+			return -1;
+		}
+	}
+
+	while (1) {
+		status = net_tcp_queue_buf(ctx, buf);
+		if (status < 0) {
+			status = send_check_and_wait(ctx, status, buf_timeout,
+						     timeout, &retry_timeout);
+			if (status < 0) {
+				return status;
+			}
+
+			/* Update the timeout value in case loop is repeated. */
+			timeout = sys_timepoint_timeout(end);
+
+			continue;
+		}
+
+		break;
+	}
+
+	return status;
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 static int zsock_poll_prepare_ctx(struct net_context *ctx,
 				  struct zsock_pollfd *pfd,
 				  struct k_poll_event **pev,
@@ -1992,6 +2206,20 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case ZSOCK_TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_get_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 
@@ -2623,6 +2851,20 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case ZSOCK_TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 		break;
@@ -20,6 +20,15 @@ int zsock_poll_internal(struct zsock_pollfd *fds, int nfds, k_timeout_t timeout)
 
 int zsock_wait_data(struct net_context *ctx, k_timeout_t *timeout);
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+extern const struct socket_op_vtable sock_fd_op_vtable;
+
+ssize_t zsock_recv_buf_ctx(struct net_context *ctx, struct net_buf **buf,
+			   int flags);
+ssize_t zsock_send_buf_ctx(struct net_context *ctx, struct net_buf *buf,
+			   int flags);
+#endif
+
 static inline void sock_set_flag(struct net_context *ctx, uintptr_t mask,
 				 uintptr_t flag)
 {
@@ -1062,6 +1062,27 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			opt_cnt += 2;
 			break;
 
+#if defined(CONFIG_NET_ZPERF_UDP_BATCH) && CONFIG_NET_ZPERF_UDP_BATCH > 1
+		case 'm': {
+			int batch = parse_arg(&i, argc, argv);
+
+			if (!is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "TCP does not support -m option\n");
+				return -ENOEXEC;
+			}
+			if (batch < 1 || batch > CONFIG_NET_ZPERF_UDP_BATCH) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.batch = batch;
+			opt_cnt += 2;
+			break;
+		}
+#endif /* CONFIG_NET_ZPERF_UDP_BATCH > 1 */
+
 		case 'i':
 			seconds = parse_arg(&i, argc, argv);
 
@@ -1315,6 +1336,27 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			opt_cnt += 2;
 			break;
 
+#if defined(CONFIG_NET_ZPERF_UDP_BATCH) && CONFIG_NET_ZPERF_UDP_BATCH > 1
+		case 'm': {
+			int batch = parse_arg(&i, argc, argv);
+
+			if (!is_udp) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "TCP does not support -m option\n");
+				return -ENOEXEC;
+			}
+			if (batch < 1 || batch > CONFIG_NET_ZPERF_UDP_BATCH) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+
+			param.options.batch = batch;
+			opt_cnt += 2;
+			break;
+		}
+#endif /* CONFIG_NET_ZPERF_UDP_BATCH > 1 */
+
 		case 'i':
 			seconds = parse_arg(&i, argc, argv);
 
@@ -2007,6 +2049,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
 		  "-I: Specify host interface name\n"
+#if defined(CONFIG_NET_ZPERF_UDP_BATCH) && CONFIG_NET_ZPERF_UDP_BATCH > 1
+		  "-m count: Send count datagrams per system call (sendmmsg)\n"
+#endif /* CONFIG_NET_ZPERF_UDP_BATCH > 1 */
 		  "Example: udp upload 192.0.2.2 1111 1 1K 1M\n"
 		  "Example: udp upload 2001:db8::2\n",
 		  cmd_udp_upload),
@@ -2032,6 +2077,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
 		  "-I: Specify host interface name\n"
+#if defined(CONFIG_NET_ZPERF_UDP_BATCH) && CONFIG_NET_ZPERF_UDP_BATCH > 1
+		  "-m count: Send count datagrams per system call (sendmmsg)\n"
+#endif /* CONFIG_NET_ZPERF_UDP_BATCH > 1 */
 		  "Example: udp upload2 v4 1 1K 1M\n"
 		  "Example: udp upload2 v6\n"
 #if defined(CONFIG_NET_IPV6) && defined(MY_IP6ADDR_SET)
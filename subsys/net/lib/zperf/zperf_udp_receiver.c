@@ -312,14 +312,55 @@ static void udp_receiver_cleanup(void)
 	zperf_session_reset(SESSION_UDP);
 }
 
+/* Receive up to CONFIG_NET_ZPERF_UDP_BATCH datagrams without blocking,
+ * returns the number of datagrams handled.
+ */
+static int udp_recv_batch(int sock)
+{
+	static uint8_t bufs[CONFIG_NET_ZPERF_UDP_BATCH][UDP_RECEIVER_BUF_SIZE];
+	static struct net_sockaddr addrs[CONFIG_NET_ZPERF_UDP_BATCH];
+	static struct net_iovec iov[CONFIG_NET_ZPERF_UDP_BATCH];
+	static struct net_mmsghdr msgs[CONFIG_NET_ZPERF_UDP_BATCH];
+	int ret;
+
+	if (CONFIG_NET_ZPERF_UDP_BATCH == 1) {
+		net_socklen_t addrlen = sizeof(addrs[0]);
+
+		ret = zsock_recvfrom(sock, bufs[0], sizeof(bufs[0]), ZSOCK_MSG_DONTWAIT,
+				     &addrs[0], &addrlen);
+		if (ret >= 0) {
+			udp_received(sock, &addrs[0], bufs[0], ret);
+			ret = 1;
+		}
+
+		return ret;
+	}
+
+	for (int i = 0; i < CONFIG_NET_ZPERF_UDP_BATCH; i++) {
+		iov[i].iov_base = bufs[i];
+		iov[i].iov_len = sizeof(bufs[i]);
+		msgs[i].msg_hdr = (struct net_msghdr) {
+			.msg_name = &addrs[i],
+			.msg_namelen = sizeof(addrs[i]),
+			.msg_iov = &iov[i],
+			.msg_iovlen = 1,
+		};
+	}
+
+	ret = zsock_recvmmsg(sock, msgs, CONFIG_NET_ZPERF_UDP_BATCH, ZSOCK_MSG_DONTWAIT, NULL);
+
+	for (int i = 0; i < ret; i++) {
+		udp_received(sock, &addrs[i], bufs[i], msgs[i].msg_len);
+	}
+
+	return ret;
+}
+
 static int udp_recv_data(struct net_socket_service_event *pev)
 {
-	static uint8_t buf[UDP_RECEIVER_BUF_SIZE];
 	int ret = 1;
 	int family, sock_error;
-	struct net_sockaddr addr;
 	net_socklen_t optlen = sizeof(int);
-	net_socklen_t addrlen = sizeof(addr);
 
 	if (!udp_server_running) {
 		return -ENOENT;
@@ -342,8 +383,7 @@ static int udp_recv_data(struct net_socket_service_event *pev)
 	}
 
 	while (ret > 0) {
-		ret = zsock_recvfrom(pev->event.fd, buf, sizeof(buf), ZSOCK_MSG_DONTWAIT,
-				     &addr, &addrlen);
+		ret = udp_recv_batch(pev->event.fd);
 		if ((ret < 0) && (errno == EAGAIN)) {
 			ret = 0;
 			break;
@@ -357,8 +397,6 @@ static int udp_recv_data(struct net_socket_service_event *pev)
 				family == NET_AF_INET ? 4 : 6, -ret);
 			goto error;
 		}
-
-		udp_received(pev->event.fd, &addr, buf, ret);
 	}
 	return ret;
 
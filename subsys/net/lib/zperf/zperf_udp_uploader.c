@@ -15,9 +15,14 @@ LOG_MODULE_DECLARE(net_zperf, CONFIG_NET_ZPERF_LOG_LEVEL);
 #include "zperf_internal.h"
 #include "zperf_session.h"
 
-static uint8_t sample_packet[sizeof(struct zperf_udp_datagram) +
-			     sizeof(struct zperf_client_hdr_v1) +
-			     PACKET_SIZE_MAX];
+#define SAMPLE_PACKET_SIZE (sizeof(struct zperf_udp_datagram) + \
+			    sizeof(struct zperf_client_hdr_v1) + \
+			    PACKET_SIZE_MAX)
+
+/* One packet per datagram of a batch, the first one is also used alone */
+static uint8_t sample_packets[CONFIG_NET_ZPERF_UDP_BATCH][SAMPLE_PACKET_SIZE];
+static struct net_iovec batch_iov[CONFIG_NET_ZPERF_UDP_BATCH];
+static struct net_mmsghdr batch_msgs[CONFIG_NET_ZPERF_UDP_BATCH];
 
 #if !defined(CONFIG_ZPERF_SESSION_PER_THREAD)
 static struct zperf_async_upload_context udp_async_upload_ctx;
@@ -73,6 +78,7 @@ static inline int zperf_upload_fin(int sock,
 		.tv_sec = 2,
 		.tv_usec = 0,
 	};
+	uint8_t *sample_packet = sample_packets[0];
 
 	while (ret <= 0 && loop-- > 0) {
 		datagram = (struct zperf_udp_datagram *)sample_packet;
@@ -93,7 +99,7 @@ static inline int zperf_upload_fin(int sock,
 		hdr->flags = 0;
 		hdr->num_of_threads = net_htonl(1);
 		hdr->port = 0;
-		hdr->buffer_len = sizeof(sample_packet) -
+		hdr->buffer_len = SAMPLE_PACKET_SIZE -
 			sizeof(*datagram) - sizeof(*hdr);
 		hdr->bandwidth = 0;
 		hdr->num_of_bytes = net_htonl(packet_size);
@@ -176,7 +182,8 @@ struct compensate_ctx {
  * Then try to compensate in this loop.
  * If delay is not enough as it cannot be less than 0, pile up compensate ticks.
  */
-static int cal_compensate_delay(struct compensate_ctx *ctx, int64_t loop_time, int delay)
+static int cal_compensate_delay(struct compensate_ctx *ctx, int64_t loop_time, int delay,
+				uint32_t pkts)
 {
 	int64_t delta_time;
 	int expected_pkts;
@@ -193,7 +200,7 @@ static int cal_compensate_delay(struct compensate_ctx *ctx, int64_t loop_time, i
 		ctx->actual_pkts = 0;
 	}
 
-	ctx->actual_pkts++;
+	ctx->actual_pkts += pkts;
 	delta_time = loop_time - ctx->period_start;
 
 	if (delta_time < ctx->period) {
@@ -235,11 +242,12 @@ static int udp_upload(int sock, int port,
 	uint32_t duration_in_ms = param->duration_ms;
 	uint32_t packet_size = param->packet_size;
 	uint32_t rate_in_kbps = param->rate_kbps;
+	uint32_t batch = CLAMP(param->options.batch, 1, CONFIG_NET_ZPERF_UDP_BATCH);
 	uint32_t packet_duration_us = zperf_packet_duration(packet_size, rate_in_kbps);
-	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
-	uint32_t delay = packet_duration;
-	uint64_t data_offset = 0U;
+	uint32_t delay = k_us_to_ticks_ceil32(packet_duration_us * batch);
 	uint32_t nb_packets = 0U;
+	/* Datagrams sent by the previous loop iteration, paced as a whole */
+	uint32_t sent = 0U;
 	uint64_t usecs64;
 	int64_t start_time, end_time;
 	int64_t print_time, last_loop_time;
@@ -269,7 +277,16 @@ static int udp_upload(int sock, int port,
 	print_time = start_time + print_period;
 
 	/* Default data payload */
-	(void)memset(sample_packet, 'z', sizeof(sample_packet));
+	(void)memset(sample_packets, 'z', sizeof(sample_packets));
+
+	for (uint32_t i = 0; i < batch; i++) {
+		batch_iov[i].iov_base = sample_packets[i];
+		batch_iov[i].iov_len = packet_size;
+		batch_msgs[i].msg_hdr = (struct net_msghdr) {
+			.msg_iov = &batch_iov[i],
+			.msg_iovlen = 1,
+		};
+	}
 
 #ifdef ZPERF_UDP_UPLOAD_CLOCK_COMPENSATE
 	/* compensate period, by default 10 ticks */
@@ -290,7 +307,7 @@ static int udp_upload(int sock, int port,
 
 		/* Algorithm to maintain a given baud rate */
 		if (last_loop_time != loop_time) {
-			adjust = packet_duration;
+			adjust = k_us_to_ticks_ceil32(packet_duration_us * sent);
 			adjust -= (int32_t)(loop_time - last_loop_time);
 		} else {
 			/* It's the first iteration so no need for adjustment
@@ -306,7 +323,7 @@ static int udp_upload(int sock, int port,
 
 		/* add clock compensate to packet delay when clock accuracy is lower than 1KHz */
 #ifdef ZPERF_UDP_UPLOAD_CLOCK_COMPENSATE
-		compensate_delay = cal_compensate_delay(&ctx, loop_time, (int)delay);
+		compensate_delay = cal_compensate_delay(&ctx, loop_time, (int)delay, sent);
 #else
 		compensate_delay = delay;
 #endif
@@ -317,43 +334,62 @@ static int udp_upload(int sock, int port,
 		secs = usecs64 / USEC_PER_SEC;
 		usecs = usecs64 % USEC_PER_SEC;
 
-		/* Fill the packet header */
-		datagram = (struct zperf_udp_datagram *)sample_packet;
-
-		datagram->id = net_htonl(nb_packets);
-		datagram->tv_sec = net_htonl(secs);
-		datagram->tv_usec = net_htonl(usecs);
-
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
-						     sizeof(*datagram));
-		hdr->flags = 0;
-		hdr->num_of_threads = net_htonl(1);
-		hdr->port = net_htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
-			sizeof(*datagram) - sizeof(*hdr);
-		hdr->bandwidth = net_htonl(rate_in_kbps);
-		hdr->num_of_bytes = net_htonl(packet_size);
+		for (uint32_t i = 0; i < batch; i++) {
+			uint8_t *sample_packet = sample_packets[i];
+			uint64_t data_offset =
+				(uint64_t)(nb_packets + i) * (packet_size - header_size);
+
+			/* Fill the packet header */
+			datagram = (struct zperf_udp_datagram *)sample_packet;
+
+			datagram->id = net_htonl(nb_packets + i);
+			datagram->tv_sec = net_htonl(secs);
+			datagram->tv_usec = net_htonl(usecs);
+
+			hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
+							     sizeof(*datagram));
+			hdr->flags = 0;
+			hdr->num_of_threads = net_htonl(1);
+			hdr->port = net_htonl(port);
+			hdr->buffer_len = SAMPLE_PACKET_SIZE -
+				sizeof(*datagram) - sizeof(*hdr);
+			hdr->bandwidth = net_htonl(rate_in_kbps);
+			hdr->num_of_bytes = net_htonl(packet_size);
+
+			/* Load custom data payload if requested */
+			if (param->data_loader != NULL) {
+				ret = param->data_loader(param->data_loader_ctx, data_offset,
+					sample_packet + header_size, packet_size - header_size);
+				if (ret < 0) {
+					NET_ERR("Failed to load data for offset %llu",
+						data_offset);
+					return ret;
+				}
+			}
+		}
 
-		/* Load custom data payload if requested */
-		if (param->data_loader != NULL) {
-			ret = param->data_loader(param->data_loader_ctx, data_offset,
-				sample_packet + header_size, packet_size - header_size);
+		/* Send the packets */
+		if (batch > 1) {
+			/* Datagrams not sent are sent again with the next batch */
+			ret = zsock_sendmmsg(sock, batch_msgs, batch, 0);
 			if (ret < 0) {
-				NET_ERR("Failed to load data for offset %llu", data_offset);
-				return ret;
+				NET_ERR("Failed to send the packets (%d)", errno);
+				return -errno;
 			}
-		}
-		data_offset += packet_size - header_size;
 
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
-		if (ret < 0) {
-			NET_ERR("Failed to send the packet (%d)", errno);
-			return -errno;
+			sent = ret;
 		} else {
-			nb_packets++;
+			ret = zsock_send(sock, sample_packets[0], packet_size, 0);
+			if (ret < 0) {
+				NET_ERR("Failed to send the packet (%d)", errno);
+				return -errno;
+			}
+
+			sent = 1U;
 		}
 
+		nb_packets += sent;
+
 		if (IS_ENABLED(CONFIG_NET_ZPERF_LOG_LEVEL_DBG)) {
 			if (print_time >= loop_time) {
 				NET_DBG("nb_packets=%u\tdelay=%u\tadjust=%d",
@@ -101,7 +101,8 @@ static bool apply_tests(struct npf_rule *rule, struct net_pkt *pkt)
 /*
  * We return the specified result for the first rule whose tests are all true.
  */
-static enum net_verdict evaluate(sys_slist_t *rule_head, struct net_pkt *pkt)
+static enum net_verdict evaluate(sys_slist_t *rule_head, struct net_pkt *pkt,
+				 struct k_fifo **redirect)
 {
 	struct npf_rule *rule;
 
@@ -118,6 +119,13 @@ static enum net_verdict evaluate(sys_slist_t *rule_head, struct net_pkt *pkt)
 				net_pkt_set_priority(pkt, rule->priority);
 				continue;
 			}
+#if defined(CONFIG_NET_PKT_FILTER_REDIRECT)
+			if (redirect != NULL) {
+				*redirect = rule->redirect;
+			}
+#else
+			ARG_UNUSED(redirect);
+#endif
 			return rule->result;
 		}
 	}
@@ -129,7 +137,7 @@ static enum net_verdict evaluate(sys_slist_t *rule_head, struct net_pkt *pkt)
 static enum net_verdict lock_evaluate(struct npf_rule_list *rules, struct net_pkt *pkt)
 {
 	k_spinlock_key_t key = k_spin_lock(&rules->lock);
-	enum net_verdict result = evaluate(&rules->rule_head, pkt);
+	enum net_verdict result = evaluate(&rules->rule_head, pkt, NULL);
 
 	k_spin_unlock(&rules->lock, key);
 	return result;
@@ -149,6 +157,28 @@ bool net_pkt_filter_recv_ok(struct net_pkt *pkt)
 	return result == NET_OK;
 }
 
+enum net_verdict net_pkt_filter_recv(struct net_pkt *pkt)
+{
+	struct k_fifo *redirect = NULL;
+	k_spinlock_key_t key = k_spin_lock(&npf_recv_rules.lock);
+	enum net_verdict result = evaluate(&npf_recv_rules.rule_head, pkt, &redirect);
+
+	k_spin_unlock(&npf_recv_rules.lock, key);
+
+	if (result != NET_OK) {
+		return NET_DROP;
+	}
+
+	if (redirect == NULL) {
+		return NET_CONTINUE;
+	}
+
+	NET_DBG("redirecting pkt %p to fifo %p", pkt, redirect);
+	k_fifo_put(redirect, pkt);
+
+	return NET_OK;
+}
+
 #ifdef CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK
 bool net_pkt_filter_local_in_recv_ok(struct net_pkt *pkt)
 {
@@ -29,11 +29,136 @@ static K_MUTEX_DEFINE(settings_lock);
 
 void settings_store_init(void);
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+#define HANDLER_INDEX_SIZE CONFIG_SETTINGS_HANDLER_INDEX_SIZE
+/* Keep the table at most 3/4 full, so that probe sequences stay short. */
+#define HANDLER_INDEX_MAX_USED ((HANDLER_INDEX_SIZE * 3) / 4)
+
+#define FNV1A_OFFSET 2166136261U
+#define FNV1A_PRIME 16777619U
+
+/* Open addressing hash table of handler names. Entries are never removed as
+ * handlers cannot be unregistered.
+ */
+static struct {
+	uint32_t hash;
+	struct settings_handler_static *handler;
+} handler_index[HANDLER_INDEX_SIZE];
+
+static uint16_t handler_index_used;
+static bool handler_index_ready;
+
+/* FNV-1a is used as its value for a name prefix is the intermediate state of
+ * hashing the whole name, so all prefixes of a name are hashed in one pass.
+ */
+static inline uint32_t handler_index_hash(uint32_t hash, char c)
+{
+	return (hash ^ (uint8_t)c) * FNV1A_PRIME;
+}
+
+static void handler_index_add(struct settings_handler_static *handler)
+{
+	uint32_t hash = FNV1A_OFFSET;
+	uint32_t i;
+
+	if (!handler_index_ready) {
+		return;
+	}
+
+	if ((handler->name[0] == '\0') || (handler_index_used >= HANDLER_INDEX_MAX_USED)) {
+		LOG_WRN("Handler %s not indexed, using linear lookup", handler->name);
+		handler_index_ready = false;
+		return;
+	}
+
+	for (const char *c = handler->name; *c != '\0'; c++) {
+		hash = handler_index_hash(hash, *c);
+	}
+
+	for (i = hash % HANDLER_INDEX_SIZE; handler_index[i].handler != NULL;
+	     i = (i + 1) % HANDLER_INDEX_SIZE) {
+		if ((handler_index[i].hash == hash) &&
+		    (strcmp(handler_index[i].handler->name, handler->name) == 0)) {
+			/* The last handler with a given name is used, as in the linear search. */
+			handler_index[i].handler = handler;
+			return;
+		}
+	}
+
+	handler_index[i].hash = hash;
+	handler_index[i].handler = handler;
+	handler_index_used++;
+}
+
+static struct settings_handler_static *handler_index_find(uint32_t hash, const char *name,
+							   size_t len)
+{
+	for (uint32_t i = hash % HANDLER_INDEX_SIZE; handler_index[i].handler != NULL;
+	     i = (i + 1) % HANDLER_INDEX_SIZE) {
+		const char *h_name = handler_index[i].handler->name;
+
+		if ((handler_index[i].hash == hash) && (strncmp(h_name, name, len) == 0) &&
+		    (h_name[len] == '\0')) {
+			return handler_index[i].handler;
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the handler with the longest name matching a prefix of the name, ending at a
+ * separator or at the end of the name.
+ */
+static struct settings_handler_static *handler_index_lookup(const char *name,
+							     const char **next)
+{
+	struct settings_handler_static *bestmatch = NULL;
+	struct settings_handler_static *ch;
+	uint32_t hash = FNV1A_OFFSET;
+	const char *c = name;
+
+	while (true) {
+		if ((*c == '\0') || (*c == SETTINGS_NAME_END) || (*c == SETTINGS_NAME_SEPARATOR)) {
+			ch = (c != name) ? handler_index_find(hash, name, c - name) : NULL;
+			if (ch != NULL) {
+				bestmatch = ch;
+				if (next) {
+					*next = (*c == SETTINGS_NAME_SEPARATOR) ? c + 1 : NULL;
+				}
+			}
+
+			if (*c != SETTINGS_NAME_SEPARATOR) {
+				break;
+			}
+		}
+
+		hash = handler_index_hash(hash, *c);
+		c++;
+	}
+
+	return bestmatch;
+}
+
+static void handler_index_init(void)
+{
+	memset(handler_index, 0, sizeof(handler_index));
+	handler_index_used = 0;
+	handler_index_ready = true;
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		handler_index_add(ch);
+	}
+}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 void settings_init(void)
 {
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	handler_index_init();
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
 	settings_store_init();
 }
 
@@ -60,6 +185,9 @@ int settings_register_with_cprio(struct settings_handler *handler, int cprio)
 
 	handler->cprio = cprio;
 	sys_slist_append(&settings_handlers, &handler->node);
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	handler_index_add((struct settings_handler_static *)handler);
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
 
 end:
 	settings_lock_release();
@@ -154,6 +282,12 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		*next = NULL;
 	}
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	if (handler_index_ready) {
+		return handler_index_lookup(name, next);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
 			continue;
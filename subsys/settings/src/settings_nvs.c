@@ -30,12 +30,17 @@ struct settings_nvs_read_fn_arg {
 
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg);
+static ssize_t settings_nvs_load_one(struct settings_store *cs, const char *name,
+				     char *buf, size_t buf_len);
+static ssize_t settings_nvs_get_val_len(struct settings_store *cs, const char *name);
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
 static void *settings_nvs_storage_get(struct settings_store *cs);
 
 static struct settings_store_itf settings_nvs_itf = {
 	.csi_load = settings_nvs_load,
+	.csi_load_one = settings_nvs_load_one,
+	.csi_get_val_len = settings_nvs_get_val_len,
 	.csi_save = settings_nvs_save,
 	.csi_storage_get = settings_nvs_storage_get
 };
@@ -76,33 +81,88 @@ int settings_nvs_dst(struct settings_nvs *cf)
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 #define SETTINGS_NVS_CACHE_OVFL(cf) ((cf)->cache_total > ARRAY_SIZE((cf)->cache))
 
-static void settings_nvs_cache_add(struct settings_nvs *cf, const char *name,
+/* The cache is an open addressing hash table indexed by the name hash. Free
+ * entries have name_id 0 and end the probe sequence, entries of deleted
+ * settings have name_id NVS_NAMECNT_ID and are skipped.
+ */
+#define SETTINGS_NVS_CACHE_FREE_ID 0
+#define SETTINGS_NVS_CACHE_DELETED_ID NVS_NAMECNT_ID
+
+/* Returns false if the cache is full. */
+static bool settings_nvs_cache_add(struct settings_nvs *cf, const char *name,
 				   uint16_t name_id)
 {
 	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	int free_idx = -1;
+	int idx = name_hash % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
+		if ((cf->cache[idx].name_id == name_id) &&
+		    (cf->cache[idx].name_hash == name_hash)) {
+			/* Already cached */
+			return true;
+		}
+
+		if ((free_idx < 0) && (cf->cache[idx].name_id == SETTINGS_NVS_CACHE_DELETED_ID)) {
+			free_idx = idx;
+		}
 
-	cf->cache[cf->cache_next].name_hash = name_hash;
-	cf->cache[cf->cache_next++].name_id = name_id;
+		if (cf->cache[idx].name_id == SETTINGS_NVS_CACHE_FREE_ID) {
+			if (free_idx < 0) {
+				free_idx = idx;
+			}
+			break;
+		}
+
+		idx = (idx + 1) % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+	}
+
+	if (free_idx < 0) {
+		return false;
+	}
 
-	cf->cache_next %= CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+	cf->cache[free_idx].name_hash = name_hash;
+	cf->cache[free_idx].name_id = name_id;
+
+	return true;
+}
+
+static void settings_nvs_cache_del(struct settings_nvs *cf, uint16_t name_id)
+{
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
+		if (cf->cache[i].name_id == name_id) {
+			cf->cache[i].name_id = SETTINGS_NVS_CACHE_DELETED_ID;
+			/* Once overflowed, the cache may miss stored names until the next load. */
+			if (cf->loaded && !SETTINGS_NVS_CACHE_OVFL(cf) && (cf->cache_total > 0)) {
+				cf->cache_total--;
+			}
+			return;
+		}
+	}
 }
 
 static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *name,
 					 char *rdname, size_t len)
 {
 	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	int idx = name_hash % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
 	int rc;
 
-	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
-		if (cf->cache[i].name_hash != name_hash) {
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+	     i++, idx = (idx + 1) % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE) {
+		if (cf->cache[idx].name_id == SETTINGS_NVS_CACHE_FREE_ID) {
+			break;
+		}
+
+		if (cf->cache[idx].name_hash != name_hash) {
 			continue;
 		}
 
-		if (cf->cache[i].name_id <= NVS_NAMECNT_ID) {
+		if (cf->cache[idx].name_id <= NVS_NAMECNT_ID) {
 			continue;
 		}
 
-		rc = nvs_read(&cf->cf_nvs, cf->cache[i].name_id, rdname, len);
+		rc = nvs_read(&cf->cf_nvs, cf->cache[idx].name_id, rdname, len);
 		if (rc < 0) {
 			continue;
 		}
@@ -113,13 +173,117 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 			continue;
 		}
 
-		return cf->cache[i].name_id;
+		return cf->cache[idx].name_id;
 	}
 
 	return NVS_NAMECNT_ID;
 }
+
+/* Fill the cache with all stored names, without loading the settings. */
+static void settings_nvs_cache_fill(struct settings_nvs *cf)
+{
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	uint16_t cached = 0;
+	bool full = false;
+	ssize_t rc;
+
+	for (uint16_t name_id = cf->last_name_id; name_id > NVS_NAMECNT_ID; name_id--) {
+		rc = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+		if (rc <= 0) {
+			continue;
+		}
+
+		name[rc] = '\0';
+		if (!settings_nvs_cache_add(cf, name, name_id)) {
+			full = true;
+		}
+		cached++;
+	}
+
+	cf->cache_total = full ? MAX(cached, ARRAY_SIZE(cf->cache) + 1) : cached;
+	cf->loaded = true;
+}
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
+/* Find the NVS ID of the name entry of a setting. Returns NVS_NAMECNT_ID if
+ * the setting is not stored.
+ */
+static uint16_t settings_nvs_name_id_find(struct settings_nvs *cf, const char *name)
+{
+	char rdname[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	uint16_t name_id;
+	ssize_t rc;
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	if (!cf->loaded) {
+		settings_nvs_cache_fill(cf);
+	}
+
+	name_id = settings_nvs_cache_match(cf, name, rdname, sizeof(rdname));
+	if ((name_id != NVS_NAMECNT_ID) || !SETTINGS_NVS_CACHE_OVFL(cf)) {
+		return name_id;
+	}
+#endif
+
+	for (name_id = cf->last_name_id; name_id > NVS_NAMECNT_ID; name_id--) {
+		rc = nvs_read(&cf->cf_nvs, name_id, &rdname, sizeof(rdname));
+		if (rc < 0) {
+			continue;
+		}
+
+		rdname[rc] = '\0';
+
+		if (strcmp(name, rdname) == 0) {
+			return name_id;
+		}
+	}
+
+	return NVS_NAMECNT_ID;
+}
+
+static ssize_t settings_nvs_load_one(struct settings_store *cs, const char *name,
+				     char *buf, size_t buf_len)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	uint16_t name_id;
+	ssize_t rc;
+
+	if (!name || !buf) {
+		return -EINVAL;
+	}
+
+	name_id = settings_nvs_name_id_find(cf, name);
+	if (name_id == NVS_NAMECNT_ID) {
+		return 0;
+	}
+
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, buf, buf_len);
+
+	return (rc == -ENOENT) ? 0 : rc;
+}
+
+static ssize_t settings_nvs_get_val_len(struct settings_store *cs, const char *name)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	uint16_t name_id;
+	ssize_t rc;
+	char buf;
+
+	if (!name) {
+		return -EINVAL;
+	}
+
+	name_id = settings_nvs_name_id_find(cf, name);
+	if (name_id == NVS_NAMECNT_ID) {
+		return 0;
+	}
+
+	/* nvs_read returns the length of the entry, even if it is longer than buf */
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, &buf, sizeof(buf));
+
+	return (rc == -ENOENT) ? 0 : rc;
+}
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
@@ -133,6 +297,7 @@ static int settings_nvs_load(struct settings_store *cs,
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	uint16_t cached = 0;
+	bool full = false;
 
 	cf->loaded = false;
 #endif
@@ -145,7 +310,7 @@ static int settings_nvs_load(struct settings_store *cs,
 		if (name_id == NVS_NAMECNT_ID) {
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 			cf->loaded = true;
-			cf->cache_total = cached;
+			cf->cache_total = full ? MAX(cached, ARRAY_SIZE(cf->cache) + 1) : cached;
 #endif
 			break;
 		}
@@ -181,6 +346,9 @@ static int settings_nvs_load(struct settings_store *cs,
 			 */
 			nvs_delete(&cf->cf_nvs, name_id);
 			nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+			settings_nvs_cache_del(cf, name_id);
+#endif
 
 			if (name_id == cf->last_name_id) {
 				cf->last_name_id--;
@@ -197,7 +365,9 @@ static int settings_nvs_load(struct settings_store *cs,
 		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
-		settings_nvs_cache_add(cf, name, name_id);
+		if (!settings_nvs_cache_add(cf, name, name_id)) {
+			full = true;
+		}
 		cached++;
 #endif
 
@@ -231,6 +401,10 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	bool name_in_cache = false;
 
+	if (!cf->loaded) {
+		settings_nvs_cache_fill(cf);
+	}
+
 	name_id = settings_nvs_cache_match(cf, name, rdname, sizeof(rdname));
 	if (name_id != NVS_NAMECNT_ID) {
 		write_name_id = name_id;
@@ -297,6 +471,10 @@ found:
 			return rc;
 		}
 
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+		settings_nvs_cache_del(cf, name_id);
+#endif
+
 		if (name_id == cf->last_name_id) {
 			cf->last_name_id--;
 			rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
@@ -344,9 +522,10 @@ found:
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	if (!name_in_cache) {
-		settings_nvs_cache_add(cf, name, write_name_id);
+		bool added = settings_nvs_cache_add(cf, name, write_name_id);
+
 		if (cf->loaded && !SETTINGS_NVS_CACHE_OVFL(cf)) {
-			cf->cache_total++;
+			cf->cache_total = added ? cf->cache_total + 1 : ARRAY_SIZE(cf->cache) + 1;
 		}
 	}
 #endif
@@ -378,6 +557,12 @@ int settings_nvs_backend_init(struct settings_nvs *cf)
 		cf->last_name_id = last_name_id;
 	}
 
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	memset(cf->cache, 0, sizeof(cf->cache));
+	cf->cache_total = 0;
+	cf->loaded = false;
+#endif
+
 	LOG_DBG("Initialized");
 	return 0;
 }
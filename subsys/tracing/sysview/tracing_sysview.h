@@ -564,6 +564,18 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)                                         \
 	SEGGER_SYSVIEW_RecordEndCall(TID_MSGQ_GET)
 
+#define sys_port_trace_k_msgq_put_batch_enter(msgq, timeout)
+
+#define sys_port_trace_k_msgq_put_batch_blocking(msgq, timeout)
+
+#define sys_port_trace_k_msgq_put_batch_exit(msgq, timeout, ret)
+
+#define sys_port_trace_k_msgq_get_batch_enter(msgq, timeout)
+
+#define sys_port_trace_k_msgq_get_batch_blocking(msgq, timeout)
+
+#define sys_port_trace_k_msgq_get_batch_exit(msgq, timeout, ret)
+
 #define sys_port_trace_k_msgq_peek(msgq, ret)                                                      \
 	SEGGER_SYSVIEW_RecordU32(TID_MSGQ_PEEK, (uint32_t)(uintptr_t)msgq)
 
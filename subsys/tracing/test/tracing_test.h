@@ -326,6 +326,12 @@
 	sys_trace_k_msgq_get_blocking(msgq, data, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)                                         \
 	sys_trace_k_msgq_get_exit(msgq, data, timeout, ret)
+#define sys_port_trace_k_msgq_put_batch_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_put_batch_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_put_batch_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_get_batch_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_get_batch_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_get_batch_exit(msgq, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret) sys_trace_k_msgq_peek(msgq, data, ret)
 #define sys_port_trace_k_msgq_purge(msgq) sys_trace_k_msgq_purge(msgq)
 
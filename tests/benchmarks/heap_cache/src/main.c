@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Compare allocation throughput and fragmentation of a k_heap, which may
+ * use per-CPU small block caches, and of a spinlock protected sys_heap.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/tc_util.h>
+
+#define HEAP_SIZE CONFIG_BENCHMARK_HEAP_SIZE
+#define NUM_OPS   CONFIG_BENCHMARK_NUM_OPS
+
+struct locked_heap {
+	struct sys_heap heap;
+	struct k_spinlock lock;
+};
+
+static uint8_t __aligned(8) k_heap_mem[HEAP_SIZE];
+static uint8_t __aligned(8) sys_heap_mem[HEAP_SIZE];
+static uint8_t __aligned(8) scratch_mem[HEAP_SIZE / 2];
+
+static struct k_heap test_k_heap;
+static struct locked_heap test_sys_heap;
+
+static bool small_sizes;
+
+/* Maps the sizes chosen by the stress rig for the small object workload */
+static size_t workload_size(size_t bytes)
+{
+	return small_sizes ? 1 + (bytes % CONFIG_BENCHMARK_SMALL_SIZE) : bytes;
+}
+
+static void *k_heap_alloc_fn(void *arg, size_t bytes)
+{
+	return k_heap_alloc(arg, workload_size(bytes), K_NO_WAIT);
+}
+
+static void k_heap_free_fn(void *arg, void *p)
+{
+	k_heap_free(arg, p);
+}
+
+static void *sys_heap_alloc_fn(void *arg, size_t bytes)
+{
+	struct locked_heap *lh = arg;
+	k_spinlock_key_t key = k_spin_lock(&lh->lock);
+	void *ret = sys_heap_alloc(&lh->heap, workload_size(bytes));
+
+	k_spin_unlock(&lh->lock, key);
+
+	return ret;
+}
+
+static void sys_heap_free_fn(void *arg, void *p)
+{
+	struct locked_heap *lh = arg;
+	k_spinlock_key_t key = k_spin_lock(&lh->lock);
+
+	sys_heap_free(&lh->heap, p);
+	k_spin_unlock(&lh->lock, key);
+}
+
+static void report(const char *tag, const char *str,
+		   const struct z_heap_stress_result *result)
+{
+	uint64_t ops = (uint64_t)result->total_allocs + result->total_frees;
+	uint64_t ops_per_sec = 0;
+	uint32_t failed_pct = 0;
+	uint32_t used_pct;
+
+	if (result->total_cycles != 0) {
+		ops_per_sec = (ops * sys_clock_hw_cycles_per_sec()) /
+			      result->total_cycles;
+	}
+	if (result->total_allocs != 0) {
+		failed_pct = (100U * (result->total_allocs - result->successful_allocs)) /
+			     result->total_allocs;
+	}
+	used_pct = (uint32_t)((100U * result->accumulated_in_use_bytes) /
+			      ((uint64_t)NUM_OPS * HEAP_SIZE));
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: heap_cache.%s - %s :%llu ops/s, %u%% failed, %u%% used\n",
+	       tag, str, ops_per_sec, failed_pct, used_pct);
+#else
+	printk("------------------------------------\n");
+	printk("%s (%s)\n", str, tag);
+	printk("    Operations/s : %llu (%u allocs, %u frees, %llu cycles)\n",
+	       ops_per_sec, result->total_allocs, result->total_frees,
+	       result->total_cycles);
+	printk("    Failed allocs: %u%%\n", failed_pct);
+	printk("    Average use  : %u%% of %u bytes\n", used_pct, HEAP_SIZE);
+#endif
+}
+
+static void report_cache_stats(void)
+{
+#ifdef CONFIG_K_HEAP_CACHE
+	struct k_heap_cache_stats stats;
+
+	(void)k_heap_cache_stats_get(&test_k_heap, &stats);
+
+	printk("    Cache: %u hits, %u misses, %u refills, %u drains, %zu bytes cached\n",
+	       stats.hits, stats.misses, stats.refills, stats.drains,
+	       stats.cached_bytes);
+#endif
+}
+
+static void run_workload(bool small, const char *tag, const char *str)
+{
+	struct z_heap_stress_result result;
+	char buf[64];
+
+	small_sizes = small;
+
+	k_heap_init(&test_k_heap, k_heap_mem, sizeof(k_heap_mem));
+	sys_heap_stress(k_heap_alloc_fn, k_heap_free_fn, &test_k_heap,
+			HEAP_SIZE, NUM_OPS, scratch_mem, sizeof(scratch_mem),
+			CONFIG_BENCHMARK_TARGET_PERCENT, &result);
+	snprintk(buf, sizeof(buf), "k_heap.%s", tag);
+	report(buf, str, &result);
+	report_cache_stats();
+
+	sys_heap_init(&test_sys_heap.heap, sys_heap_mem, sizeof(sys_heap_mem));
+	sys_heap_stress(sys_heap_alloc_fn, sys_heap_free_fn, &test_sys_heap,
+			HEAP_SIZE, NUM_OPS, scratch_mem, sizeof(scratch_mem),
+			CONFIG_BENCHMARK_TARGET_PERCENT, &result);
+	snprintk(buf, sizeof(buf), "sys_heap.%s", tag);
+	report(buf, str, &result);
+}
+
+int main(void)
+{
+	printk("Heap allocation measurements, k_heap caches %s\n",
+	       IS_ENABLED(CONFIG_K_HEAP_CACHE) ? "enabled" : "disabled");
+
+	run_workload(false, "mixed", "Mixed size allocations");
+	run_workload(true, "small", "Small object allocations");
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
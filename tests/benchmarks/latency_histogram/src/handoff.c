@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure the latency of waking a thread blocked on a kernel object
+ *
+ * A waking thread takes a timestamp right before handing a kernel object
+ * over to a higher priority thread blocked on it, which takes the second
+ * timestamp as soon as its blocking call returns. Each sample thus covers
+ * the kernel call, the wakeup and the context switch.
+ *
+ * With CONFIG_BENCHMARK_CROSS_CPU the two threads are pinned to different
+ * CPUs, so that the wakeup goes through an IPI.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq_offload.h>
+#include "hist.h"
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* The waiting thread preempts the waking one on a single CPU */
+#define WAITER_PRIO K_PRIO_PREEMPT(5)
+#define WAKER_PRIO  K_PRIO_PREEMPT(10)
+
+struct handoff {
+	const char *metric;
+	const char *summary;
+	/* Run by the waking thread before letting the waiting thread block */
+	void (*prepare)(void);
+	/* Take the start timestamp and wake the waiting thread */
+	void (*wake)(void);
+	/* Block until woken */
+	void (*wait)(void);
+	/* Run by the waiting thread after taking the end timestamp */
+	void (*done)(void);
+};
+
+static K_THREAD_STACK_DEFINE(waker_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(waiter_stack, STACK_SIZE);
+static struct k_thread waker_thread;
+static struct k_thread waiter_thread;
+
+/* Lets the waiting thread go and block on the measured object */
+static K_SEM_DEFINE(go_sem, 0, 1);
+/* Tells the waking thread that the sample has been recorded */
+static K_SEM_DEFINE(done_sem, 0, 1);
+
+static timing_t start;
+
+static K_SEM_DEFINE(sem, 0, 1);
+K_MSGQ_DEFINE(bench_msgq, sizeof(uint32_t), 1, 4);
+K_PIPE_DEFINE(bench_pipe, 16, 4);
+static K_EVENT_DEFINE(event);
+static K_MUTEX_DEFINE(mutex);
+static K_SEM_DEFINE(isr_sem, 0, 1);
+
+static void sem_wake(void)
+{
+	start = timing_counter_get();
+	k_sem_give(&sem);
+}
+
+static void sem_wait(void)
+{
+	(void)k_sem_take(&sem, K_FOREVER);
+}
+
+static void msgq_wake(void)
+{
+	uint32_t msg = 0;
+
+	start = timing_counter_get();
+	(void)k_msgq_put(&bench_msgq, &msg, K_NO_WAIT);
+}
+
+static void msgq_wait(void)
+{
+	uint32_t msg;
+
+	(void)k_msgq_get(&bench_msgq, &msg, K_FOREVER);
+}
+
+static void pipe_wake(void)
+{
+	uint32_t data = 0;
+
+	start = timing_counter_get();
+	(void)k_pipe_write(&bench_pipe, (uint8_t *)&data, sizeof(data), K_NO_WAIT);
+}
+
+static void pipe_wait(void)
+{
+	uint32_t data;
+
+	(void)k_pipe_read(&bench_pipe, (uint8_t *)&data, sizeof(data), K_FOREVER);
+}
+
+static void event_wake(void)
+{
+	start = timing_counter_get();
+	(void)k_event_post(&event, BIT(0));
+}
+
+static void event_wait(void)
+{
+	(void)k_event_wait_safe(&event, BIT(0), false, K_FOREVER);
+}
+
+static void mutex_prepare(void)
+{
+	(void)k_mutex_lock(&mutex, K_FOREVER);
+}
+
+static void mutex_wake(void)
+{
+	start = timing_counter_get();
+	(void)k_mutex_unlock(&mutex);
+}
+
+static void mutex_wait(void)
+{
+	(void)k_mutex_lock(&mutex, K_FOREVER);
+}
+
+static void mutex_done(void)
+{
+	(void)k_mutex_unlock(&mutex);
+}
+
+static void isr_give(const void *arg)
+{
+	start = timing_counter_get();
+	k_sem_give((struct k_sem *)arg);
+}
+
+static void irq_wake(void)
+{
+	irq_offload(isr_give, &isr_sem);
+}
+
+static void irq_wait(void)
+{
+	(void)k_sem_take(&isr_sem, K_FOREVER);
+}
+
+static const struct handoff handoffs[] = {
+	{ "sem.give_wake", "Semaphore give to waiting thread",
+	  NULL, sem_wake, sem_wait, NULL },
+	{ "msgq.put_wake", "Message queue put to waiting thread",
+	  NULL, msgq_wake, msgq_wait, NULL },
+	{ "pipe.write_wake", "Pipe write to waiting thread",
+	  NULL, pipe_wake, pipe_wait, NULL },
+	{ "event.post_wake", "Event post to waiting thread",
+	  NULL, event_wake, event_wait, NULL },
+	{ "mutex.unlock_wake", "Mutex handoff to waiting thread",
+	  mutex_prepare, mutex_wake, mutex_wait, mutex_done },
+	{ "isr.give_wake", "ISR semaphore give to waiting thread",
+	  NULL, irq_wake, irq_wait, NULL },
+};
+
+static void waker_entry(void *p1, void *p2, void *p3)
+{
+	const struct handoff *h = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < NUM_SAMPLES; i++) {
+		if (h->prepare != NULL) {
+			h->prepare();
+		}
+
+		k_sem_give(&go_sem);
+#ifdef CONFIG_BENCHMARK_CROSS_CPU
+		k_busy_wait(CONFIG_BENCHMARK_CROSS_CPU_SETTLE_US);
+#endif
+		h->wake();
+
+		(void)k_sem_take(&done_sem, K_FOREVER);
+	}
+}
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	const struct handoff *h = p1;
+	timing_t end;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < NUM_SAMPLES; i++) {
+		(void)k_sem_take(&go_sem, K_FOREVER);
+
+		h->wait();
+		end = timing_counter_get();
+
+		(void)hist_add_timing(&start, &end);
+
+		if (h->done != NULL) {
+			h->done();
+		}
+
+		k_sem_give(&done_sem);
+	}
+}
+
+static void run(const struct handoff *h)
+{
+	hist_reset();
+	k_sem_reset(&go_sem);
+	k_sem_reset(&done_sem);
+
+	k_thread_create(&waiter_thread, waiter_stack, STACK_SIZE, waiter_entry,
+			(void *)h, NULL, NULL, WAITER_PRIO, 0, K_FOREVER);
+	k_thread_create(&waker_thread, waker_stack, STACK_SIZE, waker_entry,
+			(void *)h, NULL, NULL, WAKER_PRIO, 0, K_FOREVER);
+
+	start_on_cpu(&waiter_thread, 1);
+	start_on_cpu(&waker_thread, 0);
+
+	k_thread_join(&waker_thread, K_FOREVER);
+	k_thread_join(&waiter_thread, K_FOREVER);
+
+	hist_report(h->metric, h->summary);
+}
+
+void handoff_latency(void)
+{
+	for (unsigned int i = 0; i < ARRAY_SIZE(handoffs); i++) {
+		run(&handoffs[i]);
+	}
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Gather latency samples and report their distribution
+ *
+ * Samples are kept individually and sorted once a measurement is complete,
+ * so percentiles are exact. The histogram printed alongside uses power of
+ * two buckets, which keeps rare long latencies visible next to the bulk of
+ * the samples.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include "hist.h"
+
+#define BAR_WIDTH 40
+
+static uint32_t samples[NUM_SAMPLES];
+static uint32_t num_samples;
+
+void hist_reset(void)
+{
+	num_samples = 0;
+}
+
+bool hist_add_ns(uint32_t ns)
+{
+	if (num_samples < NUM_SAMPLES) {
+		samples[num_samples++] = ns;
+	}
+
+	return num_samples == NUM_SAMPLES;
+}
+
+bool hist_add_timing(timing_t *start, timing_t *end)
+{
+	uint64_t ns = timing_cycles_to_ns(timing_cycles_get(start, end));
+
+	return hist_add_ns((uint32_t)MIN(ns, UINT32_MAX));
+}
+
+static int cmp_samples(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* Sample below which the given thousandths of the samples lie */
+static uint32_t permille(uint32_t pm)
+{
+	return samples[((uint64_t)(num_samples - 1) * pm) / 1000];
+}
+
+#ifndef CONFIG_BENCHMARK_RECORDING
+static void print_buckets(void)
+{
+	uint32_t counts[32] = {0};
+	uint32_t max_count = 0;
+	int first = 31;
+	int last = 0;
+
+	for (uint32_t i = 0; i < num_samples; i++) {
+		int b = (samples[i] == 0) ? 0 : 31 - __builtin_clz(samples[i]);
+
+		counts[b]++;
+		first = MIN(first, b);
+		last = MAX(last, b);
+	}
+
+	for (int b = first; b <= last; b++) {
+		max_count = MAX(max_count, counts[b]);
+	}
+
+	for (int b = first; b <= last; b++) {
+		/* At least one mark for any non empty bucket */
+		uint32_t width = DIV_ROUND_UP(counts[b] * (uint64_t)BAR_WIDTH, max_count);
+		char bar[BAR_WIDTH + 1];
+
+		memset(bar, '#', width);
+		bar[width] = '\0';
+
+		printk("    [%10u, %10llu) ns : %8u %s\n", (b == 0) ? 0U : (uint32_t)BIT(b),
+		       BIT64(b + 1), counts[b], bar);
+	}
+}
+#endif
+
+void hist_report(const char *metric, const char *summary)
+{
+	if (num_samples == 0) {
+		printk("%s: no samples\n", summary);
+		return;
+	}
+
+	qsort(samples, num_samples, sizeof(samples[0]), cmp_samples);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s :min %u ns, p50 %u ns, p99 %u ns, p99.9 %u ns, max %u ns\n",
+	       metric, summary, samples[0], permille(500), permille(990), permille(999),
+	       samples[num_samples - 1]);
+#else
+	printk("------------------------------------\n");
+	printk("%s (%s), %u samples\n", summary, metric, num_samples);
+	printk("    min %u ns, p50 %u ns, p99 %u ns, p99.9 %u ns, max %u ns\n",
+	       samples[0], permille(500), permille(990), permille(999),
+	       samples[num_samples - 1]);
+	print_buckets();
+#endif
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LATENCY_HISTOGRAM_HIST_H_
+#define LATENCY_HISTOGRAM_HIST_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+
+#define NUM_SAMPLES CONFIG_BENCHMARK_NUM_SAMPLES
+
+/**
+ * @brief Discard the samples of the previous measurement
+ */
+void hist_reset(void);
+
+/**
+ * @brief Add a sample in nanoseconds
+ *
+ * Samples beyond NUM_SAMPLES are dropped. Safe to call from an ISR, but not
+ * from several contexts at once.
+ *
+ * @return true when NUM_SAMPLES samples have been gathered
+ */
+bool hist_add_ns(uint32_t ns);
+
+/**
+ * @brief Add a sample measured with the timing functions
+ *
+ * @return true when NUM_SAMPLES samples have been gathered
+ */
+bool hist_add_timing(timing_t *start, timing_t *end);
+
+/**
+ * @brief Print the distribution of the gathered samples
+ *
+ * @param metric Short name of the measurement, used in records
+ * @param summary Description of the measurement
+ */
+void hist_report(const char *metric, const char *summary);
+
+/**
+ * @brief Start a thread created with a K_FOREVER delay
+ *
+ * With CONFIG_BENCHMARK_CROSS_CPU the thread is pinned to @p cpu first,
+ * otherwise it may run on any CPU.
+ */
+void start_on_cpu(struct k_thread *thread, int cpu);
+
+/* Individual measurements, each reports one or more histograms */
+void thread_switch_latency(void);
+void handoff_latency(void);
+void timer_jitter(void);
+
+#endif /* LATENCY_HISTOGRAM_HIST_H_ */
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure the distribution of kernel latencies
+ *
+ * Unlike the latency_measure benchmark, which reports averages, every
+ * sample is kept so that the tail of the distribution can be reported.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include "hist.h"
+
+void start_on_cpu(struct k_thread *thread, int cpu)
+{
+#ifdef CONFIG_BENCHMARK_CROSS_CPU
+	(void)k_thread_cpu_pin(thread, cpu);
+#else
+	ARG_UNUSED(cpu);
+#endif
+	k_thread_start(thread);
+}
+
+int main(void)
+{
+	timing_init();
+
+	printk("Latency distributions, %u samples each, %s\n", NUM_SAMPLES,
+	       IS_ENABLED(CONFIG_BENCHMARK_CROSS_CPU) ? "waking threads on another CPU"
+						      : "single CPU");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	thread_switch_latency();
+	handoff_latency();
+	timer_jitter();
+
+	timing_stop();
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure the latency of switching threads with k_yield()
+ *
+ * Two threads of the same priority yield to each other. Each sample is the
+ * time from one thread calling k_yield() to the other one returning from its
+ * own k_yield() call.
+ */
+
+#include <zephyr/kernel.h>
+#include "hist.h"
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(yield_stacks, 2, STACK_SIZE);
+static struct k_thread yield_threads[2];
+
+static timing_t switch_start;
+static volatile bool full;
+
+static void yield_entry(void *p1, void *p2, void *p3)
+{
+	timing_t end;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!full) {
+		switch_start = timing_counter_get();
+		k_yield();
+		end = timing_counter_get();
+
+		/* Once full, the other thread may have exited instead */
+		if (!full) {
+			full = hist_add_timing(&switch_start, &end);
+		}
+	}
+}
+
+static void run(int prio, const char *metric, const char *summary)
+{
+	hist_reset();
+	full = false;
+
+	for (int i = 0; i < ARRAY_SIZE(yield_threads); i++) {
+		k_thread_create(&yield_threads[i], yield_stacks[i], STACK_SIZE,
+				yield_entry, NULL, NULL, NULL, prio, 0, K_FOREVER);
+	}
+
+	/* Both threads must share a CPU to switch between each other */
+	for (int i = 0; i < ARRAY_SIZE(yield_threads); i++) {
+		start_on_cpu(&yield_threads[i], 0);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(yield_threads); i++) {
+		k_thread_join(&yield_threads[i], K_FOREVER);
+	}
+
+	hist_report(metric, summary);
+}
+
+void thread_switch_latency(void)
+{
+	run(K_PRIO_PREEMPT(5), "thread.yield.preemptive",
+	    "Context switch between preemptive threads using k_yield");
+	run(K_PRIO_COOP(5), "thread.yield.cooperative",
+	    "Context switch between cooperative threads using k_yield");
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure the jitter of a periodic timer
+ *
+ * Each sample is the difference between the time elapsed between two
+ * successive expiries of a periodic k_timer, taken with the system clock
+ * cycle counter in the expiry function, and the timer period.
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include "hist.h"
+
+static struct k_timer jitter_timer;
+static K_SEM_DEFINE(jitter_done, 0, 1);
+
+static uint32_t period_cycles;
+static uint32_t last_cycles;
+static bool started;
+
+static void jitter_expiry(struct k_timer *timer)
+{
+	uint32_t now = k_cycle_get_32();
+
+	if (started) {
+		int32_t deviation = (int32_t)((now - last_cycles) - period_cycles);
+
+		if (hist_add_ns((uint32_t)k_cyc_to_ns_floor64(abs(deviation)))) {
+			k_timer_stop(timer);
+			k_sem_give(&jitter_done);
+		}
+	}
+
+	started = true;
+	last_cycles = now;
+}
+
+void timer_jitter(void)
+{
+	/* The period the kernel rounds CONFIG_BENCHMARK_TIMER_PERIOD_US to */
+	k_timeout_t period = K_USEC(CONFIG_BENCHMARK_TIMER_PERIOD_US);
+
+	period_cycles = (uint32_t)k_ticks_to_cyc_floor64(
+		k_us_to_ticks_ceil64(CONFIG_BENCHMARK_TIMER_PERIOD_US));
+
+	hist_reset();
+	started = false;
+	k_sem_reset(&jitter_done);
+
+	k_timer_init(&jitter_timer, jitter_expiry, NULL);
+	k_timer_start(&jitter_timer, period, period);
+
+	(void)k_sem_take(&jitter_done, K_FOREVER);
+
+	hist_report("timer.jitter", "Periodic timer expiry jitter");
+}
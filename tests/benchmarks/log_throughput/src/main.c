@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure deferred logging throughput with one thread per CPU logging
+ * concurrently.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/tc_util.h>
+
+LOG_MODULE_REGISTER(bench, LOG_LEVEL_INF);
+
+#define NUM_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define NUM_MSGS    CONFIG_BENCHMARK_NUM_MSGS
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Give the log processing thread a chance to run every BURST messages */
+#define BURST 16
+
+static atomic_t processed_cnt;
+static atomic_t dropped_cnt;
+
+static void process(struct log_backend const *const backend,
+		    union log_msg_generic *msg)
+{
+	ARG_UNUSED(backend);
+	ARG_UNUSED(msg);
+
+	atomic_inc(&processed_cnt);
+}
+
+static void dropped(struct log_backend const *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	atomic_add(&dropped_cnt, cnt);
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api bench_backend_api = {
+	.process = process,
+	.dropped = dropped,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(bench_backend, bench_backend_api, true);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+static uint64_t thread_cycles[NUM_THREADS];
+
+static void bench_thread(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	uint64_t cycles = 0;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < NUM_MSGS; i++) {
+		uint32_t start = k_cycle_get_32();
+
+		LOG_INF("thread %d message %d", id, i);
+		cycles += k_cycle_get_32() - start;
+
+		if ((i % BURST) == (BURST - 1)) {
+			k_yield();
+		}
+	}
+
+	thread_cycles[id] = cycles;
+}
+
+static void report(const char *tag, const char *str)
+{
+	uint64_t msgs_per_sec = 0;
+	uint64_t total_cycles = 0;
+	uint32_t cycles_per_msg;
+	uint32_t max_usage = 0;
+	uint32_t size = 0;
+	uint32_t usage;
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		if (thread_cycles[i] != 0) {
+			msgs_per_sec += ((uint64_t)NUM_MSGS * sys_clock_hw_cycles_per_sec()) /
+					thread_cycles[i];
+		}
+		total_cycles += thread_cycles[i];
+	}
+
+	cycles_per_msg = (uint32_t)(total_cycles / ((uint64_t)NUM_MSGS * NUM_THREADS));
+
+	(void)log_mem_get_usage(&size, &usage);
+	(void)log_mem_get_max_usage(&max_usage);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: log_throughput.%s - %s :%llu msgs/s, %u cycles/msg, %ld dropped\n",
+	       tag, str, msgs_per_sec, cycles_per_msg, atomic_get(&dropped_cnt));
+#else
+	printk("------------------------------------\n");
+	printk("%s (%s)\n", str, tag);
+	printk("    Messages/s   : %llu (%d threads)\n", msgs_per_sec, NUM_THREADS);
+	printk("    Cycles/msg   : %u\n", cycles_per_msg);
+	printk("    Processed    : %ld\n", atomic_get(&processed_cnt));
+	printk("    Dropped      : %ld\n", atomic_get(&dropped_cnt));
+	printk("    Peak usage   : %u of %u bytes\n", max_usage, size);
+#endif
+}
+
+int main(void)
+{
+	printk("Logging throughput measurements, per-CPU buffers %s\n",
+	       IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS) ? "enabled" : "disabled");
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], K_THREAD_STACK_SIZEOF(stacks[i]),
+				bench_thread, INT_TO_POINTER(i), NULL, NULL,
+				K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&threads[i], i);
+#endif
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	log_flush();
+
+	report("log_inf", "LOG_INF with two arguments");
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Compare the throughput of passing items through a lock-free MPMC queue
+ * and through a k_fifo with one to all CPUs producing and consuming.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/sys/mpmc_lockfree.h>
+
+#define NUM_ITEMS   CONFIG_BENCHMARK_NUM_ITEMS
+#define QUEUE_LEN   CONFIG_BENCHMARK_QUEUE_LEN
+#define MAX_PAIRS   CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* All threads share the same preemptible priority, lower than main() */
+#define THREAD_PRIO 5
+
+struct item {
+	void *fifo_reserved;
+	/* Set while the item is queued */
+	atomic_t busy;
+};
+
+struct queue_api {
+	const char *name;
+	void (*reset)(void);
+	bool (*put)(struct item *item);
+	struct item *(*get)(void);
+};
+
+static struct item items[MAX_PAIRS][QUEUE_LEN];
+
+MPMC_DEFINE(bench_mpmc, QUEUE_LEN);
+K_FIFO_DEFINE(bench_fifo);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_PAIRS * 2, STACK_SIZE);
+static struct k_thread threads[MAX_PAIRS * 2];
+
+static atomic_t consumed;
+
+static void mpmc_reset(void)
+{
+	mpmc_init(&bench_mpmc, NULL, 0);
+}
+
+static bool mpmc_put(struct item *item)
+{
+	return mpmc_push(&bench_mpmc, item) == 0;
+}
+
+static struct item *mpmc_get(void)
+{
+	return mpmc_pop(&bench_mpmc);
+}
+
+static void fifo_reset(void)
+{
+	k_fifo_init(&bench_fifo);
+}
+
+static bool fifo_put(struct item *item)
+{
+	k_fifo_put(&bench_fifo, item);
+
+	return true;
+}
+
+static struct item *fifo_get(void)
+{
+	return k_fifo_get(&bench_fifo, K_NO_WAIT);
+}
+
+static const struct queue_api queues[] = {
+	{ "k_fifo", fifo_reset, fifo_put, fifo_get },
+	{ "mpmc", mpmc_reset, mpmc_put, mpmc_get },
+};
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	const struct queue_api *api = p1;
+	struct item *pool = items[POINTER_TO_UINT(p2)];
+	uint32_t count = POINTER_TO_UINT(p3);
+
+	for (uint32_t i = 0; i < count; i++) {
+		struct item *item = &pool[i % QUEUE_LEN];
+
+		/* Wait for a consumer to be done with the item */
+		while (atomic_get(&item->busy) != 0) {
+			k_yield();
+		}
+
+		atomic_set(&item->busy, 1);
+		while (!api->put(item)) {
+			k_yield();
+		}
+	}
+}
+
+static void consumer_entry(void *p1, void *p2, void *p3)
+{
+	const struct queue_api *api = p1;
+	struct item *item;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&consumed) < NUM_ITEMS) {
+		item = api->get();
+		if (item == NULL) {
+			k_yield();
+			continue;
+		}
+
+		atomic_clear(&item->busy);
+		atomic_inc(&consumed);
+	}
+}
+
+static uint64_t run(const struct queue_api *api, unsigned int pairs)
+{
+	timing_t start;
+	timing_t finish;
+
+	api->reset();
+	atomic_clear(&consumed);
+	for (unsigned int i = 0; i < pairs; i++) {
+		for (unsigned int j = 0; j < QUEUE_LEN; j++) {
+			atomic_clear(&items[i][j].busy);
+		}
+	}
+
+	for (unsigned int i = 0; i < pairs; i++) {
+		uint32_t count = NUM_ITEMS / pairs;
+
+		if (i == 0) {
+			count += NUM_ITEMS % pairs;
+		}
+
+		k_thread_create(&threads[i * 2], stacks[i * 2], STACK_SIZE,
+				producer_entry, (void *)api, UINT_TO_POINTER(i),
+				UINT_TO_POINTER(count), THREAD_PRIO, 0, K_FOREVER);
+		k_thread_create(&threads[i * 2 + 1], stacks[i * 2 + 1], STACK_SIZE,
+				consumer_entry, (void *)api, NULL, NULL,
+				THREAD_PRIO, 0, K_FOREVER);
+	}
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < pairs * 2; i++) {
+		k_thread_start(&threads[i]);
+	}
+	for (unsigned int i = 0; i < pairs * 2; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(const struct queue_api *api, unsigned int pairs, uint64_t cycles)
+{
+	uint64_t ns = timing_cycles_to_ns(cycles);
+	uint64_t items_per_sec = (ns == 0) ? 0 : ((uint64_t)NUM_ITEMS * NSEC_PER_SEC) / ns;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: mpmc_lockfree.%s.%u - %u items, %u producers and consumers :%llu items/s\n",
+	       api->name, pairs, NUM_ITEMS, pairs, items_per_sec);
+#else
+	printk("------------------------------------\n");
+	printk("%s: %u items, %u producers and %u consumers\n", api->name, NUM_ITEMS,
+	       pairs, pairs);
+	printk("    Throughput : %llu items/s (%llu cycles, %llu nsec)\n",
+	       items_per_sec, cycles, ns);
+#endif
+}
+
+int main(void)
+{
+	unsigned int cpus = arch_num_cpus();
+
+	timing_init();
+
+	printk("MPMC queue throughput on %u CPUs\n", cpus);
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int pairs = 1; pairs <= cpus; pairs++) {
+		for (unsigned int i = 0; i < ARRAY_SIZE(queues); i++) {
+			report(&queues[i], pairs, run(&queues[i], pairs));
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Compare the message queue throughput of sending and receiving one
+ * message at a time and in batches.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/app_memory/app_memdomain.h>
+
+#define NUM_MSGS   CONFIG_BENCHMARK_NUM_MSGS
+#define QUEUE_LEN  CONFIG_BENCHMARK_QUEUE_LEN
+#define MAX_BATCH  64
+#define STACK_SIZE (1024 + MAX_BATCH * sizeof(struct msg) + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* Both threads share the same preemptible priority, lower than main() */
+#define THREAD_PRIO 5
+
+#ifdef CONFIG_BENCHMARK_USER_THREADS
+#define THREAD_OPTIONS K_USER
+K_APPMEM_PARTITION_DEFINE(bench_partition);
+#define BENCH_BMEM K_APP_BMEM(bench_partition)
+static struct k_mem_domain bench_domain;
+#else
+#define THREAD_OPTIONS 0
+#define BENCH_BMEM
+#endif
+
+struct msg {
+	uint32_t seq;
+	uint32_t payload[3];
+};
+
+static const uint32_t batch_sizes[] = {1, 4, 16, MAX_BATCH};
+
+K_MSGQ_DEFINE(bench_msgq, sizeof(struct msg), QUEUE_LEN, 4);
+
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+
+static struct k_thread producer_thread;
+static struct k_thread consumer_thread;
+
+BENCH_BMEM static uint32_t out_of_order;
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t batch = POINTER_TO_UINT(p1);
+	struct msg msgs[MAX_BATCH] = {0};
+	uint32_t seq = 0;
+	int ret;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (seq < NUM_MSGS) {
+		uint32_t n = MIN(batch, NUM_MSGS - seq);
+
+		for (uint32_t i = 0; i < n; i++) {
+			msgs[i].seq = seq + i;
+		}
+
+		if (batch == 1U) {
+			ret = k_msgq_put(&bench_msgq, &msgs[0], K_FOREVER);
+			ret = (ret == 0) ? 1 : ret;
+		} else {
+			ret = k_msgq_put_batch(&bench_msgq, msgs, n, K_FOREVER);
+		}
+
+		if (ret <= 0) {
+			return;
+		}
+		seq += ret;
+	}
+}
+
+static void consumer_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t batch = POINTER_TO_UINT(p1);
+	struct msg msgs[MAX_BATCH];
+	uint32_t seq = 0;
+	int ret;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (seq < NUM_MSGS) {
+		if (batch == 1U) {
+			ret = k_msgq_get(&bench_msgq, &msgs[0], K_FOREVER);
+			ret = (ret == 0) ? 1 : ret;
+		} else {
+			ret = k_msgq_get_batch(&bench_msgq, msgs, batch, K_FOREVER);
+		}
+
+		if (ret <= 0) {
+			return;
+		}
+
+		for (int i = 0; i < ret; i++) {
+			if (msgs[i].seq != seq) {
+				out_of_order++;
+			}
+			seq++;
+		}
+	}
+}
+
+static void start_thread(struct k_thread *thread, k_thread_stack_t *stack,
+			 k_thread_entry_t entry, uint32_t batch)
+{
+	k_thread_create(thread, stack, STACK_SIZE, entry,
+			UINT_TO_POINTER(batch), NULL, NULL,
+			THREAD_PRIO, THREAD_OPTIONS, K_FOREVER);
+#ifdef CONFIG_BENCHMARK_USER_THREADS
+	k_thread_access_grant(thread, &bench_msgq);
+	k_mem_domain_add_thread(&bench_domain, thread);
+#endif
+	k_thread_start(thread);
+}
+
+static uint64_t run(uint32_t batch)
+{
+	timing_t start;
+	timing_t finish;
+
+	k_msgq_purge(&bench_msgq);
+
+	start = timing_counter_get();
+
+	start_thread(&consumer_thread, consumer_stack, consumer_entry, batch);
+	start_thread(&producer_thread, producer_stack, producer_entry, batch);
+
+	k_thread_join(&producer_thread, K_FOREVER);
+	k_thread_join(&consumer_thread, K_FOREVER);
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static void report(uint32_t batch, uint64_t cycles)
+{
+	uint64_t ns = timing_cycles_to_ns(cycles);
+	uint64_t msgs_per_sec = (ns == 0) ? 0 : ((uint64_t)NUM_MSGS * NSEC_PER_SEC) / ns;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: msgq.batch.%02u - %u messages in batches of %u :%llu msgs/s\n",
+	       batch, NUM_MSGS, batch, msgs_per_sec);
+#else
+	printk("------------------------------------\n");
+	printk("%u messages in batches of %u\n", NUM_MSGS, batch);
+	printk("    Throughput : %llu msgs/s (%llu cycles, %llu nsec)\n",
+	       msgs_per_sec, cycles, ns);
+#endif
+}
+
+int main(void)
+{
+#ifdef CONFIG_BENCHMARK_USER_THREADS
+	struct k_mem_partition *parts[] = {&bench_partition};
+
+	k_mem_domain_init(&bench_domain, ARRAY_SIZE(parts), parts);
+#endif
+
+	timing_init();
+
+	printk("Message queue throughput, %s threads\n",
+	       IS_ENABLED(CONFIG_BENCHMARK_USER_THREADS) ? "user" : "kernel");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(batch_sizes); i++) {
+		if (batch_sizes[i] > QUEUE_LEN) {
+			break;
+		}
+
+		report(batch_sizes[i], run(batch_sizes[i]));
+	}
+
+	timing_stop();
+
+	if (out_of_order != 0U) {
+		printk("%u messages received out of order\n", out_of_order);
+	}
+
+	TC_END_REPORT((out_of_order == 0U) ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
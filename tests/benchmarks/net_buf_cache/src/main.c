@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure net_buf allocation throughput of a pool, which may use per-CPU
+ * free buffer caches, with one thread per CPU.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define NUM_OPS     CONFIG_BENCHMARK_NUM_OPS
+#define BURST       CONFIG_BENCHMARK_BURST
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+BUILD_ASSERT(NUM_THREADS * BURST <= CONFIG_BENCHMARK_POOL_SIZE,
+	     "Pool too small for the burst workload");
+
+NET_BUF_POOL_FIXED_DEFINE(bench_pool, CONFIG_BENCHMARK_POOL_SIZE, 64, 0, NULL);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+struct bench_result {
+	uint64_t op_cycles;
+	uint32_t ops;
+	uint32_t failed;
+};
+
+static struct bench_result results[NUM_THREADS];
+
+static void bench_thread(void *p1, void *p2, void *p3)
+{
+	struct bench_result *result = p1;
+	int burst = POINTER_TO_INT(p2);
+	struct net_buf *bufs[BURST];
+
+	ARG_UNUSED(p3);
+
+	while (result->ops < NUM_OPS) {
+		uint32_t start = k_cycle_get_32();
+		int n;
+
+		for (n = 0; n < burst; n++) {
+			bufs[n] = net_buf_alloc(&bench_pool, K_NO_WAIT);
+			if (bufs[n] == NULL) {
+				result->failed++;
+				break;
+			}
+		}
+
+		for (int i = 0; i < n; i++) {
+			net_buf_unref(bufs[i]);
+		}
+
+		result->op_cycles += k_cycle_get_32() - start;
+		result->ops += 2 * n;
+
+		if (n < burst) {
+			k_yield();
+		}
+	}
+}
+
+static void report(const char *tag, const char *str)
+{
+	uint64_t ops_per_sec = 0;
+	uint32_t failed = 0;
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		if (results[i].op_cycles != 0) {
+			ops_per_sec += ((uint64_t)results[i].ops *
+					sys_clock_hw_cycles_per_sec()) /
+				       results[i].op_cycles;
+		}
+		failed += results[i].failed;
+	}
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: net_buf_cache.%s - %s :%llu ops/s\n", tag, str, ops_per_sec);
+#else
+	printk("------------------------------------\n");
+	printk("%s (%s)\n", str, tag);
+	printk("    Operations/s : %llu (%d threads)\n", ops_per_sec, NUM_THREADS);
+	printk("    Failed allocs: %u\n", failed);
+#endif
+}
+
+static void report_cache_stats(void)
+{
+#ifdef CONFIG_NET_BUF_POOL_CACHE
+	struct net_buf_pool_cache_stats stats;
+
+	if (net_buf_pool_cache_stats_get(&bench_pool, &stats) < 0) {
+		return;
+	}
+
+	printk("    Cache: %u hits, %u misses, %u refills, %u drains, %u cached\n",
+	       stats.hits, stats.misses, stats.refills, stats.drains,
+	       stats.cached);
+#endif
+}
+
+static void run_workload(int burst, const char *tag, const char *str)
+{
+	memset(results, 0, sizeof(results));
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], K_THREAD_STACK_SIZEOF(stacks[i]),
+				bench_thread, &results[i], INT_TO_POINTER(burst), NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&threads[i], i);
+#endif
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	report(tag, str);
+	report_cache_stats();
+}
+
+int main(void)
+{
+	printk("net_buf allocation measurements, pool caches %s\n",
+	       IS_ENABLED(CONFIG_NET_BUF_POOL_CACHE) ? "enabled" : "disabled");
+
+	run_workload(1, "pingpong", "Single buffer allocations");
+	run_workload(BURST, "burst", "Burst allocations");
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the cost of the timeout queue operations for a growing number of
+ * pending timeouts.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/drivers/timer/system_timer.h>
+#include <timeout_q.h>
+
+/* Pending timeouts are scheduled this far away, so that the announcements
+ * done by the benchmark never expire them.
+ */
+#define FAR_TICKS    (1 << 24)
+#define SPREAD_TICKS (1 << 20)
+
+/* Ticks announced on top of the elapsed ticks to expire the probe timeout */
+#define ANNOUNCE_TICKS 4
+
+static const unsigned int queue_sizes[] = {10, 100, 1000, 10000};
+
+static struct _timeout pending[CONFIG_BENCHMARK_MAX_TIMEOUTS];
+static struct _timeout probe;
+static unsigned int probe_fired;
+
+static uint64_t add_cycles[CONFIG_BENCHMARK_NUM_ITERATIONS];
+static uint64_t rem_cycles[CONFIG_BENCHMARK_NUM_ITERATIONS];
+static uint64_t abort_cycles[CONFIG_BENCHMARK_NUM_ITERATIONS];
+static uint64_t announce_cycles[CONFIG_BENCHMARK_NUM_ITERATIONS];
+
+static uint32_t lcg_state = 1U;
+
+/* Deterministic pseudo random sequence, so that both backends see the
+ * same queue layouts.
+ */
+static uint32_t lcg_next(void)
+{
+	lcg_state = lcg_state * 1103515245U + 12345U;
+
+	return lcg_state >> 8;
+}
+
+static k_timeout_t far_timeout(void)
+{
+	return K_TICKS(FAR_TICKS + (lcg_next() % SPREAD_TICKS));
+}
+
+static void pending_handler(struct _timeout *t)
+{
+	printk("Pending timeout %u unexpectedly expired\n",
+	       (unsigned int)(t - pending));
+}
+
+static void probe_handler(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	probe_fired++;
+}
+
+static void fill_queue(unsigned int num_timeouts)
+{
+	for (unsigned int i = 0; i < num_timeouts; i++) {
+		z_init_timeout(&pending[i]);
+		z_add_timeout(&pending[i], pending_handler, far_timeout());
+	}
+}
+
+static void drain_queue(unsigned int num_timeouts)
+{
+	for (unsigned int i = 0; i < num_timeouts; i++) {
+		z_abort_timeout(&pending[i]);
+	}
+}
+
+static void test_queue_ops(unsigned int num_timeouts)
+{
+	timing_t start;
+	timing_t finish;
+	unsigned int key;
+	int32_t ticks;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		struct _timeout *queued = &pending[lcg_next() % num_timeouts];
+		k_timeout_t timeout = far_timeout();
+
+		z_init_timeout(&probe);
+
+		start = timing_counter_get();
+		z_add_timeout(&probe, probe_handler, timeout);
+		finish = timing_counter_get();
+		add_cycles[i] = timing_cycles_get(&start, &finish);
+
+		start = timing_counter_get();
+		(void)z_timeout_remaining(queued);
+		finish = timing_counter_get();
+		rem_cycles[i] = timing_cycles_get(&start, &finish);
+
+		start = timing_counter_get();
+		z_abort_timeout(&probe);
+		finish = timing_counter_get();
+		abort_cycles[i] = timing_cycles_get(&start, &finish);
+
+		/* Keep the system timer from announcing concurrently */
+		key = irq_lock();
+
+		/* The probe expires one tick after the ticks elapsed since
+		 * the last announcement done by the system timer driver.
+		 */
+		z_init_timeout(&probe);
+		z_add_timeout(&probe, probe_handler, K_NO_WAIT);
+		ticks = sys_clock_elapsed() + ANNOUNCE_TICKS;
+
+		start = timing_counter_get();
+		sys_clock_announce(ticks);
+		finish = timing_counter_get();
+		announce_cycles[i] = timing_cycles_get(&start, &finish);
+
+		irq_unlock(key);
+	}
+}
+
+static void report_stats(unsigned int num_timeouts, const uint64_t *cycles,
+			 const char *tag, const char *str)
+{
+	uint64_t minimum = cycles[0];
+	uint64_t maximum = cycles[0];
+	uint64_t total = 0;
+	uint64_t average;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		minimum = min(minimum, cycles[i]);
+		maximum = max(maximum, cycles[i]);
+		total += cycles[i];
+	}
+
+	average = total / CONFIG_BENCHMARK_NUM_ITERATIONS;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: timeout.%s.%05u.min - %s, %u pending, min. : %7llu cycles , %7u ns :\n",
+	       tag, num_timeouts, str, num_timeouts, minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("REC: timeout.%s.%05u.max - %s, %u pending, max. : %7llu cycles , %7u ns :\n",
+	       tag, num_timeouts, str, num_timeouts, maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("REC: timeout.%s.%05u.avg - %s, %u pending, avg. : %7llu cycles , %7u ns :\n",
+	       tag, num_timeouts, str, num_timeouts, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s (%u pending timeouts)\n", str, num_timeouts);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+int main(void)
+{
+	unsigned int num_timeouts;
+	bool failed = false;
+
+	timing_init();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_SCALABLE) ? "scalable" : "simple");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int n = 0; n < ARRAY_SIZE(queue_sizes); n++) {
+		num_timeouts = queue_sizes[n];
+		if (num_timeouts > CONFIG_BENCHMARK_MAX_TIMEOUTS) {
+			break;
+		}
+
+		probe_fired = 0;
+
+		fill_queue(num_timeouts);
+		test_queue_ops(num_timeouts);
+		drain_queue(num_timeouts);
+
+		if (probe_fired != CONFIG_BENCHMARK_NUM_ITERATIONS) {
+			printk("Probe timeout expired %u times, expected %u\n",
+			       probe_fired, CONFIG_BENCHMARK_NUM_ITERATIONS);
+			failed = true;
+		}
+
+		report_stats(num_timeouts, add_cycles, "add",
+			     "Add timeout at random position");
+		report_stats(num_timeouts, rem_cycles, "remaining",
+			     "Query remaining ticks of timeout");
+		report_stats(num_timeouts, abort_cycles, "abort",
+			     "Abort timeout");
+		report_stats(num_timeouts, announce_cycles, "announce",
+			     "Announce ticks expiring first timeout");
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(failed ? TC_FAIL : TC_PASS);
+
+	return 0;
+}
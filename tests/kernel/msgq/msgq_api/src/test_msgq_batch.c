@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 4
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern k_tid_t tids[2];
+extern struct k_msgq msgq;
+static ZTEST_BMEM char __aligned(4) tbuffer[MSG_SIZE * BATCH_LEN];
+static ZTEST_DMEM uint32_t tx_data[BATCH_LEN * 2] = {
+	0x1000, 0x1001, 0x1002, 0x1003, 0x1004, 0x1005, 0x1006, 0x1007
+};
+static ZTEST_BMEM uint32_t rx_data[BATCH_LEN * 2];
+
+static void batch_get_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t msgs[BATCH_LEN];
+	int ret = k_msgq_get_batch((struct k_msgq *)p1, msgs, BATCH_LEN, K_FOREVER);
+
+	zassert_equal(ret, 1, "waiting receiver got %d messages", ret);
+	zassert_equal(msgs[0], tx_data[0]);
+}
+
+static void batch_put_entry(void *p1, void *p2, void *p3)
+{
+	int ret = k_msgq_put_batch((struct k_msgq *)p1, &tx_data[BATCH_LEN],
+				   BATCH_LEN, K_FOREVER);
+
+	zassert_equal(ret, BATCH_LEN);
+}
+
+static void batch_wrap(struct k_msgq *q)
+{
+	/* Move the ring pointers so that the batches wrap around */
+	zassert_equal(k_msgq_put_batch(q, tx_data, 3, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_get_batch(q, rx_data, 3, K_NO_WAIT), 3);
+
+	/**TESTPOINT: a full batch put across the ring end */
+	zassert_equal(k_msgq_put_batch(q, tx_data, BATCH_LEN, K_NO_WAIT), BATCH_LEN);
+	zassert_equal(k_msgq_num_used_get(q), BATCH_LEN);
+
+	/**TESTPOINT: putting into a full queue without waiting */
+	zassert_equal(k_msgq_put_batch(q, tx_data, 1, K_NO_WAIT), -ENOMSG);
+
+	/**TESTPOINT: a partial batch get, then the remaining messages */
+	zassert_equal(k_msgq_get_batch(q, rx_data, 1, K_NO_WAIT), 1);
+	zassert_equal(k_msgq_get_batch(q, &rx_data[1], BATCH_LEN * 2, K_NO_WAIT),
+		      BATCH_LEN - 1);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(rx_data[i], tx_data[i]);
+	}
+
+	/**TESTPOINT: getting from an empty queue */
+	zassert_equal(k_msgq_get_batch(q, rx_data, BATCH_LEN, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_batch(q, rx_data, BATCH_LEN, TIMEOUT), -EAGAIN);
+
+	/**TESTPOINT: a batch larger than the queue only partially fits */
+	zassert_equal(k_msgq_put_batch(q, tx_data, BATCH_LEN * 2, K_NO_WAIT), BATCH_LEN);
+	zassert_equal(k_msgq_put_batch(q, tx_data, 1, TIMEOUT), -EAGAIN);
+	k_msgq_purge(q);
+}
+
+static void batch_waiters(struct k_msgq *q)
+{
+	/**TESTPOINT: a batch put hands the first message to the receiver */
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE,
+				  batch_get_entry, q, NULL, NULL,
+				  K_PRIO_PREEMPT(0), K_USER | K_INHERIT_PERMS,
+				  K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_msgq_put_batch(q, tx_data, BATCH_LEN, K_NO_WAIT), BATCH_LEN);
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+	zassert_equal(k_msgq_num_used_get(q), BATCH_LEN - 1);
+
+	/**TESTPOINT: a batch put waits for room for the whole batch */
+	zassert_equal(k_msgq_put_batch(q, tx_data, 1, K_NO_WAIT), 1);
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE,
+				  batch_put_entry, q, NULL, NULL,
+				  K_PRIO_PREEMPT(0), K_USER | K_INHERIT_PERMS,
+				  K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	for (int n = 0; n < BATCH_LEN * 2; ) {
+		int ret = k_msgq_get_batch(q, &rx_data[n], BATCH_LEN * 2 - n, K_FOREVER);
+
+		zassert_true(ret > 0, "get batch failed with %d", ret);
+		n += ret;
+	}
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+
+	/* Messages arrive in order, the blocked sender's ones last */
+	for (int i = 0; i < BATCH_LEN - 1; i++) {
+		zassert_equal(rx_data[i], tx_data[i + 1]);
+	}
+	zassert_equal(rx_data[BATCH_LEN - 1], tx_data[0]);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(rx_data[BATCH_LEN + i], tx_data[BATCH_LEN + i]);
+	}
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test batched put and get of messages
+ * @see k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_batch)
+{
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, BATCH_LEN);
+
+	batch_wrap(&msgq);
+	batch_waiters(&msgq);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test batched put and get of messages from user mode
+ * @see k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_batch)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, BATCH_LEN));
+
+	batch_wrap(q);
+}
+#endif
+
+/**
+ * @}
+ */
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern k_tid_t tids[2];
+extern struct k_msgq msgq;
+static char __aligned(4) tbuffer[MSG_SIZE * MSGQ_LEN];
+
+static void claim_get_entry(void *p1, void *p2, void *p3)
+{
+	struct k_msgq *q = p1;
+	uint32_t *data;
+
+	zassert_equal(k_msgq_get_claim(q, (void **)&data, K_FOREVER), 0);
+	zassert_equal(*data, MSG1);
+	zassert_equal(k_msgq_get_commit(q), 0);
+}
+
+static void claim_put_entry(void *p1, void *p2, void *p3)
+{
+	struct k_msgq *q = p1;
+	uint32_t *data;
+
+	zassert_equal(k_msgq_put_claim(q, (void **)&data, K_FOREVER), 0);
+	*data = MSG1;
+	zassert_equal(k_msgq_put_commit(q), 0);
+}
+
+static void claim_in_place(struct k_msgq *q)
+{
+	uint32_t *data;
+	uint32_t msg = MSG0;
+
+	/**TESTPOINT: fill a message in place, then read it in place */
+	zassert_equal(k_msgq_put_claim(q, (void **)&data, K_NO_WAIT), 0);
+	*data = MSG0;
+	zassert_equal(k_msgq_num_used_get(q), 0);
+	zassert_equal(k_msgq_put_commit(q), 0);
+	zassert_equal(k_msgq_num_used_get(q), 1);
+
+	zassert_equal(k_msgq_get_claim(q, (void **)&data, K_NO_WAIT), 0);
+	zassert_equal(*data, MSG0);
+	zassert_equal(k_msgq_get_commit(q), 0);
+	zassert_equal(k_msgq_num_used_get(q), 0);
+
+	/**TESTPOINT: commit without a claim */
+	zassert_equal(k_msgq_put_commit(q), -EINVAL);
+	zassert_equal(k_msgq_get_commit(q), -EINVAL);
+
+	/**TESTPOINT: operations conflicting with an outstanding claim */
+	zassert_equal(k_msgq_put_claim(q, (void **)&data, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_put_claim(q, (void **)&data, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_put(q, &msg, K_NO_WAIT), -EBUSY);
+	*data = MSG0;
+	zassert_equal(k_msgq_put_commit(q), 0);
+
+	zassert_equal(k_msgq_get_claim(q, (void **)&data, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get(q, &msg, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_put_front(q, &msg), -EBUSY);
+	zassert_equal(k_msgq_put(q, &msg, K_NO_WAIT), 0);
+
+	/**TESTPOINT: claiming from an empty or full queue */
+	zassert_equal(k_msgq_put_claim(q, (void **)&data, TIMEOUT), -EAGAIN);
+	zassert_equal(k_msgq_get_commit(q), 0);
+	zassert_equal(k_msgq_get(q, &msg, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get_claim(q, (void **)&data, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_claim(q, (void **)&data, TIMEOUT), -EAGAIN);
+
+	/**TESTPOINT: purging drops an outstanding get claim */
+	zassert_equal(k_msgq_put(q, &msg, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get_claim(q, (void **)&data, K_NO_WAIT), 0);
+	k_msgq_purge(q);
+	zassert_equal(k_msgq_get_commit(q), -EINVAL);
+}
+
+static void claim_waiters(struct k_msgq *q)
+{
+	uint32_t msg = MSG1;
+
+	/**TESTPOINT: a claiming receiver is woken by a put */
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE,
+				  claim_get_entry, q, NULL, NULL,
+				  K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_msgq_put(q, &msg, K_NO_WAIT), 0);
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+	zassert_equal(k_msgq_num_used_get(q), 0);
+
+	/**TESTPOINT: a claiming sender is woken by a get */
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_put(q, &msg, K_NO_WAIT), 0);
+	}
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE,
+				  claim_put_entry, q, NULL, NULL,
+				  K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	for (int i = 0; i < MSGQ_LEN + 1; i++) {
+		msg = 0;
+		zassert_equal(k_msgq_get(q, &msg, K_FOREVER), 0);
+		zassert_equal(msg, MSG1);
+	}
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test zero-copy claim and commit of messages
+ * @see k_msgq_put_claim(), k_msgq_put_commit(), k_msgq_get_claim(),
+ * k_msgq_get_commit()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim)
+{
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+
+	claim_in_place(&msgq);
+	claim_waiters(&msgq);
+}
+
+/**
+ * @}
+ */
@@ -160,3 +160,49 @@ ZTEST(k_pipe_basic, test_close)
 	zassert_true(k_pipe_read(&pipe, res, 5, K_NO_WAIT) == -EPIPE,
 		"Closed and empty pipe should return -EPIPE");
 }
+
+ZTEST(k_pipe_basic, test_claim_commit)
+{
+	uint8_t buffer[12];
+	uint8_t input[8];
+	uint8_t res[8];
+	uint8_t *claim;
+	int rc;
+
+	mkrandom(input, sizeof(input));
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	rc = k_pipe_write_claim(&pipe, &claim, sizeof(input), K_NO_WAIT);
+	zassert_true(rc == sizeof(input), "Failed to claim space in pipe");
+	zassert_true(k_pipe_write_claim(&pipe, &claim, 1, K_NO_WAIT) == -EBUSY,
+		"Should not be able to claim space twice");
+	zassert_true(k_pipe_write(&pipe, input, 1, K_NO_WAIT) == -EBUSY,
+		"Should not be able to write while space is claimed");
+	memcpy(claim, input, sizeof(input));
+	zassert_true(k_pipe_write_commit(&pipe, sizeof(input)) == 0,
+		"Failed to commit claimed space");
+	zassert_true(k_pipe_write_commit(&pipe, 0) == -EINVAL,
+		"Should not be able to commit without a claim");
+
+	rc = k_pipe_read_claim(&pipe, &claim, 5, K_NO_WAIT);
+	zassert_true(rc == 5, "Failed to claim data in pipe");
+	zassert_true(memcmp(input, claim, 5) == 0, "Unexpected data claimed from pipe");
+	zassert_true(k_pipe_read(&pipe, res, 1, K_NO_WAIT) == -EBUSY,
+		"Should not be able to read while data is claimed");
+	zassert_true(k_pipe_read_commit(&pipe, 6) == -EINVAL,
+		"Should not be able to commit more than claimed");
+	zassert_true(k_pipe_read_commit(&pipe, 5) == 0, "Failed to commit claimed data");
+
+	/* claims stop at the end of the buffer */
+	zassert_true(k_pipe_write(&pipe, input, sizeof(input), K_NO_WAIT) == sizeof(input),
+		"Failed to write to pipe");
+	rc = k_pipe_read_claim(&pipe, &claim, sizeof(res), K_NO_WAIT);
+	zassert_true(rc == sizeof(buffer) - 5, "Unexpected claim size %d", rc);
+	zassert_true(k_pipe_read_commit(&pipe, rc) == 0, "Failed to commit claimed data");
+	zassert_true(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT) == 11 - rc,
+		"Failed to read remaining bytes from pipe");
+
+	/* nothing left to claim */
+	zassert_true(k_pipe_read_claim(&pipe, &claim, 1, K_MSEC(100)) == -EAGAIN,
+		"Should not be able to claim data in empty pipe");
+}
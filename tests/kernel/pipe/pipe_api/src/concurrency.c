@@ -219,3 +219,53 @@ ZTEST(k_pipe_concurrency, test_zero_size_pipe_read_write)
 
 	k_thread_join(tid, K_FOREVER);
 }
+
+#define STREAM_LEN   4096
+#define STREAM_CHUNK 7
+
+static void thread_stream_write(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t chunk[STREAM_CHUNK];
+	size_t sent = 0;
+	int rc;
+
+	while (sent < STREAM_LEN) {
+		size_t len = MIN(sizeof(chunk), STREAM_LEN - sent);
+
+		for (size_t i = 0; i < len; i++) {
+			chunk[i] = (uint8_t)(sent + i);
+		}
+		rc = k_pipe_write((struct k_pipe *)arg1, chunk, len, K_FOREVER);
+		zassert_true(rc > 0, "Failed to write to pipe");
+		sent += rc;
+	}
+}
+
+ZTEST(k_pipe_concurrency, test_stream_order)
+{
+	k_tid_t tid;
+	uint8_t buffer[DUMMY_DATA_SIZE];
+	uint8_t chunk[STREAM_CHUNK - 2];
+	size_t received = 0;
+	int rc;
+
+	/* Odd chunk sizes make both sides wrap around the buffer end, mixing
+	 * transfers that find the pipe full or empty with those that don't.
+	 */
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	tid = k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack),
+		thread_stream_write, &pipe, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	while (received < STREAM_LEN) {
+		rc = k_pipe_read(&pipe, chunk, MIN(sizeof(chunk), STREAM_LEN - received),
+				 K_FOREVER);
+		zassert_true(rc > 0, "Failed to read from pipe");
+		for (int i = 0; i < rc; i++) {
+			zassert_equal(chunk[i], (uint8_t)(received + i),
+				      "Unexpected data received from pipe");
+		}
+		received += rc;
+	}
+
+	k_thread_join(tid, K_FOREVER);
+}
@@ -64,6 +64,8 @@ static struct k_timer status_timer;
 static struct k_timer status_anytime_timer;
 static struct k_timer status_sync_timer;
 static struct k_timer remain_timer;
+static struct k_timer slack_timer;
+static struct k_timer slack_sync_timer;
 
 static ZTEST_BMEM struct timer_data tdata;
 
@@ -925,6 +927,51 @@ ZTEST_USER(timer_api, test_sleep_abs)
 
 }
 
+/**
+ * @brief Test timers started with slack
+ *
+ * @details Start a timer with a slack window that covers the expiry of a
+ * second timer, and check that it is expired together with the second
+ * one, never after its own deadline.
+ *
+ * @ingroup kernel_timer_tests
+ *
+ * @see k_timer_start_slack()
+ */
+ZTEST_USER(timer_api, test_timer_slack)
+{
+	int64_t start;
+	int64_t elapsed;
+
+	/* Only a tickless kernel leaves the expiry of the first timer to
+	 * the wakeup of the second one.
+	 */
+	bool coalesced = IS_ENABLED(CONFIG_TIMEOUT_SLACK) &&
+			 IS_ENABLED(CONFIG_TICKLESS_KERNEL);
+
+	k_timer_start_slack(&slack_timer, K_MSEC(PERIOD), K_NO_WAIT, K_MSEC(DURATION));
+	k_timer_start(&slack_sync_timer, K_MSEC(DURATION), K_NO_WAIT);
+
+	/** TESTPOINT: the expiry is deferred into the window */
+	busy_wait_ms((PERIOD + DURATION) / 2);
+	if (coalesced) {
+		zassert_equal(k_timer_status_get(&slack_timer), 0,
+			      "timer expired before sharing a wakeup");
+	}
+
+	/** TESTPOINT: both timers expire in the same wakeup */
+	zassert_equal(k_timer_status_sync(&slack_sync_timer), 1);
+	zassert_equal(k_timer_status_get(&slack_timer), 1);
+
+	/** TESTPOINT: a timer alone expires within its slack */
+	start = k_uptime_get();
+	k_timer_start_slack(&slack_timer, K_MSEC(PERIOD), K_NO_WAIT, K_MSEC(PERIOD));
+	zassert_equal(k_timer_status_sync(&slack_timer), 1);
+	elapsed = k_uptime_get() - start;
+	zassert_true(elapsed >= PERIOD && elapsed <= 2 * PERIOD + k_ticks_to_ms_ceil32(2),
+		     "expired after %lld ms", elapsed);
+}
+
 static void timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn,
 		       k_timer_stop_t stop_fn)
 {
@@ -946,6 +993,8 @@ void *setup_timer_api(void)
 	timer_init(&status_anytime_timer, NULL, NULL);
 	timer_init(&status_sync_timer, duration_expire, duration_stop);
 	timer_init(&remain_timer, duration_expire, duration_stop);
+	timer_init(&slack_timer, NULL, NULL);
+	timer_init(&slack_sync_timer, NULL, NULL);
 
 	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
 		k_thread_access_grant(k_current_get(), &ktimer, &timer0, &timer1,
@@ -1457,6 +1457,134 @@ ZTEST(work_1cpu, test_1cpu_system_reschedule)
 		     "long %u > %u\n", elapsed_ms, max_ms);
 }
 
+#ifdef CONFIG_WORKQUEUE_MULTI_WORKER
+static K_THREAD_STACK_DEFINE(multi_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(multi_worker_stack, STACK_SIZE);
+static struct k_thread multi_worker_thread;
+static struct k_work_q multi_queue;
+
+/* Given by block_handler when it starts and taken before it completes */
+static K_SEM_DEFINE(multi_started_sem, 0, 2);
+static K_SEM_DEFINE(multi_rel_sem, 0, 2);
+static atomic_t multi_running;
+static atomic_t multi_max_running;
+
+static void block_handler(struct k_work *work)
+{
+	atomic_val_t running = atomic_inc(&multi_running) + 1;
+
+	if (running > atomic_get(&multi_max_running)) {
+		atomic_set(&multi_max_running, running);
+	}
+
+	k_sem_give(&multi_started_sem);
+	(void)k_sem_take(&multi_rel_sem, K_FOREVER);
+	atomic_dec(&multi_running);
+}
+
+static void multi_queue_start(void)
+{
+	static bool started;
+
+	if (started) {
+		return;
+	}
+
+	k_work_queue_start(&multi_queue, multi_stack, K_THREAD_STACK_SIZEOF(multi_stack),
+			   PREEMPT_PRIORITY, NULL);
+	zassert_equal(k_work_queue_add_worker(&multi_queue, &multi_worker_thread,
+					      multi_worker_stack,
+					      K_THREAD_STACK_SIZEOF(multi_worker_stack),
+					      PREEMPT_PRIORITY, 0), 0);
+	started = true;
+}
+
+/* Check that independent items run concurrently on a multi-worker queue */
+ZTEST(work, test_multi_worker_concurrent)
+{
+	int rc;
+
+	multi_queue_start();
+	atomic_set(&multi_max_running, 0);
+	k_work_init(&common_work, block_handler);
+	k_work_init(&common_work1, block_handler);
+
+	zassert_equal(k_work_submit_to_queue(&multi_queue, &common_work), 1);
+	zassert_equal(k_work_submit_to_queue(&multi_queue, &common_work1), 1);
+
+	/* Both are running, each on its own worker */
+	zassert_equal(k_sem_take(&multi_started_sem, K_FOREVER), 0);
+	zassert_equal(k_sem_take(&multi_started_sem, K_FOREVER), 0);
+	zassert_equal(atomic_get(&multi_max_running), 2);
+	zassert_equal(k_work_busy_get(&common_work), K_WORK_RUNNING);
+	zassert_equal(k_work_busy_get(&common_work1), K_WORK_RUNNING);
+
+	k_sem_give(&multi_rel_sem);
+	k_sem_give(&multi_rel_sem);
+
+	rc = k_work_queue_drain(&multi_queue, false);
+	zassert_true(rc >= 0, "drain failed: %d", rc);
+	zassert_equal(k_work_busy_get(&common_work), 0);
+	zassert_equal(k_work_busy_get(&common_work1), 0);
+}
+
+/* Check that an item resubmitted while running is not run by another
+ * worker until it completes, and that flushing waits for it.
+ */
+ZTEST(work, test_multi_worker_no_reentry)
+{
+	multi_queue_start();
+	atomic_set(&multi_max_running, 0);
+	k_work_init(&common_work, block_handler);
+
+	zassert_equal(k_work_submit_to_queue(&multi_queue, &common_work), 1);
+	zassert_equal(k_sem_take(&multi_started_sem, K_FOREVER), 0);
+
+	/* Resubmission is queued on the same queue, but the idle worker
+	 * must leave it alone.
+	 */
+	zassert_equal(k_work_submit_to_queue(&multi_queue, &common_work), 2);
+	zassert_equal(k_sem_take(&multi_started_sem, DELAY_TIMEOUT), -EAGAIN);
+	zassert_equal(k_work_busy_get(&common_work), K_WORK_RUNNING | K_WORK_QUEUED);
+
+	/* Release both invocations; the flush returns once the queued
+	 * one has completed too.
+	 */
+	k_sem_give(&multi_rel_sem);
+	k_sem_give(&multi_rel_sem);
+	zassert_true(k_work_flush(&common_work, &work_sync));
+	zassert_equal(k_work_busy_get(&common_work), 0);
+	zassert_equal(k_sem_take(&multi_started_sem, K_NO_WAIT), 0);
+	zassert_equal(atomic_get(&multi_max_running), 1);
+}
+
+#ifdef CONFIG_OBJ_CORE_STATS_WORK_Q
+/* Check the statistics exported through the object core */
+ZTEST(work, test_multi_worker_stats)
+{
+	struct k_work_q_stats stats;
+	int rc;
+
+	multi_queue_start();
+	k_work_init(&common_work, counter_handler);
+	reset_counters();
+
+	zassert_equal(k_obj_core_stats_reset(K_OBJ_CORE(&multi_queue)), 0);
+	zassert_equal(k_work_submit_to_queue(&multi_queue, &common_work), 1);
+	zassert_equal(k_sem_take(&sync_sem, K_FOREVER), 0);
+	(void)k_work_queue_drain(&multi_queue, false);
+
+	rc = k_obj_core_stats_raw(K_OBJ_CORE(&multi_queue), &stats, sizeof(stats));
+	zassert_equal(rc, 0);
+	zassert_equal(stats.depth, 0);
+	zassert_equal(stats.max_depth, 1);
+	zassert_equal(stats.completed, 1);
+	zassert_true(stats.exec_cycles >= stats.max_exec_cycles);
+	zassert_true(stats.wait_cycles >= stats.max_wait_cycles);
+}
+#endif /* CONFIG_OBJ_CORE_STATS_WORK_Q */
+#endif /* CONFIG_WORKQUEUE_MULTI_WORKER */
+
 ZTEST(work, test_nop)
 {
 	ztest_test_skip();
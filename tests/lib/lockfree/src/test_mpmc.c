@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/mpmc_lockfree.h>
+
+#define MPMC_SZ 8
+
+MPMC_DEFINE(push_pop_q, MPMC_SZ);
+
+static uint32_t push_pop_items[MPMC_SZ + 1];
+
+/*
+ * @brief Push and pop elements, wrapping around the ring
+ *
+ * @see mpmc_push(), mpmc_pop()
+ */
+ZTEST(mpmc, test_push_pop)
+{
+	mpmc_init(&push_pop_q, NULL, 0);
+
+	zassert_equal(mpmc_size(&push_pop_q), MPMC_SZ);
+	zassert_is_null(mpmc_pop(&push_pop_q), "Pop on empty queue should return null");
+
+	for (int lap = 0; lap < 3; lap++) {
+		for (int i = 0; i < MPMC_SZ; i++) {
+			zassert_ok(mpmc_push(&push_pop_q, &push_pop_items[i]));
+		}
+		zassert_equal(mpmc_count(&push_pop_q), MPMC_SZ);
+
+		zassert_equal(mpmc_push(&push_pop_q, &push_pop_items[MPMC_SZ]), -ENOBUFS,
+			      "Push on full queue should fail");
+
+		for (int i = 0; i < MPMC_SZ; i++) {
+			zassert_equal(mpmc_pop(&push_pop_q), &push_pop_items[i],
+				      "Pop should return items in order");
+		}
+		zassert_is_null(mpmc_pop(&push_pop_q), "Pop on empty queue should return null");
+		zassert_equal(mpmc_count(&push_pop_q), 0);
+
+		/* Shift the ring position for the next lap */
+		zassert_ok(mpmc_push(&push_pop_q, &push_pop_items[0]));
+		zassert_equal(mpmc_pop(&push_pop_q), &push_pop_items[0]);
+	}
+}
+
+#define MPMC_ITERATIONS 20000
+#define MPMC_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define MPMC_PRODUCERS 2
+#define MPMC_CONSUMERS 2
+#define MPMC_THREADS_NUM (MPMC_PRODUCERS + MPMC_CONSUMERS)
+#define MPMC_ITEMS (MPMC_ITERATIONS * MPMC_PRODUCERS)
+
+static struct k_thread mpmc_thread[MPMC_THREADS_NUM];
+static K_THREAD_STACK_ARRAY_DEFINE(mpmc_stack, MPMC_THREADS_NUM, MPMC_STACK_SIZE);
+
+MPMC_DEFINE(mpmc_q, MPMC_SZ);
+
+static uint32_t mpmc_items[MPMC_ITEMS];
+static ATOMIC_DEFINE(mpmc_seen, MPMC_ITEMS);
+static atomic_t mpmc_popped;
+static atomic_t mpmc_duplicates;
+
+static void mpmc_consumer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	uint32_t *item;
+
+	while (atomic_get(&mpmc_popped) < MPMC_ITEMS) {
+		item = mpmc_pop(&mpmc_q);
+		if (item == NULL) {
+			k_yield();
+			continue;
+		}
+
+		if (atomic_test_and_set_bit(mpmc_seen, *item)) {
+			atomic_inc(&mpmc_duplicates);
+		}
+		atomic_inc(&mpmc_popped);
+	}
+}
+
+static void mpmc_producer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	uint32_t first = (uint32_t)(uintptr_t)p1 * MPMC_ITERATIONS;
+
+	for (uint32_t i = first; i < first + MPMC_ITERATIONS; i++) {
+		mpmc_items[i] = i;
+		while (mpmc_push(&mpmc_q, &mpmc_items[i]) != 0) {
+			k_yield();
+		}
+	}
+}
+
+/**
+ * @brief Test that concurrent producers and consumers are thread safe
+ *
+ * Every pushed item must be popped exactly once. This can and should be
+ * validated on SMP machines where incoherent memory could cause issues.
+ */
+ZTEST(mpmc, test_mpmc_threaded)
+{
+	mpmc_init(&mpmc_q, NULL, 0);
+	atomic_set(&mpmc_popped, 0);
+	atomic_set(&mpmc_duplicates, 0);
+
+	for (int i = 0; i < MPMC_THREADS_NUM; i++) {
+		bool consumer = i < MPMC_CONSUMERS;
+
+		k_thread_create(&mpmc_thread[i], mpmc_stack[i], MPMC_STACK_SIZE,
+				consumer ? mpmc_consumer : mpmc_producer,
+				(void *)(uintptr_t)(i - MPMC_CONSUMERS), NULL, NULL,
+				K_PRIO_PREEMPT(5), K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < MPMC_THREADS_NUM; i++) {
+		k_thread_join(&mpmc_thread[i], K_FOREVER);
+	}
+
+	zassert_equal(atomic_get(&mpmc_popped), MPMC_ITEMS);
+	zassert_equal(atomic_get(&mpmc_duplicates), 0, "Items were popped more than once");
+	for (int i = 0; i < MPMC_ITEMS; i++) {
+		zassert_true(atomic_test_bit(mpmc_seen, i), "Item %d was lost", i);
+	}
+	zassert_is_null(mpmc_pop(&mpmc_q));
+}
+
+#ifdef CONFIG_MPMC_LOCKFREE_POLL
+
+static void mpmc_delayed_push(struct k_work *work)
+{
+	zassert_ok(mpmc_push(&push_pop_q, &push_pop_items[1]));
+}
+
+static K_WORK_DELAYABLE_DEFINE(mpmc_push_work, mpmc_delayed_push);
+
+/**
+ * @brief Test blocking consumers
+ *
+ * @see mpmc_pop_wait(), mpmc_poll_prepare(), mpmc_poll_pop()
+ */
+ZTEST(mpmc, test_mpmc_pop_wait)
+{
+	struct k_poll_event event;
+
+	mpmc_init(&push_pop_q, NULL, 0);
+
+	zassert_is_null(mpmc_pop_wait(&push_pop_q, K_NO_WAIT));
+	zassert_is_null(mpmc_pop_wait(&push_pop_q, K_MSEC(10)));
+
+	/* An object already queued signals the event right away */
+	zassert_ok(mpmc_push(&push_pop_q, &push_pop_items[0]));
+	mpmc_poll_prepare(&push_pop_q, &event);
+	zassert_ok(k_poll(&event, 1, K_NO_WAIT));
+	zassert_equal(mpmc_poll_pop(&push_pop_q), &push_pop_items[0]);
+
+	/* A consumer blocks until an object is pushed */
+	k_work_schedule(&mpmc_push_work, K_MSEC(10));
+	zassert_equal(mpmc_pop_wait(&push_pop_q, K_FOREVER), &push_pop_items[1]);
+	zassert_equal(atomic_get(&push_pop_q.waiters), 0);
+}
+
+#endif /* CONFIG_MPMC_LOCKFREE_POLL */
+
+#define THROUGHPUT_ITERS 100000
+
+ZTEST(mpmc, test_mpmc_throughput)
+{
+	timing_t start_time, end_time;
+
+	mpmc_init(&push_pop_q, NULL, 0);
+	timing_init();
+	timing_start();
+
+	start_time = timing_counter_get();
+
+	int key = irq_lock();
+
+	for (int i = 0; i < THROUGHPUT_ITERS; i++) {
+		mpmc_push(&push_pop_q, &push_pop_items[0]);
+
+		mpmc_pop(&push_pop_q);
+	}
+
+	irq_unlock(key);
+
+	end_time = timing_counter_get();
+
+	uint64_t cycles = timing_cycles_get(&start_time, &end_time);
+	uint64_t ns = timing_cycles_to_ns(cycles);
+
+	TC_PRINT("%llu ns for %d iterations, %llu ns per op\n", ns,
+		 THROUGHPUT_ITERS, ns/THROUGHPUT_ITERS);
+}
+
+ZTEST_SUITE(mpmc, NULL, NULL, NULL, NULL, NULL);
@@ -608,4 +608,52 @@ ZTEST(net_pkt_filter_test_suite, test_npf_vlan_filtering)
 	zassert_true(npf_remove_recv_rule(&vlan_small_ip_pkt), "");
 }
 
+/*
+ * Redirecting packets to a FIFO
+ */
+
+static K_FIFO_DEFINE(redirect_fifo);
+static NPF_ETH_TYPE_MATCH(arp_packet, NET_ETH_PTYPE_ARP);
+
+static NPF_REDIRECT(redirect_arp, &redirect_fifo, arp_packet);
+
+ZTEST(net_pkt_filter_test_suite, test_npf_redirect)
+{
+	struct net_pkt *pkt;
+
+	/* install filter rules */
+	npf_insert_recv_rule(&npf_default_drop);
+	npf_insert_recv_rule(&small_ip_pkt);
+	npf_insert_recv_rule(&redirect_arp);
+
+	/* small IP packets are passed on to the stack */
+	pkt = build_test_pkt(NET_ETH_PTYPE_IP, 100, NULL);
+	zassert_equal(net_pkt_filter_recv(pkt), NET_CONTINUE, "");
+	zassert_true(k_fifo_is_empty(&redirect_fifo), "");
+	net_pkt_unref(pkt);
+
+	/* "big" IP packets are dropped */
+	pkt = build_test_pkt(NET_ETH_PTYPE_IP, 300, NULL);
+	zassert_equal(net_pkt_filter_recv(pkt), NET_DROP, "");
+	zassert_true(k_fifo_is_empty(&redirect_fifo), "");
+	net_pkt_unref(pkt);
+
+	/* ARP packets are redirected whatever their size */
+	pkt = build_test_pkt(NET_ETH_PTYPE_ARP, 300, NULL);
+	zassert_equal(net_pkt_filter_recv(pkt), NET_OK, "");
+	zassert_equal_ptr(k_fifo_get(&redirect_fifo, K_NO_WAIT), pkt, "");
+	net_pkt_unref(pkt);
+
+	/* outside of the receive path redirect rules just accept packets */
+	pkt = build_test_pkt(NET_ETH_PTYPE_ARP, 100, NULL);
+	zassert_true(net_pkt_filter_recv_ok(pkt), "");
+	zassert_true(k_fifo_is_empty(&redirect_fifo), "");
+	net_pkt_unref(pkt);
+
+	/* remove filter rules */
+	zassert_true(npf_remove_recv_rule(&npf_default_drop), "");
+	zassert_true(npf_remove_recv_rule(&small_ip_pkt), "");
+	zassert_true(npf_remove_recv_rule(&redirect_arp), "");
+}
+
 ZTEST_SUITE(net_pkt_filter_test_suite, NULL, test_npf_iface, NULL, NULL, NULL);
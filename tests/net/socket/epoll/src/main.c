@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <stdio.h>
+#include <zephyr/ztest_assert.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/fdtable.h>
+
+#include "../../socket_helpers.h"
+
+#define BUF_AND_SIZE(buf) buf, sizeof(buf) - 1
+#define STRLEN(buf) (sizeof(buf) - 1)
+
+#define TEST_STR_SMALL "test"
+
+#define MY_IPV6_ADDR "::1"
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+/* Long enough for a packet to go through the loopback interface */
+#define WAIT_MS 100
+
+static int c_sock;
+static int s_sock;
+
+static void send_small(void)
+{
+	ssize_t len;
+
+	len = zsock_send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+}
+
+static void recv_small(void)
+{
+	char buf[10];
+	ssize_t len;
+
+	len = zsock_recv(s_sock, buf, sizeof(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+}
+
+static int add_server(int epfd, uint32_t events)
+{
+	struct zsock_epoll_event ev = {
+		.events = events,
+		.data.fd = s_sock,
+	};
+
+	return zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, s_sock, &ev);
+}
+
+ZTEST(net_socket_epoll, test_level_triggered)
+{
+	struct zsock_epoll_event events[2];
+	int epfd;
+	int res;
+
+	epfd = zsock_epoll_create();
+	zassert_true(epfd >= 0, "epoll_create failed");
+
+	zassert_ok(add_server(epfd, ZSOCK_EPOLLIN));
+	zassert_equal(add_server(epfd, ZSOCK_EPOLLIN), -1, "");
+	zassert_equal(errno, EEXIST, "");
+
+	/* Nothing to read yet */
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	zassert_equal(res, 0, "");
+
+	/* A waiter is woken up by the incoming packet */
+	send_small();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, ZSOCK_EPOLLIN, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	/* Reported again for as long as the data is not read */
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+
+	recv_small();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* And rearmed for the next packet */
+	send_small();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "");
+	recv_small();
+
+	zassert_ok(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, s_sock, NULL));
+	zassert_equal(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, s_sock, NULL), -1, "");
+	zassert_equal(errno, ENOENT, "");
+
+	/* Not reported once removed */
+	send_small();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 0, "");
+	recv_small();
+
+	zassert_ok(zsock_close(epfd));
+}
+
+ZTEST(net_socket_epoll, test_edge_triggered)
+{
+	struct zsock_epoll_event events[2];
+	int epfd;
+	int res;
+
+	epfd = zsock_epoll_create();
+	zassert_true(epfd >= 0, "epoll_create failed");
+
+	zassert_ok(add_server(epfd, ZSOCK_EPOLLIN | ZSOCK_EPOLLET));
+
+	send_small();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, ZSOCK_EPOLLIN, "");
+
+	/* Reported only once until drained */
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	recv_small();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	send_small();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "");
+	recv_small();
+
+	zassert_ok(zsock_close(epfd));
+}
+
+ZTEST(net_socket_epoll, test_oneshot)
+{
+	struct zsock_epoll_event events[2];
+	struct zsock_epoll_event ev = {
+		.events = ZSOCK_EPOLLIN | ZSOCK_EPOLLONESHOT,
+		.data.u32 = 42,
+	};
+	int epfd;
+	int res;
+
+	epfd = zsock_epoll_create();
+	zassert_true(epfd >= 0, "epoll_create failed");
+
+	zassert_ok(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, s_sock, &ev));
+
+	send_small();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.u32, 42, "");
+
+	/* Disabled until modified */
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	zassert_ok(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_MOD, s_sock, &ev));
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 1, "");
+
+	recv_small();
+
+	zassert_ok(zsock_close(epfd));
+}
+
+ZTEST(net_socket_epoll, test_writable_and_close)
+{
+	struct zsock_epoll_event events[2];
+	struct zsock_epoll_event ev = {
+		.events = ZSOCK_EPOLLOUT,
+		.data.fd = c_sock,
+	};
+	int epfd;
+	int res;
+
+	epfd = zsock_epoll_create();
+	zassert_true(epfd >= 0, "epoll_create failed");
+
+	/* An epoll instance can not watch itself */
+	zassert_equal(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, epfd, &ev), -1, "");
+	zassert_equal(errno, EINVAL, "");
+
+	/* UDP sockets are always writable */
+	zassert_ok(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, c_sock, &ev));
+	zassert_ok(add_server(epfd, ZSOCK_EPOLLIN));
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, ZSOCK_EPOLLOUT, "");
+	zassert_equal(events[0].data.fd, c_sock, "");
+
+	send_small();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), WAIT_MS);
+	zassert_equal(res, 2, "");
+
+	/* Closing a socket drops it from the interest set */
+	recv_small();
+	zassert_ok(zsock_close(c_sock));
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	zassert_ok(zsock_close(epfd));
+	zassert_equal(zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0), -1, "");
+}
+
+static void before(void *fixture)
+{
+	struct net_sockaddr_in6 c_addr;
+	struct net_sockaddr_in6 s_addr;
+	int res;
+
+	ARG_UNUSED(fixture);
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = zsock_bind(s_sock, (struct net_sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = zsock_connect(c_sock, (struct net_sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)zsock_close(c_sock);
+	(void)zsock_close(s_sock);
+}
+
+ZTEST_SUITE(net_socket_epoll, NULL, NULL, before, after, NULL);
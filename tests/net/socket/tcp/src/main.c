@@ -2683,6 +2683,110 @@ ZTEST(net_socket_tcp, test_v6_listen_backlog)
 	test_common_listen_backlog(NET_AF_INET6, TEST_BACKLOG_MAX);
 }
 
+#define ZEROCOPY_FRAG_LEN 100
+#define ZEROCOPY_FRAG_COUNT 3
+#define ZEROCOPY_LEN (ZEROCOPY_FRAG_LEN * ZEROCOPY_FRAG_COUNT)
+
+NET_BUF_POOL_DEFINE(zerocopy_pool, ZEROCOPY_FRAG_COUNT, ZEROCOPY_FRAG_LEN, 0, NULL);
+
+ZTEST(net_socket_tcp, test_v4_zerocopy)
+{
+	struct net_sockaddr_in c_saddr;
+	struct net_sockaddr_in s_saddr;
+	struct net_sockaddr addr;
+	net_socklen_t addrlen = sizeof(addr);
+	struct net_buf *buf = NULL;
+	struct net_buf *frag;
+	size_t total = 0;
+	char rx_buf[2];
+	int new_sock;
+	int c_sock;
+	int s_sock;
+	ssize_t ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct net_sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+	test_connect(c_sock, (struct net_sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	/* The rest of a partially read segment is returned */
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	ret = zsock_recv(new_sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(ret, sizeof(rx_buf), "recv failed (%d)", errno);
+
+	ret = zsock_recv_buf(new_sock, &buf, ZSOCK_MSG_PEEK);
+	zassert_equal(ret, -1, "peek accepted");
+	zassert_equal(errno, EOPNOTSUPP, "invalid errno %d", errno);
+
+	ret = zsock_recv_buf(new_sock, &buf, 0);
+	zassert_equal(ret, strlen(TEST_STR_SMALL) - sizeof(rx_buf),
+		      "recv_buf failed (%d)", errno);
+	zassert_not_null(buf, "no buffer");
+	zassert_equal(net_buf_frags_len(buf), ret, "invalid length");
+	zassert_mem_equal(buf->data, TEST_STR_SMALL + sizeof(rx_buf), buf->len);
+	net_buf_unref(buf);
+
+	ret = zsock_recv_buf(new_sock, &buf, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(ret, -1, "data received");
+	zassert_equal(errno, EAGAIN, "invalid errno %d", errno);
+	zassert_is_null(buf, "buffer returned");
+
+	/* Send a fragment chain and receive it back */
+	for (int i = 0; i < ZEROCOPY_FRAG_COUNT; i++) {
+		frag = net_buf_alloc(&zerocopy_pool, K_NO_WAIT);
+		zassert_not_null(frag, "cannot allocate fragment");
+
+		for (int j = 0; j < ZEROCOPY_FRAG_LEN; j++) {
+			net_buf_add_u8(frag, ((i * ZEROCOPY_FRAG_LEN + j) * TEST_PRIME) & 0xff);
+		}
+
+		buf = net_buf_frag_add(buf, frag);
+	}
+
+	ret = zsock_send_buf(c_sock, buf, 0);
+	zassert_equal(ret, ZEROCOPY_LEN, "send_buf failed (%d)", errno);
+
+	while (total < ZEROCOPY_LEN) {
+		ret = zsock_recv_buf(new_sock, &buf, 0);
+		zassert_true(ret > 0, "recv_buf failed (%d) after %zu bytes", errno, total);
+		zassert_equal(net_buf_frags_len(buf), ret, "invalid length");
+
+		for (frag = buf; frag != NULL; frag = frag->frags) {
+			for (int j = 0; j < frag->len; j++, total++) {
+				zassert_equal(frag->data[j], (total * TEST_PRIME) & 0xff,
+					      "unexpected data at %zu", total);
+			}
+		}
+
+		net_buf_unref(buf);
+	}
+
+	zassert_equal(total, ZEROCOPY_LEN, "too much data received");
+
+	/* The connection releases the fragments once they are acknowledged */
+	buf = NULL;
+
+	for (int i = 0; i < ZEROCOPY_FRAG_COUNT; i++) {
+		frag = net_buf_alloc(&zerocopy_pool, K_SECONDS(1));
+		zassert_not_null(frag, "fragments not released");
+		buf = net_buf_frag_add(buf, frag);
+	}
+
+	net_buf_unref(buf);
+
+	test_close(c_sock);
+	test_eof(new_sock);
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
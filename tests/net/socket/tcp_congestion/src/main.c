@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/ztest_assert.h>
+#include <zephyr/net/net_context.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/loopback.h>
+
+#include "tcp_internal.h"
+
+#include "../../socket_helpers.h"
+
+#define MY_IPV4_ADDR "127.0.0.1"
+
+#define ANY_PORT 0
+#define SERVER_PORT 4242
+
+#define TRANSFER_SIZE (128 * 1024)
+#define TEST_PRIME 811
+
+#define TCP_TEARDOWN_TIMEOUT K_MSEC(500)
+
+#define RECEIVER_STACK_SIZE 2048
+
+K_THREAD_STACK_DEFINE(receiver_stack, RECEIVER_STACK_SIZE);
+static struct k_thread receiver_thread;
+
+struct transfer_result {
+	uint32_t duration_ms;
+	uint16_t max_cwnd;
+};
+
+static void set_congestion(int sock, const char *name)
+{
+	int ret;
+
+	ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION,
+			       name, strlen(name));
+	zassert_equal(ret, 0, "setsockopt %s failed (%d)", name, errno);
+}
+
+static void check_congestion(int sock, const char *name)
+{
+	char buf[16] = { 0 };
+	net_socklen_t len = sizeof(buf);
+	int ret;
+
+	ret = zsock_getsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, buf, &len);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(len, strlen(name) + 1, "invalid length %d", len);
+	zassert_str_equal(buf, name, "invalid algorithm %s", buf);
+}
+
+static uint16_t get_cwnd(int sock)
+{
+	struct net_context *ctx = zsock_get_context_object(sock);
+
+	return ctx->tcp->ca.cwnd;
+}
+
+static void receiver(void *p1, void *p2, void *p3)
+{
+	int s_sock = POINTER_TO_INT(p1);
+	struct net_sockaddr addr;
+	net_socklen_t addrlen = sizeof(addr);
+	size_t total = 0;
+	uint8_t buf[256];
+	int new_sock;
+	ssize_t len;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	new_sock = zsock_accept(s_sock, &addr, &addrlen);
+	zassert_true(new_sock >= 0, "accept failed (%d)", errno);
+
+	while (total < TRANSFER_SIZE) {
+		len = zsock_recv(new_sock, buf, sizeof(buf), 0);
+		zassert_true(len > 0, "recv failed (%d) after %zu bytes", errno, total);
+
+		for (int i = 0; i < len; i++) {
+			zassert_equal(buf[i], ((total + i) * TEST_PRIME) & 0xff,
+				      "unexpected data at %zu", total + i);
+		}
+
+		total += len;
+	}
+
+	zassert_ok(zsock_close(new_sock));
+}
+
+/* Push TRANSFER_SIZE bytes through the loopback interface, which drops a
+ * packet every 1 / loss_ratio ones, and sample the congestion window of the
+ * sender along the way.
+ */
+static void run_transfer(const char *name, float loss_ratio, uint16_t port,
+			 struct transfer_result *result)
+{
+	struct net_sockaddr_in c_saddr;
+	struct net_sockaddr_in s_saddr;
+	uint32_t start;
+	size_t total = 0;
+	uint8_t buf[512];
+	int c_sock;
+	int s_sock;
+	ssize_t len;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, port, &s_sock, &s_saddr);
+
+	zassert_ok(zsock_bind(s_sock, (struct net_sockaddr *)&s_saddr, sizeof(s_saddr)));
+	zassert_ok(zsock_listen(s_sock, 1));
+
+	k_thread_create(&receiver_thread, receiver_stack,
+			K_THREAD_STACK_SIZEOF(receiver_stack), receiver,
+			INT_TO_POINTER(s_sock), NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	set_congestion(c_sock, name);
+	zassert_ok(zsock_connect(c_sock, (struct net_sockaddr *)&s_saddr, sizeof(s_saddr)));
+	check_congestion(c_sock, name);
+
+	zassert_ok(loopback_set_packet_drop_ratio(loss_ratio));
+
+	result->max_cwnd = 0;
+	start = k_uptime_get_32();
+
+	while (total < TRANSFER_SIZE) {
+		size_t chunk = MIN(sizeof(buf), TRANSFER_SIZE - total);
+
+		for (int i = 0; i < chunk; i++) {
+			buf[i] = ((total + i) * TEST_PRIME) & 0xff;
+		}
+
+		len = zsock_send(c_sock, buf, chunk, 0);
+		zassert_true(len > 0, "send failed (%d) after %zu bytes", errno, total);
+		total += len;
+
+		result->max_cwnd = MAX(result->max_cwnd, get_cwnd(c_sock));
+	}
+
+	zassert_ok(k_thread_join(&receiver_thread, K_SECONDS(60)),
+		   "transfer did not complete");
+
+	result->duration_ms = MAX(k_uptime_get_32() - start, 1);
+
+	zassert_ok(loopback_set_packet_drop_ratio(0.0f));
+	zassert_ok(zsock_close(c_sock));
+	zassert_ok(zsock_close(s_sock));
+
+	TC_PRINT("%-8s loss %3u%%: %u bytes in %u ms (%u kB/s), max cwnd %u\n",
+		 name, (unsigned int)(loss_ratio * 100), TRANSFER_SIZE,
+		 result->duration_ms, TRANSFER_SIZE / result->duration_ms,
+		 result->max_cwnd);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
+ZTEST(net_socket_tcp_congestion, test_congestion_opt)
+{
+	struct net_sockaddr_in saddr;
+	char buf[4];
+	net_socklen_t len;
+	int sock;
+	int ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &saddr);
+
+	check_congestion(sock, CONFIG_NET_TCP_CONGESTION_DEFAULT);
+
+	set_congestion(sock, "cubic");
+	check_congestion(sock, "cubic");
+
+	/* The name does not need to be NUL terminated */
+	ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION,
+			       "newreno", sizeof("newreno"));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+	check_congestion(sock, "newreno");
+
+	ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION,
+			       "bogus", strlen("bogus"));
+	zassert_equal(ret, -1, "unknown algorithm accepted");
+	zassert_equal(errno, ENOENT, "invalid errno %d", errno);
+	check_congestion(sock, "newreno");
+
+	/* The name is truncated to the size of the buffer */
+	len = sizeof(buf);
+	ret = zsock_getsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, buf, &len);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(len, sizeof(buf), "invalid length %d", len);
+	zassert_mem_equal(buf, "newr", sizeof(buf));
+
+	zassert_ok(zsock_close(sock));
+}
+
+ZTEST(net_socket_tcp_congestion, test_accept_inherit)
+{
+	struct net_sockaddr_in c_saddr;
+	struct net_sockaddr_in s_saddr;
+	struct net_sockaddr addr;
+	net_socklen_t addrlen = sizeof(addr);
+	int new_sock;
+	int c_sock;
+	int s_sock;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	zassert_ok(zsock_bind(s_sock, (struct net_sockaddr *)&s_saddr, sizeof(s_saddr)));
+	zassert_ok(zsock_listen(s_sock, 1));
+
+	set_congestion(s_sock, "cubic");
+	set_congestion(c_sock, "newreno");
+
+	zassert_ok(zsock_connect(c_sock, (struct net_sockaddr *)&s_saddr, sizeof(s_saddr)));
+
+	new_sock = zsock_accept(s_sock, &addr, &addrlen);
+	zassert_true(new_sock >= 0, "accept failed (%d)", errno);
+
+	check_congestion(new_sock, "cubic");
+	check_congestion(c_sock, "newreno");
+
+	zassert_ok(zsock_close(new_sock));
+	zassert_ok(zsock_close(c_sock));
+	zassert_ok(zsock_close(s_sock));
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
+ZTEST(net_socket_tcp_congestion, test_cwnd_growth)
+{
+	struct transfer_result new_reno;
+	struct transfer_result cubic;
+
+	run_transfer("newreno", 0.0f, SERVER_PORT + 1, &new_reno);
+	run_transfer("cubic", 0.0f, SERVER_PORT + 2, &cubic);
+
+	/* Both open the window, CUBIC keeps doing slow start without losses
+	 * while New Reno grows linearly past its small initial threshold.
+	 */
+	zassert_true(new_reno.max_cwnd > 1280, "New Reno window did not grow");
+	zassert_true(cubic.max_cwnd > new_reno.max_cwnd,
+		     "CUBIC window (%u) not larger than New Reno one (%u)",
+		     cubic.max_cwnd, new_reno.max_cwnd);
+}
+
+ZTEST(net_socket_tcp_congestion, test_lossy_transfer)
+{
+	struct transfer_result result;
+
+	/* Drop one packet out of 50, the data must still make it through */
+	run_transfer("newreno", 0.02f, SERVER_PORT + 3, &result);
+	run_transfer("cubic", 0.02f, SERVER_PORT + 4, &result);
+}
+
+ZTEST_SUITE(net_socket_tcp_congestion, NULL, NULL, NULL, NULL, NULL);
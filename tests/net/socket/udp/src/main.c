@@ -3758,6 +3758,105 @@ ZTEST(net_socket_udp, test_v6_rebinding)
 	test_rebinding_common(NET_AF_INET6);
 }
 
+#define MMSG_COUNT 3
+
+ZTEST(net_socket_udp, test_v4_sendmmsg_recvmmsg)
+{
+	static const char * const payloads[MMSG_COUNT] = { "one", "two", "three" };
+	struct net_sockaddr_in client_addr;
+	struct net_sockaddr_in server_addr;
+	struct net_sockaddr_in src_addr[MMSG_COUNT + 1];
+	struct net_iovec tx_iov[MMSG_COUNT];
+	struct net_iovec rx_iov[MMSG_COUNT + 1];
+	struct net_mmsghdr tx_msgs[MMSG_COUNT] = { 0 };
+	struct net_mmsghdr rx_msgs[MMSG_COUNT + 1] = { 0 };
+	char bufs[MMSG_COUNT + 1][16];
+	struct timespec timeout = {
+		.tv_sec = 0,
+		.tv_nsec = 100 * NSEC_PER_MSEC,
+	};
+	uint32_t start_time, time_diff;
+	int client_sock;
+	int server_sock;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct net_sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+	rv = zsock_bind(client_sock, (struct net_sockaddr *)&client_addr, sizeof(client_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		tx_iov[i].iov_base = (void *)payloads[i];
+		tx_iov[i].iov_len = strlen(payloads[i]);
+		tx_msgs[i].msg_hdr.msg_name = &server_addr;
+		tx_msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+		tx_msgs[i].msg_hdr.msg_iov = &tx_iov[i];
+		tx_msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	for (int i = 0; i < MMSG_COUNT + 1; i++) {
+		rx_iov[i].iov_base = bufs[i];
+		rx_iov[i].iov_len = sizeof(bufs[i]);
+		rx_msgs[i].msg_hdr.msg_name = &src_addr[i];
+		rx_msgs[i].msg_hdr.msg_namelen = sizeof(src_addr[i]);
+		rx_msgs[i].msg_hdr.msg_iov = &rx_iov[i];
+		rx_msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	/* Nothing queued yet */
+	rv = zsock_recvmmsg(server_sock, rx_msgs, MMSG_COUNT + 1, ZSOCK_MSG_DONTWAIT, NULL);
+	zassert_equal(rv, -1, "Unexpected return code %d", rv);
+	zassert_equal(errno, EAGAIN, "Unexpected errno value: %d", errno);
+
+	start_time = k_uptime_get_32();
+	rv = zsock_recvmmsg(server_sock, rx_msgs, MMSG_COUNT + 1, 0, &timeout);
+	time_diff = k_uptime_get_32() - start_time;
+	zassert_equal(rv, -1, "Unexpected return code %d", rv);
+	zassert_equal(errno, EAGAIN, "Unexpected errno value: %d", errno);
+	zassert_true(time_diff >= 100, "Expected timeout after 100ms but was %dms", time_diff);
+
+	rv = zsock_sendmmsg(client_sock, tx_msgs, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed, %d (%d)", rv, errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(tx_msgs[i].msg_len, strlen(payloads[i]), "Invalid sent length");
+	}
+
+	/* Let all the datagrams get through the stack */
+	k_msleep(100);
+
+	/* Only the queued datagrams are returned, not waiting for the last one */
+	rv = zsock_recvmmsg(server_sock, rx_msgs, MMSG_COUNT + 1, ZSOCK_MSG_WAITFORONE, NULL);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed, %d (%d)", rv, errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(rx_msgs[i].msg_len, strlen(payloads[i]), "Invalid received length");
+		zassert_mem_equal(bufs[i], payloads[i], strlen(payloads[i]), "Invalid data");
+		zassert_equal(src_addr[i].sin_port, client_addr.sin_port, "Invalid source port");
+	}
+
+	rv = zsock_sendmmsg(client_sock, tx_msgs, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed, %d (%d)", rv, errno);
+
+	k_msleep(100);
+
+	/* With a timeout, the queued datagrams are returned once it expires */
+	rv = zsock_recvmmsg(server_sock, rx_msgs, MMSG_COUNT + 1, 0, &timeout);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed, %d (%d)", rv, errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_mem_equal(bufs[i], payloads[i], strlen(payloads[i]), "Invalid data");
+	}
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
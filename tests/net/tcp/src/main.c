@@ -116,6 +116,10 @@ static enum test_case_no {
 	TEST_CLIENT_SEQ_VALIDATION = 19,
 	TEST_SERVER_ACK_VALIDATION = 20,
 	TEST_SERVER_FIN_ACK_AFTER_DATA = 21,
+	TEST_SERVER_SACK = 22,
+	TEST_SERVER_SACK_BEYOND_SND_NXT = 23,
+	TEST_SERVER_GRO = 24,
+	TEST_SERVER_GSO = 25,
 } test_case_no;
 
 static enum test_state t_state;
@@ -143,6 +147,9 @@ static void handle_client_fin_ack_with_data_test(net_sa_family_t af, struct tcph
 static void handle_client_seq_validation_test(net_sa_family_t af, struct tcphdr *th);
 static void handle_server_ack_validation_test(struct net_pkt *pkt);
 static void handle_server_fin_ack_after_data_test(net_sa_family_t af, struct tcphdr *th);
+static void handle_server_sack_test(struct net_pkt *pkt);
+static void handle_server_sack_beyond_snd_nxt_test(struct net_pkt *pkt);
+static void handle_server_gso_test(struct net_pkt *pkt);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -240,6 +247,19 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+#define SACK_TEST_MSS 200
+
+static const uint8_t sack_syn_options[] = {
+	0x02, 0x04, 0x00, SACK_TEST_MSS, /* Max segment */
+	0x01, 0x01, 0x04, 0x02 /* NOP, NOP, SACK permitted */ };
+
+/* Add sack_syn_options to the SYN of the peer */
+static bool sack_permitted;
+
+/* SACK option added to the other segments of the peer */
+static uint8_t peer_sack[4 + 2 * NET_TCP_SACK_BLOCK_SIZE];
+static size_t peer_sack_len;
+
 static struct net_pkt *tester_prepare_tcp_pkt(net_sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -250,11 +270,19 @@ static struct net_pkt *tester_prepare_tcp_pkt(net_sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
-	uint8_t opts_len = 0;
+	const uint8_t *opts = NULL;
+	size_t opts_len = 0;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (sack_permitted && (flags & SYN)) {
+		opts = sack_syn_options;
+		opts_len = sizeof(sack_syn_options);
+	} else if (flags & ACK) {
+		opts = peer_sack;
+		opts_len = peer_sack_len;
 	}
 
 	/* Allocate buffer */
@@ -289,11 +317,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(net_sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
 	th->th_win = net_htons(NET_IPV6_MTU);
@@ -308,9 +332,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(net_sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len > 0) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -498,6 +522,18 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_SERVER_FIN_ACK_AFTER_DATA:
 		handle_server_fin_ack_after_data_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_SERVER_SACK:
+		handle_server_sack_test(pkt);
+		break;
+	case TEST_SERVER_SACK_BEYOND_SND_NXT:
+		handle_server_sack_beyond_snd_nxt_test(pkt);
+		break;
+	case TEST_SERVER_GRO:
+		/* Only the data received by the application is checked */
+		break;
+	case TEST_SERVER_GSO:
+		handle_server_gso_test(pkt);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -726,6 +762,10 @@ static void handle_server_test(net_sa_family_t af, struct tcphdr *th)
 		break;
 	case T_SYN_ACK:
 		test_verify_flags(th, SYN | ACK);
+		if (sack_permitted) {
+			/* MSS and SACK permitted options */
+			zassert_equal(th->th_off, 7U, "SACK not permitted in SYN ACK");
+		}
 		seq++;
 		ack = net_ntohl(th->th_seq) + 1U;
 		reply = prepare_ack_packet(af, net_htons(MY_PORT),
@@ -3209,4 +3249,611 @@ ZTEST(net_tcp, test_server_fin_ack_after_data)
 	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
 }
 
+#define SACK_TEST_DATA_LEN (5 * SACK_TEST_MSS)
+
+static enum {
+	SACK_RECV_OUT_OF_ORDER,
+	SACK_RECV_IN_ORDER,
+	SACK_SEND_DATA,
+	SACK_SEND_FIRST_HOLE,
+	SACK_SEND_SECOND_HOLE,
+	SACK_SEND_DONE,
+	SACK_BEYOND_SEND_DATA,
+	SACK_BEYOND_RTO,
+	SACK_BEYOND_RESEND,
+} sack_state;
+
+/* Sequence numbers of the first data byte sent by the peer and by the DUT */
+static uint32_t sack_peer_seq;
+static uint32_t sack_dut_seq;
+
+static void set_peer_sack(const struct tcp_sack_block *blocks, int count)
+{
+	uint8_t *opt = peer_sack;
+
+	peer_sack_len = 0;
+
+	if (count == 0) {
+		return;
+	}
+
+	*opt++ = NET_TCP_NOP_OPT;
+	*opt++ = NET_TCP_NOP_OPT;
+	*opt++ = NET_TCP_SACK_OPT;
+	*opt++ = 2 + count * NET_TCP_SACK_BLOCK_SIZE;
+
+	for (int i = 0; i < count; i++) {
+		sys_put_be32(blocks[i].start, opt);
+		sys_put_be32(blocks[i].end, opt + 4);
+		opt += NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	peer_sack_len = opt - peer_sack;
+}
+
+/* Read the header, the payload length and the first SACK block of a segment
+ * sent by the DUT. Returns whether there was a SACK block.
+ */
+static bool read_sack_segment(struct net_pkt *pkt, struct tcphdr *th, size_t *len,
+			      struct tcp_sack_block *blk)
+{
+	uint8_t opts[40];
+	size_t hdr_len;
+	size_t opts_len;
+	bool found = false;
+
+	zassert_ok(read_tcp_header(pkt, th), "Failed to read TCP header");
+
+	hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	opts_len = th->th_off * 4U - sizeof(struct tcphdr);
+	*len = net_pkt_get_len(pkt) - hdr_len - th->th_off * 4U;
+
+	if (opts_len == 0) {
+		return false;
+	}
+
+	net_pkt_set_overwrite(pkt, true);
+	zassert_ok(net_pkt_skip(pkt, hdr_len + sizeof(struct tcphdr)));
+	zassert_ok(net_pkt_read(pkt, opts, opts_len));
+	net_pkt_cursor_init(pkt);
+
+	for (size_t i = 0; i < opts_len && opts[i] != NET_TCP_END_OPT; ) {
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (i + 1 >= opts_len || opts[i + 1] < 2) {
+			break;
+		}
+
+		if (opts[i] == NET_TCP_SACK_OPT && !found) {
+			blk->start = sys_get_be32(&opts[i + 2]);
+			blk->end = sys_get_be32(&opts[i + 6]);
+			found = true;
+		}
+
+		i += opts[i + 1];
+	}
+
+	return found;
+}
+
+static void handle_server_sack_test(struct net_pkt *pkt)
+{
+	const struct tcp_sack_block lost_first_and_third[] = {
+		{ sack_dut_seq + 3 * SACK_TEST_MSS, sack_dut_seq + 5 * SACK_TEST_MSS },
+		{ sack_dut_seq + SACK_TEST_MSS, sack_dut_seq + 2 * SACK_TEST_MSS },
+	};
+	struct tcp_sack_block blk;
+	struct net_pkt *reply;
+	struct tcphdr th;
+	bool has_sack;
+	size_t len;
+
+	has_sack = read_sack_segment(pkt, &th, &len, &blk);
+
+	switch (sack_state) {
+	case SACK_RECV_OUT_OF_ORDER:
+		zassert_equal(net_ntohl(th.th_ack), sack_peer_seq, "Unexpected ACK");
+		zassert_true(has_sack, "Out-of-order data not reported");
+		zassert_equal(blk.start, sack_peer_seq + 10, "Invalid SACK block start");
+		zassert_equal(blk.end, sack_peer_seq + 20, "Invalid SACK block end");
+		break;
+	case SACK_RECV_IN_ORDER:
+		zassert_equal(net_ntohl(th.th_ack), sack_peer_seq + 20, "Unexpected ACK");
+		zassert_false(has_sack, "Unexpected SACK block");
+		break;
+	case SACK_SEND_DATA:
+		if (len == 0 ||
+		    net_ntohl(th.th_seq) != sack_dut_seq + 4 * SACK_TEST_MSS) {
+			return;
+		}
+
+		/* The first and third segments were lost */
+		set_peer_sack(lost_first_and_third, 2);
+
+		for (int i = 0; i < 3; i++) {
+			reply = prepare_ack_packet(NET_AF_INET6, net_htons(MY_PORT),
+						   net_htons(PEER_PORT));
+			zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+		}
+
+		sack_state = SACK_SEND_FIRST_HOLE;
+		return;
+	case SACK_SEND_FIRST_HOLE:
+		if (len == 0) {
+			return;
+		}
+
+		zassert_equal(net_ntohl(th.th_seq), sack_dut_seq, "Unexpected retransmission");
+		zassert_equal(len, SACK_TEST_MSS, "Invalid retransmission length");
+
+		/* Partial ACK, the third segment is still missing */
+		ack = sack_dut_seq + 2 * SACK_TEST_MSS;
+		set_peer_sack(lost_first_and_third, 1);
+
+		reply = prepare_ack_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+		zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+
+		sack_state = SACK_SEND_SECOND_HOLE;
+		return;
+	case SACK_SEND_SECOND_HOLE:
+		if (len == 0) {
+			return;
+		}
+
+		zassert_equal(net_ntohl(th.th_seq), sack_dut_seq + 2 * SACK_TEST_MSS,
+			      "Unexpected retransmission");
+		zassert_equal(len, SACK_TEST_MSS, "Invalid retransmission length");
+
+		ack = sack_dut_seq + SACK_TEST_DATA_LEN;
+		set_peer_sack(NULL, 0);
+
+		reply = prepare_ack_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+		zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+
+		sack_state = SACK_SEND_DONE;
+		break;
+	case SACK_SEND_DONE:
+		zassert_equal(len, 0, "Unexpected retransmission");
+		return;
+	default:
+		zassert_true(false, "Unexpected state %d", sack_state);
+	}
+
+	test_sem_give();
+}
+
+/* Next sequence number expected from the DUT */
+static uint32_t sack_next_seq;
+
+static void handle_server_sack_beyond_snd_nxt_test(struct net_pkt *pkt)
+{
+	const struct tcp_sack_block beyond_snd_nxt = {
+		sack_dut_seq + 3 * SACK_TEST_MSS, sack_dut_seq + 4 * SACK_TEST_MSS
+	};
+	struct tcp_sack_block blk;
+	struct net_pkt *reply;
+	struct tcphdr th;
+	size_t len;
+
+	(void)read_sack_segment(pkt, &th, &len, &blk);
+
+	if (len == 0) {
+		return;
+	}
+
+	switch (sack_state) {
+	case SACK_BEYOND_SEND_DATA:
+		if (net_ntohl(th.th_seq) == sack_dut_seq + 4 * SACK_TEST_MSS) {
+			/* Everything was lost, wait for the retransmission timer */
+			sack_state = SACK_BEYOND_RTO;
+		}
+
+		return;
+	case SACK_BEYOND_RTO:
+		zassert_equal(net_ntohl(th.th_seq), sack_dut_seq, "Unexpected retransmission");
+		zassert_equal(len, SACK_TEST_MSS, "Invalid retransmission length");
+
+		/* Acknowledge the retransmitted segment, and report a block the
+		 * DUT did not send again since the timeout.
+		 */
+		ack = sack_dut_seq + SACK_TEST_MSS;
+		sack_next_seq = ack;
+		set_peer_sack(&beyond_snd_nxt, 1);
+
+		reply = prepare_ack_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+		zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+
+		sack_state = SACK_BEYOND_RESEND;
+		return;
+	case SACK_BEYOND_RESEND:
+		zassert_equal(net_ntohl(th.th_seq), sack_next_seq,
+			      "Data skipped because of a SACK block beyond SND.NXT");
+
+		sack_next_seq += len;
+		if (sack_next_seq != sack_dut_seq + SACK_TEST_DATA_LEN) {
+			return;
+		}
+
+		ack = sack_next_seq;
+		set_peer_sack(NULL, 0);
+
+		reply = prepare_ack_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+		zassert_ok(net_recv_data(net_iface, reply), "%s failed", __func__);
+
+		sack_state = SACK_SEND_DONE;
+		break;
+	case SACK_SEND_DONE:
+		zassert_true(false, "Unexpected retransmission");
+		return;
+	default:
+		zassert_true(false, "Unexpected state %d", sack_state);
+	}
+
+	test_sem_give();
+}
+
+/* Test case scenario IPv6, with SACK permitted by the peer
+ *   expect five data segments, all of which are lost,
+ *   expect the first one to be retransmitted on timeout,
+ *   acknowledge it with a SACK block above it, covering data the DUT did
+ *   not send again since the timeout,
+ *   expect the block to be ignored and the rest of the data to be sent
+ *   without gaps.
+ */
+ZTEST(net_tcp, test_server_sack_beyond_snd_nxt)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_SACK);
+	/* The congestion window would spread the segments over several RTTs */
+	Z_TEST_SKIP_IFDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	k_sem_reset(&test_sem);
+
+	sack_permitted = true;
+	ctx = create_server_socket(0, 0);
+	sack_permitted = false;
+
+	test_case_no = TEST_SERVER_SACK_BEYOND_SND_NXT;
+	sack_dut_seq = ack;
+
+	sack_state = SACK_BEYOND_SEND_DATA;
+	ret = net_context_send(accepted_ctx, lorem_ipsum, SACK_TEST_DATA_LEN, NULL,
+			       K_NO_WAIT, NULL);
+	zassert_equal(ret, SACK_TEST_DATA_LEN, "Failed to send data to peer %d", ret);
+
+	test_sem_take(K_MSEC(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT * 3), __LINE__);
+
+	/* Make sure that nothing is retransmitted afterwards */
+	k_msleep(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT * 2);
+
+	/* Just send a RST packet to abort the underlying connection */
+	pkt = prepare_rst_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+/* Test case scenario IPv6, with SACK permitted by the peer
+ *   send out-of-order data,
+ *   expect a SACK block reporting it,
+ *   send the missing data,
+ *   expect an ACK without SACK block,
+ *   expect five data segments, the first and third of which are lost,
+ *   expect both of them to be retransmitted before the retransmission timer
+ *   expires, and nothing else.
+ */
+ZTEST(net_tcp, test_server_sack)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_SACK);
+	/* The congestion window would spread the segments over several RTTs */
+	Z_TEST_SKIP_IFDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	sack_permitted = true;
+	ctx = create_server_socket(0, 0);
+	sack_permitted = false;
+
+	test_case_no = TEST_SERVER_SACK;
+	sack_peer_seq = seq;
+	sack_dut_seq = ack;
+
+	sack_state = SACK_RECV_OUT_OF_ORDER;
+	seq = sack_peer_seq + 10;
+	pkt = prepare_data_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT),
+				  lorem_ipsum + 10, 10);
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	sack_state = SACK_RECV_IN_ORDER;
+	seq = sack_peer_seq;
+	pkt = prepare_data_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT),
+				  lorem_ipsum, 10);
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	sack_state = SACK_SEND_DATA;
+	seq = sack_peer_seq + 20;
+	ret = net_context_send(accepted_ctx, lorem_ipsum, SACK_TEST_DATA_LEN, NULL,
+			       K_NO_WAIT, NULL);
+	zassert_equal(ret, SACK_TEST_DATA_LEN, "Failed to send data to peer %d", ret);
+
+	test_sem_take(K_MSEC(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT / 2), __LINE__);
+
+	/* Make sure that nothing is retransmitted afterwards */
+	k_msleep(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT * 2);
+
+	/* Just send a RST packet to abort the underlying connection */
+	pkt = prepare_rst_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+#define GRO_TEST_SEG_LEN 10
+#define GRO_TEST_SEGS 4
+#define GRO_TEST_DATA_LEN (GRO_TEST_SEGS * GRO_TEST_SEG_LEN)
+
+static uint8_t gro_recv_buf[GRO_TEST_DATA_LEN];
+static size_t gro_recv_len;
+static size_t gro_recv_first_len;
+static int gro_recv_count;
+
+static void test_gro_recv_cb(struct net_context *context,
+			     struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr,
+			     union net_proto_header *proto_hdr,
+			     int status,
+			     void *user_data)
+{
+	size_t len;
+
+	if (status && status != -ECONNRESET) {
+		zassert_true(false, "failed to recv the data");
+	}
+
+	if (!pkt) {
+		return;
+	}
+
+	len = net_pkt_remaining_data(pkt);
+	zassert_true(gro_recv_len + len <= sizeof(gro_recv_buf), "Too much data received");
+	zassert_ok(net_pkt_read(pkt, gro_recv_buf + gro_recv_len, len), "Cannot read data");
+
+	if (gro_recv_count == 0) {
+		gro_recv_first_len = len;
+	}
+
+	gro_recv_len += len;
+	gro_recv_count++;
+
+	net_pkt_unref(pkt);
+}
+
+/* Queue the segments of the peer in the given order, all of them before the
+ * RX thread gets to run.
+ */
+static void send_gro_burst(uint32_t peer_seq, const int *order, int count)
+{
+	struct net_pkt *pkt;
+
+	k_sched_lock();
+
+	for (int i = 0; i < count; i++) {
+		size_t offset = order[i] * GRO_TEST_SEG_LEN;
+
+		seq = peer_seq + offset;
+		pkt = tester_prepare_tcp_pkt(NET_AF_INET6, net_htons(MY_PORT),
+					     net_htons(PEER_PORT), ACK,
+					     lorem_ipsum + offset, GRO_TEST_SEG_LEN);
+		zassert_not_null(pkt, "Cannot create pkt");
+		zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+	}
+
+	k_sched_unlock();
+
+	seq = peer_seq + GRO_TEST_DATA_LEN;
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+}
+
+static struct net_context *start_gro_test(uint32_t *peer_seq)
+{
+	struct net_context *ctx;
+
+	k_sem_reset(&test_sem);
+	set_peer_sack(NULL, 0);
+
+	ctx = create_server_socket(0, 0);
+	accepted_ctx->recv_cb = test_gro_recv_cb;
+
+	test_case_no = TEST_SERVER_GRO;
+	*peer_seq = seq;
+
+	memset(gro_recv_buf, 0, sizeof(gro_recv_buf));
+	gro_recv_len = 0;
+	gro_recv_first_len = 0;
+	gro_recv_count = 0;
+
+	return ctx;
+}
+
+static void end_gro_test(struct net_context *ctx)
+{
+	struct net_pkt *pkt;
+
+	zassert_equal(gro_recv_len, GRO_TEST_DATA_LEN, "Invalid data length %zu",
+		      gro_recv_len);
+	zassert_mem_equal(gro_recv_buf, lorem_ipsum, GRO_TEST_DATA_LEN,
+			  "Data received out of order");
+
+	/* Just send a RST packet to abort the underlying connection */
+	pkt = prepare_rst_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+/* Test case scenario IPv6, with GRO
+ *   send a burst of in-order data segments without PSH,
+ *   expect them to reach the application as a single packet, once the RX
+ *   queue is empty.
+ */
+ZTEST(net_tcp, test_server_gro)
+{
+	static const int order[GRO_TEST_SEGS] = { 0, 1, 2, 3 };
+	struct net_context *ctx;
+	uint32_t peer_seq;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_GRO);
+
+	ctx = start_gro_test(&peer_seq);
+
+	send_gro_burst(peer_seq, order, ARRAY_SIZE(order));
+
+	zassert_equal(gro_recv_count, 1, "Segments not coalesced (%d packets)",
+		      gro_recv_count);
+
+	end_gro_test(ctx);
+}
+
+/* Test case scenario IPv6, with GRO
+ *   send a burst of data segments, the third one after the fourth,
+ *   expect the first two to be coalesced, the fourth one to be queued as out
+ *   of order data, and the whole data to reach the application in order.
+ */
+ZTEST(net_tcp, test_server_gro_out_of_order)
+{
+	static const int order[GRO_TEST_SEGS] = { 0, 1, 3, 2 };
+	struct net_context *ctx;
+	uint32_t peer_seq;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_GRO);
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	ctx = start_gro_test(&peer_seq);
+
+	send_gro_burst(peer_seq, order, ARRAY_SIZE(order));
+
+	zassert_equal(gro_recv_first_len, 2 * GRO_TEST_SEG_LEN,
+		      "Segments before the gap not coalesced (%zu bytes)",
+		      gro_recv_first_len);
+
+	end_gro_test(ctx);
+}
+
+#define GSO_TEST_DATA_LEN (5 * SACK_TEST_MSS)
+
+static uint32_t gso_dut_seq;
+static uint32_t gso_next_seq;
+
+static void handle_server_gso_test(struct net_pkt *pkt)
+{
+	struct tcp_sack_block blk;
+	struct net_pkt *reply;
+	struct tcphdr th;
+	size_t len;
+
+	(void)read_sack_segment(pkt, &th, &len, &blk);
+
+	if (len == 0) {
+		return;
+	}
+
+	zassert_equal(net_ntohl(th.th_seq), gso_next_seq, "Segments not contiguous");
+	zassert_true(len <= SACK_TEST_MSS, "Segment larger than the MSS (%zu)", len);
+	zassert_true(len == SACK_TEST_MSS ||
+		     gso_next_seq + len == gso_dut_seq + GSO_TEST_DATA_LEN,
+		     "Short segment (%zu) before the end of the data", len);
+
+	gso_next_seq += len;
+
+	/* Acknowledge every segment so that the window keeps opening */
+	ack = gso_next_seq;
+	reply = prepare_ack_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+	zassert_not_null(reply, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, reply), "recv data failed");
+
+	if (gso_next_seq == gso_dut_seq + GSO_TEST_DATA_LEN) {
+		test_sem_give();
+	}
+}
+
+/* Test case scenario IPv6, with GSO and a peer MSS of SACK_TEST_MSS
+ *   send several segments worth of data at once,
+ *   expect the data in contiguous segments of the MSS.
+ */
+ZTEST(net_tcp, test_server_gso)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_GSO);
+
+	k_sem_reset(&test_sem);
+	set_peer_sack(NULL, 0);
+
+	/* The SYN of the peer carries its MSS along with the SACK option */
+	sack_permitted = true;
+	ctx = create_server_socket(0, 0);
+	sack_permitted = false;
+
+	test_case_no = TEST_SERVER_GSO;
+	gso_dut_seq = ack;
+	gso_next_seq = ack;
+
+	ret = net_context_send(accepted_ctx, lorem_ipsum, GSO_TEST_DATA_LEN, NULL,
+			       K_NO_WAIT, NULL);
+	zassert_equal(ret, GSO_TEST_DATA_LEN, "Failed to send data to peer %d", ret);
+
+	test_sem_take(K_MSEC(CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT / 2), __LINE__);
+
+	/* Just send a RST packet to abort the underlying connection */
+	pkt = prepare_rst_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+	zassert_ok(net_recv_data(net_iface, pkt), "recv data failed");
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
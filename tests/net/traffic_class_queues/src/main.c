@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test the ordering of flows spread over several RX queues
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_TC_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_context.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "ipv6.h"
+#include "udp_internal.h"
+
+#define TEST_PORT 4242
+#define PEER_PORT 5000
+
+#define FLOWS 8
+#define PKTS_PER_FLOW 8
+#define PKTS (FLOWS * PKTS_PER_FLOW)
+
+static struct net_in6_addr my_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					   0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+static struct net_in6_addr peer_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					     0, 0, 0, 0, 0, 0, 0, 0x2 } } };
+
+static struct net_if *test_iface;
+static struct net_context *udp_ctx;
+
+/* Next sequence number expected on each flow, and the thread it came from */
+static uint32_t next_seq[FLOWS];
+static k_tid_t flow_thread[FLOWS];
+static atomic_t recv_cnt;
+static bool out_of_order;
+static K_SEM_DEFINE(recv_done, 0, 1);
+
+static uint8_t mac_addr[6] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+static void test_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr), NET_LINK_ETHERNET);
+}
+
+static int test_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct dummy_api test_if_api = {
+	.iface_api.init = test_iface_init,
+	.send = test_send,
+};
+
+NET_DEVICE_INIT(net_tc_queues_test, "net_tc_queues_test", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &test_if_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+static void recv_cb(struct net_context *context, struct net_pkt *pkt,
+		    union net_ip_header *ip_hdr, union net_proto_header *proto_hdr,
+		    int status, void *user_data)
+{
+	uint32_t data[2];
+	uint32_t flow;
+
+	ARG_UNUSED(context);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(user_data);
+
+	if (status < 0 || pkt == NULL) {
+		return;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) + net_pkt_ipv6_ext_len(pkt) +
+			 NET_UDPH_LEN) ||
+	    net_pkt_read(pkt, data, sizeof(data)) < 0) {
+		goto out;
+	}
+
+	flow = sys_le32_to_cpu(data[0]);
+	if (flow >= FLOWS) {
+		goto out;
+	}
+
+	/* Each flow is handled by one thread, no locking needed */
+	if (sys_le32_to_cpu(data[1]) != next_seq[flow]) {
+		out_of_order = true;
+	}
+
+	next_seq[flow] = sys_le32_to_cpu(data[1]) + 1U;
+	flow_thread[flow] = k_current_get();
+
+	if (atomic_inc(&recv_cnt) + 1 == PKTS) {
+		k_sem_give(&recv_done);
+	}
+
+out:
+	net_pkt_unref(pkt);
+}
+
+static struct net_pkt *prepare_udp_pkt(uint32_t flow, uint32_t seq)
+{
+	uint32_t data[2] = { sys_cpu_to_le32(flow), sys_cpu_to_le32(seq) };
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(test_iface, sizeof(data), NET_AF_INET6,
+					NET_IPPROTO_UDP, K_NO_WAIT);
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	if (net_ipv6_create(pkt, &peer_addr, &my_addr) ||
+	    net_udp_create(pkt, net_htons(PEER_PORT + flow), net_htons(TEST_PORT)) ||
+	    net_pkt_write(pkt, data, sizeof(data))) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_ipv6_finalize(pkt, NET_IPPROTO_UDP)) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+
+fail:
+	net_pkt_unref(pkt);
+
+	return NULL;
+}
+
+static void *setup(void)
+{
+	struct net_sockaddr_in6 addr = {
+		.sin6_family = NET_AF_INET6,
+		.sin6_port = net_htons(TEST_PORT),
+	};
+	int ret;
+
+	test_iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(test_iface, "Interface not available");
+
+	zassert_not_null(net_if_ipv6_addr_add(test_iface, &my_addr, NET_ADDR_MANUAL, 0),
+			 "Failed to add IPv6 address");
+
+	net_ipv6_addr_copy_raw((uint8_t *)&addr.sin6_addr, (uint8_t *)&my_addr);
+
+	ret = net_context_get(NET_AF_INET6, NET_SOCK_DGRAM, NET_IPPROTO_UDP, &udp_ctx);
+	zassert_equal(ret, 0, "Failed to get net_context (%d)", ret);
+
+	ret = net_context_bind(udp_ctx, (struct net_sockaddr *)&addr, sizeof(addr));
+	zassert_equal(ret, 0, "Failed to bind net_context (%d)", ret);
+
+	ret = net_context_recv(udp_ctx, recv_cb, K_NO_WAIT, NULL);
+	zassert_equal(ret, 0, "Failed to set recv callback (%d)", ret);
+
+	return NULL;
+}
+
+/* Send interleaved flows through the RX queues, expect each flow to be
+ * received in order, and the flows to be spread over several queues.
+ */
+ZTEST(net_traffic_class_queues, test_flow_order)
+{
+	int threads = 0;
+	struct net_pkt *pkt;
+
+	/* Queue the whole burst before any RX thread gets to run */
+	k_sched_lock();
+
+	for (uint32_t seq = 0; seq < PKTS_PER_FLOW; seq++) {
+		for (uint32_t flow = 0; flow < FLOWS; flow++) {
+			pkt = prepare_udp_pkt(flow, seq);
+			zassert_not_null(pkt, "Cannot create pkt");
+			zassert_ok(net_recv_data(test_iface, pkt), "recv data failed");
+		}
+	}
+
+	k_sched_unlock();
+
+	zassert_ok(k_sem_take(&recv_done, K_SECONDS(1)), "Only %ld packets received",
+		   atomic_get(&recv_cnt));
+	zassert_false(out_of_order, "Packets of a flow received out of order");
+
+	for (int i = 0; i < FLOWS; i++) {
+		zassert_equal(next_seq[i], PKTS_PER_FLOW, "Flow %d incomplete", i);
+
+		int j;
+
+		for (j = 0; j < i; j++) {
+			if (flow_thread[j] == flow_thread[i]) {
+				break;
+			}
+		}
+
+		if (j == i) {
+			threads++;
+		}
+	}
+
+	zassert_true(threads > 1, "All flows went through the same RX queue");
+}
+
+ZTEST_SUITE(net_traffic_class_queues, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test block based storage of the file system log backend
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_fs.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_internal.h>
+#include <zephyr/sys/byteorder.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_INF);
+
+#define MAX_PATH_LEN (256 + 7)
+#define BLOCK_SIZE CONFIG_LOG_BACKEND_FS_BLOCK_SIZE
+
+struct block_stats {
+	uint32_t blocks;
+	uint32_t msgs;
+};
+
+static void block_hdr_check(const struct log_backend_fs_block_hdr *hdr)
+{
+	zassert_equal(sys_le16_to_cpu(hdr->magic), LOG_BACKEND_FS_BLOCK_MAGIC);
+	zassert_equal(hdr->version, LOG_BACKEND_FS_BLOCK_VERSION);
+	zassert_equal(sys_le16_to_cpu(hdr->block_size), BLOCK_SIZE);
+	zassert_true(sys_le16_to_cpu(hdr->len) <= BLOCK_SIZE - sizeof(*hdr));
+	zassert_true(sys_le64_to_cpu(hdr->ts_first) <= sys_le64_to_cpu(hdr->ts_last));
+
+	if (!IS_ENABLED(CONFIG_LOG_BACKEND_FS_BLOCK_COMPRESSION)) {
+		zassert_equal(hdr->flags & LOG_BACKEND_FS_BLOCK_FLAG_COMPRESSED, 0);
+	}
+
+	if (hdr->flags & LOG_BACKEND_FS_BLOCK_FLAG_COMPRESSED) {
+		zassert_true(sys_le16_to_cpu(hdr->len) < sys_le16_to_cpu(hdr->raw_len));
+	} else {
+		zassert_equal(hdr->len, hdr->raw_len);
+	}
+}
+
+/* Check all blocks in a log file and return the stats. */
+static void file_check(const char *fname, struct block_stats *stats)
+{
+	struct log_backend_fs_block_hdr hdr;
+	struct fs_file_t file;
+	off_t offset = 0;
+	int rc;
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, fname, FS_O_READ);
+	zassert_equal(rc, 0, "Cannot open %s (%d)", fname, rc);
+
+	while (true) {
+		rc = fs_seek(&file, offset, FS_SEEK_SET);
+		zassert_equal(rc, 0);
+
+		rc = fs_read(&file, &hdr, sizeof(hdr));
+		if (rc == 0) {
+			break;
+		}
+
+		zassert_equal(rc, sizeof(hdr));
+		block_hdr_check(&hdr);
+		stats->blocks++;
+		stats->msgs += sys_le16_to_cpu(hdr.msg_cnt);
+		offset += BLOCK_SIZE;
+	}
+
+	zassert_equal(offset % BLOCK_SIZE, 0, "File size not a multiple of the block size");
+	(void)fs_close(&file);
+}
+
+static void dir_check(struct block_stats *stats)
+{
+	char fname[MAX_PATH_LEN];
+	struct fs_dirent ent;
+	struct fs_dir_t dir;
+	int rc;
+
+	fs_dir_t_init(&dir);
+	rc = fs_opendir(&dir, CONFIG_LOG_BACKEND_FS_DIR);
+	zassert_equal(rc, 0);
+
+	while (true) {
+		rc = fs_readdir(&dir, &ent);
+		zassert_equal(rc, 0);
+		if (ent.name[0] == 0) {
+			break;
+		}
+
+		snprintf(fname, sizeof(fname), "%s/%s", CONFIG_LOG_BACKEND_FS_DIR, ent.name);
+		file_check(fname, stats);
+	}
+
+	(void)fs_closedir(&dir);
+}
+
+static void log_msgs(int cnt)
+{
+	for (int i = 0; i < cnt; i++) {
+		LOG_INF("test message %d", i);
+		if ((i % 8) == 0) {
+			/* Let the processing thread keep up. */
+			k_msleep(1);
+		}
+	}
+
+	while (log_data_pending()) {
+		k_msleep(10);
+	}
+}
+
+ZTEST(log_backend_fs_blocks, test_blocks)
+{
+	struct block_stats before = {0};
+	struct block_stats after = {0};
+	int rc;
+
+	/* Messages logged before the test, e.g. when the file system was mounted. */
+	while (log_data_pending()) {
+		k_msleep(10);
+	}
+
+	rc = log_backend_fs_block_flush();
+	zassert_equal(rc, 0);
+	dir_check(&before);
+
+	log_msgs(200);
+
+	rc = log_backend_fs_block_flush();
+	zassert_equal(rc, 0);
+
+	dir_check(&after);
+	zassert_true((after.blocks - before.blocks) > 1, "Messages expected in multiple blocks");
+	zassert_equal(after.msgs - before.msgs, 200, "Unexpected message count %u",
+		      after.msgs - before.msgs);
+}
+
+static void random_fill(uint8_t *data, size_t len)
+{
+	uint32_t x = 12345;
+
+	for (size_t i = 0; i < len; i++) {
+		x = x * 1103515245U + 12345U;
+		data[i] = x >> 24;
+	}
+}
+
+ZTEST(log_backend_fs_blocks, test_msg_above_payload)
+{
+	struct block_stats before = {0};
+	struct block_stats after = {0};
+	static uint8_t data[220];
+	uint32_t expected;
+	int rc;
+
+	rc = log_backend_fs_block_flush();
+	zassert_equal(rc, 0);
+	dir_check(&before);
+
+	/* The second message is longer than the block payload but compresses
+	 * into a block on its own, not along with the first one. Its image must
+	 * be prepared after the first message is written.
+	 */
+	random_fill(data, 100);
+	LOG_HEXDUMP_INF(data, 64, "first");
+	LOG_HEXDUMP_INF(data, sizeof(data), "second");
+
+	while (log_data_pending()) {
+		k_msleep(10);
+	}
+
+	rc = log_backend_fs_block_flush();
+	zassert_equal(rc, 0);
+	dir_check(&after);
+
+	/* Without compression, the second message exceeds the staging buffer. */
+	expected = IS_ENABLED(CONFIG_LOG_BACKEND_FS_BLOCK_COMPRESSION) ? 2 : 1;
+	zassert_equal(after.msgs - before.msgs, expected, "Unexpected message count %u",
+		      after.msgs - before.msgs);
+}
+
+ZTEST(log_backend_fs_blocks, test_find)
+{
+	struct log_backend_fs_block_hdr hdr;
+	char fname[MAX_PATH_LEN];
+	struct fs_file_t file;
+	uint64_t timestamp;
+	off_t offset;
+	int rc;
+
+	log_msgs(100);
+	k_msleep(10);
+	timestamp = z_log_timestamp();
+	k_msleep(10);
+	log_msgs(100);
+
+	rc = log_backend_fs_block_flush();
+	zassert_equal(rc, 0);
+
+	rc = log_backend_fs_block_find(timestamp, fname, sizeof(fname), &offset);
+	zassert_equal(rc, 0, "Unexpected err: %d", rc);
+	zassert_equal(offset % BLOCK_SIZE, 0);
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, fname, FS_O_READ);
+	zassert_equal(rc, 0);
+
+	rc = fs_seek(&file, offset, FS_SEEK_SET);
+	zassert_equal(rc, 0);
+	rc = fs_read(&file, &hdr, sizeof(hdr));
+	zassert_equal(rc, sizeof(hdr));
+	block_hdr_check(&hdr);
+	zassert_true(sys_le64_to_cpu(hdr.ts_last) >= timestamp);
+
+	if (offset > 0) {
+		/* Previous block only has older messages. */
+		rc = fs_seek(&file, offset - BLOCK_SIZE, FS_SEEK_SET);
+		zassert_equal(rc, 0);
+		rc = fs_read(&file, &hdr, sizeof(hdr));
+		zassert_equal(rc, sizeof(hdr));
+		zassert_true(sys_le64_to_cpu(hdr.ts_last) < timestamp);
+	}
+
+	(void)fs_close(&file);
+
+	rc = log_backend_fs_block_find(z_log_timestamp(), fname, sizeof(fname), &offset);
+	zassert_equal(rc, -ENOENT, "No message expected, got: %d", rc);
+
+	rc = log_backend_fs_block_find(0, fname, 4, &offset);
+	zassert_equal(rc, -EINVAL, "Unexpected err: %d", rc);
+}
+
+ZTEST(log_backend_fs_blocks, test_panic)
+{
+	const struct log_backend *backend = log_backend_get_by_name("log_backend_fs");
+	struct block_stats before = {0};
+	struct block_stats after = {0};
+	int rc;
+
+	zassert_not_null(backend);
+
+	rc = log_backend_fs_block_flush();
+	zassert_equal(rc, 0);
+	dir_check(&before);
+
+	/* The messages are only collected in RAM, nothing flushes them. */
+	log_msgs(3);
+
+	backend->api->panic(backend);
+
+	dir_check(&after);
+	zassert_equal(after.msgs - before.msgs, 3, "Messages not written on panic (%u)",
+		      after.msgs - before.msgs);
+
+	log_backend_activate(backend, NULL);
+}
+
+ZTEST_SUITE(log_backend_fs_blocks, NULL, NULL, NULL, NULL, NULL);
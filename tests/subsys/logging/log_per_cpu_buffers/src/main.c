@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/ztest.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_INF);
+
+#define NUM_PRODUCERS 2
+#define ORDER_MSGS 16
+#define DROP_MSGS 200
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_PRODUCERS, STACK_SIZE);
+static struct k_thread threads[NUM_PRODUCERS];
+
+/* Timestamps are handed out in commit order, each one remembering the
+ * thread that committed it.
+ */
+static atomic_t ts_next;
+static k_tid_t ts_thread[NUM_PRODUCERS * ORDER_MSGS];
+
+static uint32_t processed_cnt;
+static uint32_t processed_per_thread[NUM_PRODUCERS];
+static uint32_t dropped_cnt;
+static log_timestamp_t last_ts;
+static bool out_of_order;
+
+static log_timestamp_t timestamp_get(void)
+{
+	atomic_val_t ts = atomic_inc(&ts_next);
+
+	if (ts < ARRAY_SIZE(ts_thread)) {
+		ts_thread[ts] = k_current_get();
+	}
+
+	return (log_timestamp_t)ts;
+}
+
+static void process(struct log_backend const *const backend,
+		    union log_msg_generic *msg)
+{
+	log_timestamp_t ts = log_msg_get_timestamp(&msg->log);
+
+	ARG_UNUSED(backend);
+
+	if ((processed_cnt > 0U) && (ts <= last_ts)) {
+		out_of_order = true;
+	}
+
+	if (ts < ARRAY_SIZE(ts_thread)) {
+		for (int i = 0; i < NUM_PRODUCERS; i++) {
+			if (ts_thread[ts] == &threads[i]) {
+				processed_per_thread[i]++;
+			}
+		}
+	}
+
+	last_ts = ts;
+	processed_cnt++;
+}
+
+static void dropped(struct log_backend const *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	dropped_cnt += cnt;
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api test_backend_api = {
+	.process = process,
+	.dropped = dropped,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(test_backend, test_backend_api, true);
+
+static void flush(void)
+{
+	while (log_process()) {
+	}
+
+	/* Pick up drops reported by the last call. */
+	(void)log_process();
+}
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	uintptr_t cnt = (uintptr_t)p1;
+	int cpu = (int)(uintptr_t)p2;
+
+	ARG_UNUSED(p3);
+
+	for (uintptr_t i = 0; i < cnt; i++) {
+		LOG_INF("cpu %d msg %d", cpu, (int)i);
+	}
+}
+
+/* Log @a cnt messages from a thread pinned to each of the first CPUs,
+ * concurrently and without processing in between.
+ */
+static void log_from_cpus(uint32_t cnt)
+{
+	if (arch_num_cpus() < NUM_PRODUCERS) {
+		ztest_test_skip();
+	}
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, producer,
+				(void *)(uintptr_t)cnt, (void *)(uintptr_t)i, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+		zassert_ok(k_thread_cpu_pin(&threads[i], i));
+	}
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		zassert_ok(k_thread_join(&threads[i], K_FOREVER));
+	}
+}
+
+ZTEST(log_per_cpu_buffers, test_timestamp_order)
+{
+	log_from_cpus(ORDER_MSGS);
+	flush();
+
+	zassert_equal(dropped_cnt, 0, "Unexpected drops: %u", dropped_cnt);
+	zassert_equal(processed_cnt, NUM_PRODUCERS * ORDER_MSGS);
+	zassert_false(out_of_order, "Messages not merged in timestamp order");
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		zassert_equal(processed_per_thread[i], ORDER_MSGS,
+			      "CPU %d: %u messages processed", i, processed_per_thread[i]);
+	}
+}
+
+ZTEST(log_per_cpu_buffers, test_drop_count)
+{
+	log_from_cpus(DROP_MSGS);
+	flush();
+
+	zassert_true(dropped_cnt > 0U, "Buffers did not overflow");
+	zassert_false(out_of_order, "Messages not merged in timestamp order");
+	zassert_equal(processed_cnt + dropped_cnt, NUM_PRODUCERS * DROP_MSGS,
+		      "%u processed, %u dropped", processed_cnt, dropped_cnt);
+	zassert_equal(log_buffered_cnt(), 0);
+}
+
+static void *setup(void)
+{
+	zassert_ok(log_set_timestamp_func(timestamp_get, 1000));
+
+	return NULL;
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	flush();
+
+	atomic_set(&ts_next, 0);
+	memset(ts_thread, 0, sizeof(ts_thread));
+	memset(processed_per_thread, 0, sizeof(processed_per_thread));
+	processed_cnt = 0U;
+	dropped_cnt = 0U;
+	out_of_order = false;
+}
+
+ZTEST_SUITE(log_per_cpu_buffers, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/ztest.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_INF);
+
+static uint32_t processed_cnt;
+
+static void process(struct log_backend const *const backend,
+		    union log_msg_generic *msg)
+{
+	ARG_UNUSED(backend);
+	ARG_UNUSED(msg);
+
+	processed_cnt++;
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api test_backend_api = {
+	.process = process,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(test_backend, test_backend_api, true);
+
+static uint32_t flush(void)
+{
+	uint32_t cnt;
+
+	while (log_process()) {
+	}
+
+	cnt = processed_cnt;
+	processed_cnt = 0;
+
+	return cnt;
+}
+
+static void config_set(uint32_t rate, uint32_t burst, bool dedup)
+{
+	struct log_source_ratelimit_config config = {
+		.rate = rate,
+		.burst = burst,
+		.dedup = dedup,
+	};
+
+	zassert_equal(log_source_ratelimit_set(&config), 0);
+}
+
+ZTEST(log_source_ratelimit, test_dedup)
+{
+	struct log_source_ratelimit_config config;
+	struct log_source_ratelimit_stats before;
+	struct log_source_ratelimit_stats after;
+
+	config_set(0, 1, true);
+	zassert_equal(log_source_ratelimit_get(&config, &before), 0);
+
+	for (int i = 0; i < 10; i++) {
+		LOG_INF("repeated %d", i);
+	}
+
+	zassert_equal(flush(), 1, "Repetitions not dropped");
+
+	/* A different message reports the repetitions first. */
+	LOG_INF("different");
+	zassert_equal(flush(), 2);
+
+	zassert_equal(log_source_ratelimit_get(&config, &after), 0);
+	zassert_equal(after.repeated - before.repeated, 9);
+	zassert_equal(after.suppressed, before.suppressed);
+}
+
+ZTEST(log_source_ratelimit, test_dedup_window)
+{
+	LOG_INF("window");
+	LOG_INF("window");
+	zassert_equal(flush(), 1);
+
+	/* Repetition after the window is let through with the count. */
+	k_msleep(CONFIG_LOG_SOURCE_RATELIMIT_DEDUP_WINDOW_MS + 10);
+	LOG_INF("window");
+	zassert_equal(flush(), 2);
+}
+
+ZTEST(log_source_ratelimit, test_rate_limit)
+{
+	struct log_source_ratelimit_config config;
+	struct log_source_ratelimit_stats before;
+	struct log_source_ratelimit_stats after;
+
+	config_set(10, 5, false);
+
+	/* Let the bucket refill from messages logged by previous tests. */
+	k_msleep(MSEC_PER_SEC);
+
+	zassert_equal(log_source_ratelimit_get(&config, &before), 0);
+
+	for (int i = 0; i < 20; i++) {
+		LOG_INF("burst %d", i);
+	}
+
+	zassert_equal(flush(), 5, "Burst not limited");
+
+	zassert_equal(log_source_ratelimit_get(&config, &after), 0);
+	zassert_equal(after.suppressed - before.suppressed, 15);
+
+	/* Bucket refills at 10 messages per second, next message is let
+	 * through along with the number of suppressed messages.
+	 */
+	k_msleep(150);
+	LOG_INF("after refill");
+	zassert_equal(flush(), 2);
+}
+
+ZTEST(log_source_ratelimit, test_rate_limit_fraction)
+{
+	uint32_t start;
+	uint32_t elapsed;
+	uint32_t cnt;
+
+	/* A rate that is not a multiple of 1000 refills a fraction of a token
+	 * per millisecond, which must be carried over rather than granted again.
+	 */
+	config_set(1500, 10, false);
+	k_msleep(MSEC_PER_SEC);
+
+	for (int i = 0; i < 20; i++) {
+		LOG_INF("drain %d", i);
+	}
+
+	zassert_equal(flush(), 10);
+
+	start = k_uptime_get_32();
+	k_busy_wait(USEC_PER_MSEC);
+
+	for (int i = 0; i < 20; i++) {
+		LOG_INF("fraction %d", i);
+	}
+
+	elapsed = k_uptime_get_32() - start;
+	cnt = flush();
+
+	/* Messages let through in the window of the drain and the loop, plus the
+	 * report of suppressed messages.
+	 */
+	zassert_true(cnt <= ((elapsed + 1U) * 1500U) / MSEC_PER_SEC + 1U,
+		     "Too many messages let through: %u in %u ms", cnt, elapsed);
+}
+
+ZTEST(log_source_ratelimit, test_disabled)
+{
+	config_set(0, 1, false);
+
+	for (int i = 0; i < 20; i++) {
+		LOG_INF("unlimited %d", i);
+	}
+
+	zassert_equal(flush(), 20);
+}
+
+ZTEST(log_source_ratelimit, test_invalid_config)
+{
+	struct log_source_ratelimit_config config = {
+		.rate = 10,
+		.burst = 0,
+	};
+
+	zassert_equal(log_source_ratelimit_set(&config), -EINVAL);
+
+	config.burst = UINT16_MAX + 1;
+	zassert_equal(log_source_ratelimit_set(&config), -EINVAL);
+}
+
+static void before(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	config_set(CONFIG_LOG_SOURCE_RATELIMIT_RATE, CONFIG_LOG_SOURCE_RATELIMIT_BURST,
+		   IS_ENABLED(CONFIG_LOG_SOURCE_RATELIMIT_DEDUP));
+	(void)flush();
+}
+
+ZTEST_SUITE(log_source_ratelimit, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdlib.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+
+/* This is a test suite for boot time performance of the settings subsystem:
+ * many keys spread over many handlers are loaded with settings_load(), then
+ * read back one by one with settings_load_one(). Compare the variants with and
+ * without CONFIG_SETTINGS_HANDLER_INDEX and the backend name caches.
+ */
+
+#define TEST_HANDLER_COUNT  (32)
+#define TEST_SETTINGS_COUNT (256)
+
+static uint32_t test_values[TEST_SETTINGS_COUNT];
+static uint32_t test_set_calls[TEST_HANDLER_COUNT];
+
+static int test_set(int handler, const char *key, size_t len, settings_read_cb read_cb,
+		    void *cb_arg)
+{
+	const char *next;
+	unsigned long idx;
+	uint32_t val;
+	ssize_t rc;
+
+	if (settings_name_next(key, &next) == 0 || key[0] != 'k') {
+		return -ENOENT;
+	}
+
+	idx = strtoul(&key[1], NULL, 10);
+	if (idx >= TEST_SETTINGS_COUNT || len != sizeof(val)) {
+		return -EINVAL;
+	}
+
+	rc = read_cb(cb_arg, &val, sizeof(val));
+	if (rc < 0) {
+		return rc;
+	}
+
+	test_values[idx] = val;
+	test_set_calls[handler]++;
+
+	return 0;
+}
+
+#define TEST_HANDLER_DEFINE(n, _)                                                                  \
+	static int test_set_##n(const char *key, size_t len, settings_read_cb read_cb,             \
+				void *cb_arg)                                                      \
+	{                                                                                          \
+		return test_set(n, key, len, read_cb, cb_arg);                                     \
+	}                                                                                          \
+	SETTINGS_STATIC_HANDLER_DEFINE(test_h##n, "perf/h" STRINGIFY(n), NULL, test_set_##n, NULL, \
+				       NULL)
+
+LISTIFY(TEST_HANDLER_COUNT, TEST_HANDLER_DEFINE, (;));
+
+static void test_key(char *path, size_t len, int i)
+{
+	snprintk(path, len, "perf/h%d/k%d", i % TEST_HANDLER_COUNT, i);
+}
+
+static void *settings_load_perf_setup(void)
+{
+	char path[24];
+	uint32_t val;
+	int err;
+
+	err = settings_subsys_init();
+	zassert_equal(err, 0, "settings_subsys_init failed %d", err);
+
+	for (int i = 0; i < TEST_SETTINGS_COUNT; i++) {
+		test_key(path, sizeof(path), i);
+		val = i ^ 0x5a5a5a5a;
+		err = settings_save_one(path, &val, sizeof(val));
+		zassert_equal(err, 0, "settings_save_one failed %d", err);
+	}
+
+	return NULL;
+}
+
+static void settings_load_perf_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(test_values, 0, sizeof(test_values));
+	memset(test_set_calls, 0, sizeof(test_set_calls));
+}
+
+ZTEST_SUITE(settings_load_perf, NULL, settings_load_perf_setup, settings_load_perf_before, NULL,
+	    NULL);
+
+ZTEST(settings_load_perf, test_load)
+{
+	uint32_t cycles;
+	int err;
+
+	cycles = k_cycle_get_32();
+	err = settings_load();
+	cycles = k_cycle_get_32() - cycles;
+	zassert_equal(err, 0, "settings_load failed %d", err);
+
+	printk("*** settings_load of %u entries in %u handlers ***\n", TEST_SETTINGS_COUNT,
+	       TEST_HANDLER_COUNT);
+	printk("total: %llu us\n", k_cyc_to_us_floor64(cycles));
+
+	for (int i = 0; i < TEST_HANDLER_COUNT; i++) {
+		zassert_equal(test_set_calls[i], TEST_SETTINGS_COUNT / TEST_HANDLER_COUNT,
+			      "Handler %d called %u times", i, test_set_calls[i]);
+	}
+
+	for (int i = 0; i < TEST_SETTINGS_COUNT; i++) {
+		zassert_equal(test_values[i], i ^ 0x5a5a5a5a, "Wrong value for entry %d", i);
+	}
+}
+
+ZTEST(settings_load_perf, test_load_one)
+{
+	uint32_t single_max = 0;
+	uint32_t single_min = UINT32_MAX;
+	uint64_t total = 0;
+	char path[24];
+	uint32_t val;
+	ssize_t len;
+
+	for (int i = 0; i < TEST_SETTINGS_COUNT; i++) {
+		test_key(path, sizeof(path), i);
+
+		uint32_t cycles = k_cycle_get_32();
+
+		len = settings_load_one(path, &val, sizeof(val));
+		cycles = k_cycle_get_32() - cycles;
+
+		zassert_equal(len, sizeof(val), "settings_load_one failed %zd", len);
+		zassert_equal(val, i ^ 0x5a5a5a5a, "Wrong value for entry %d", i);
+
+		single_max = MAX(single_max, cycles);
+		single_min = MIN(single_min, cycles);
+		total += cycles;
+	}
+
+	printk("*** settings_load_one of %u entries ***\n", TEST_SETTINGS_COUNT);
+	printk("total: %llu us, entry max: %llu us, entry min: %llu us\n",
+	       k_cyc_to_us_floor64(total), k_cyc_to_us_floor64(single_max),
+	       k_cyc_to_us_floor64(single_min));
+
+	len = settings_load_one("perf/h0/missing", &val, sizeof(val));
+	zassert_equal(len, 0, "Missing key returned %zd", len);
+}